@@ -8,7 +8,6 @@
 #ifndef PRIVATE_VDA5050_2B_2B_CORE_ACTION_STATUS_MANAGER_H_
 #define PRIVATE_VDA5050_2B_2B_CORE_ACTION_STATUS_MANAGER_H_
 
-#include <eventpp/eventqueue.h>
 #include <eventpp/utilities/scopedremover.h>
 
 #include <functional>
@@ -16,14 +15,16 @@
 #include <thread>
 
 #include "vda5050++/config/event_manager_options.h"
-#include "vda5050++/core/common/scoped_thread.h"
+#include "vda5050++/core/common/event_queue_policy.h"
+#include "vda5050++/core/common/event_statistics.h"
+#include "vda5050++/core/common/queue_processor.h"
 #include "vda5050++/events/action_event.h"
 
 namespace vda5050pp::core {
 
 using ActionStatusQueue =
-    eventpp::EventQueue<vda5050pp::events::ActionStatusType,
-                        void(std::shared_ptr<vda5050pp::events::ActionStatus>)>;
+    common::DefaultQueuePolicy::Queue<vda5050pp::events::ActionStatusType,
+                                      std::shared_ptr<vda5050pp::events::ActionStatus>>;
 
 class ScopedActionStatusSubscriber {
 private:
@@ -49,16 +50,20 @@ public:
 
 class ActionStatusManager {
 private:
+  vda5050pp::core::common::EventStatisticsRecorder statistics_recorder_;
   ActionStatusQueue action_status_queue_;
 
   const vda5050pp::config::EventManagerOptions &opts_;
 
-  vda5050pp::core::common::ScopedThread<void()> thread_;
+  vda5050pp::core::common::QueueProcessor processor_;
 
-  void threadTask(vda5050pp::core::common::StopToken tkn) noexcept(true);
+  void processQueue() noexcept(true);
 
 public:
-  explicit ActionStatusManager(const vda5050pp::config::EventManagerOptions &opts);
+  explicit ActionStatusManager(
+      const vda5050pp::config::EventManagerOptions &opts,
+      std::shared_ptr<vda5050pp::core::common::WorkerPool> worker_pool = nullptr,
+      Instance *instance = nullptr);
 
   void dispatch(std::shared_ptr<vda5050pp::events::ActionStatusWaiting> data) noexcept(true);
   void dispatch(std::shared_ptr<vda5050pp::events::ActionStatusInitializing> data) noexcept(true);
@@ -68,6 +73,9 @@ public:
   void dispatch(std::shared_ptr<vda5050pp::events::ActionStatusFailed> data) noexcept(true);
 
   ScopedActionStatusSubscriber getScopedActionStatusSubscriber() noexcept(true);
+
+  const vda5050pp::core::common::EventStatisticsRecorder &getStatisticsRecorder() const
+      noexcept(true);
 };
 
 }  // namespace vda5050pp::core
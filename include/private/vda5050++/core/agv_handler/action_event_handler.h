@@ -10,6 +10,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 
 #include "vda5050++/core/action_event_manager.h"
@@ -33,7 +34,11 @@ private:
         action_parameters;
   };
 
+  // Validations may run in parallel to each other and to the other action events
+  std::mutex handled_actions_mutex_;
   std::map<std::string, ActionStore, std::less<>> handled_actions_;
+  // Serializes match() and validate() of action handlers, which are not thread-safe
+  std::mutex unsafe_handler_mutex_;
 
   void handleActionListEvent(std::shared_ptr<vda5050pp::events::ActionList> data) const
       noexcept(false);
@@ -9,12 +9,21 @@
 #define VDA5050_2B_2B_CORE_AGV_HANDLER_ACTION_STATE_H_
 
 #include <list>
+#include <memory>
 
 #include "vda5050++/handler/action_state.h"
 
+namespace vda5050pp::core {
+class Instance;
+}  // namespace vda5050pp::core
+
 namespace vda5050pp::core::agv_handler {
 
 class ActionState : public vda5050pp::handler::ActionState {
+private:
+  // The user may set the state from any thread, so keep the instance of the action
+  std::weak_ptr<vda5050pp::core::Instance> instance_;
+
 public:
   explicit ActionState(std::shared_ptr<const vda5050::Action> action) noexcept(true);
 
@@ -0,0 +1,234 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+//
+// This file contains the (optional) coroutine layer used by event handlers, which await
+// SynchronizedEvent results instead of blocking an event manager thread.
+//
+
+#ifndef VDA5050_2B_2B_CORE_COMMON_COROUTINE_H_
+#define VDA5050_2B_2B_CORE_COMMON_COROUTINE_H_
+
+#ifdef LIBVDA5050PP_COROUTINES
+
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+#include "vda5050++/core/common/scoped_thread.h"
+#include "vda5050++/core/common/worker_pool.h"
+#include "vda5050++/core/instance_scope.h"
+#include "vda5050++/events/synchronized_event.h"
+
+namespace vda5050pp::core::common {
+
+///
+///\brief Resumes suspended coroutines on a WorkerPool and provides deadlines for awaiters.
+///
+/// All deadlines of an executor are tracked by a single timer thread, which only hands expired
+/// deadlines over to the pool. Awaiters only keep a Ref to the executor. Coroutines, which are
+/// resumed after the executor was destroyed, are discarded (not resumed).
+///
+class CoroutineExecutor final {
+private:
+  struct State {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::multimap<std::chrono::steady_clock::time_point, std::function<void()>> deadlines;
+    std::shared_ptr<WorkerPool> pool;
+    Instance *instance = nullptr;  // Bound while resuming coroutines and running deadlines
+    bool closed = false;
+  };
+
+  std::shared_ptr<State> state_;
+  std::optional<ScopedThread<void()>> timer_thread_;
+
+  static void timerTask(const std::shared_ptr<State> &state) noexcept(true);
+
+public:
+  ///
+  ///\brief A non-owning reference to a CoroutineExecutor, which can outlive the executor.
+  ///
+  class Ref {
+  private:
+    friend class CoroutineExecutor;
+    std::shared_ptr<State> state_;
+
+    explicit Ref(std::shared_ptr<State> state) noexcept(true) : state_(std::move(state)) {}
+
+  public:
+    ///
+    ///\brief Resume a coroutine on the pool (discarded if the executor was destroyed).
+    ///
+    ///\param handle the suspended coroutine
+    ///
+    void post(std::coroutine_handle<> handle) const noexcept(false);
+
+    ///
+    ///\brief Run a function on the timer thread, once the deadline passed. The function must
+    /// return quickly. It is discarded if the executor was destroyed.
+    ///
+    ///\param deadline the deadline
+    ///\param fn the function
+    ///
+    void postAt(std::chrono::steady_clock::time_point deadline,
+                std::function<void()> &&fn) const noexcept(false);
+  };
+
+  ///
+  ///\brief Construct a new CoroutineExecutor
+  ///
+  ///\param pool the pool to resume coroutines on (if nullptr, a single worker pool is created)
+  ///\param instance the Instance bound while resuming coroutines (may be nullptr)
+  ///
+  explicit CoroutineExecutor(std::shared_ptr<WorkerPool> pool,
+                             Instance *instance = nullptr) noexcept(false);
+
+  ///
+  ///\brief Stop the timer thread. Pending deadlines and resumptions are discarded.
+  ///
+  ~CoroutineExecutor() noexcept(true);
+
+  CoroutineExecutor(const CoroutineExecutor &) = delete;
+  CoroutineExecutor(CoroutineExecutor &&) = delete;
+  CoroutineExecutor &operator=(const CoroutineExecutor &) = delete;
+  CoroutineExecutor &operator=(CoroutineExecutor &&) = delete;
+
+  ///
+  ///\brief Get a reference to this executor
+  ///
+  ///\return Ref the reference
+  ///
+  Ref ref() const noexcept(true);
+};
+
+///
+///\brief A fire-and-forget coroutine. It starts running eagerly on the calling thread and
+/// destroys itself, when it finishes. Exceptions escaping the coroutine are logged.
+///
+class Task {
+public:
+  struct promise_type {
+    Task get_return_object() noexcept(true) { return {}; }
+    std::suspend_never initial_suspend() noexcept(true) { return {}; }
+    std::suspend_never final_suspend() noexcept(true) { return {}; }
+    void return_void() noexcept(true) {}
+    void unhandled_exception() noexcept(true);
+  };
+};
+
+///
+///\brief Throw VDA5050PPSynchronizedEventTimedOut (used by all ScheduledResultAwaiters).
+///
+[[noreturn]] void throwResultTimedOut();
+
+///
+///\brief Awaits the result of a SynchronizedEvent and resumes the awaiting coroutine on a
+/// CoroutineExecutor (instead of the thread setting the result).
+///
+/// If a timeout was given and no result is available in time, the awaiter throws
+/// VDA5050PPSynchronizedEventTimedOut.
+///
+///\tparam ResultT the result type
+///
+template <typename ResultT>
+class ScheduledResultAwaiter : public vda5050pp::events::SynchronizedEventAwaitable<ResultT> {
+private:
+  CoroutineExecutor::Ref executor_;
+  std::optional<std::chrono::steady_clock::duration> timeout_;
+  std::coroutine_handle<> handle_;
+  bool timed_out_ = false;
+
+  static void schedule(void *self) noexcept(true) {
+    auto awaiter = static_cast<ScheduledResultAwaiter *>(self);
+    // The awaiter may be destroyed as soon as the coroutine was posted
+    auto executor = awaiter->executor_;
+    try {
+      executor.post(awaiter->handle_);
+    } catch (...) {
+      // Cannot resume, the coroutine is discarded
+    }
+  }
+
+public:
+  ScheduledResultAwaiter(vda5050pp::events::SynchronizedEventAwaitable<ResultT> &&awaitable,
+                         CoroutineExecutor::Ref executor,
+                         std::optional<std::chrono::steady_clock::duration> timeout) noexcept(true)
+      : vda5050pp::events::SynchronizedEventAwaitable<ResultT>(std::move(awaitable)),
+        executor_(std::move(executor)),
+        timeout_(timeout) {}
+
+  bool await_suspend(std::coroutine_handle<> handle) noexcept(false) {
+    this->handle_ = handle;
+
+    // This awaiter must not be accessed after the continuation was set
+    auto state = this->shared_state_;
+    auto executor = this->executor_;
+    auto timeout = this->timeout_;
+
+    if (!state->setContinuation(&ScheduledResultAwaiter::schedule, this)) {
+      return false;
+    }
+
+    if (!timeout.has_value()) {
+      return true;
+    }
+
+    try {
+      executor.postAt(std::chrono::steady_clock::now() + *timeout, [state, executor, handle,
+                                                                    self = this] {
+        // Only resume, if publishing the result did not take the continuation.
+        // Otherwise the awaiter may already be gone.
+        if (state->removeContinuation()) {
+          self->timed_out_ = true;
+          executor.post(handle);
+        }
+      });
+    } catch (...) {
+      if (state->removeContinuation()) {
+        throw;
+      }
+      // The result was published in the meantime, the coroutine is (being) resumed
+    }
+    return true;
+  }
+
+  ResultT await_resume() noexcept(false) {
+    if (this->timed_out_) {
+      throwResultTimedOut();
+    }
+    return this->shared_state_->take();
+  }
+};
+
+///
+///\brief Await the result of a SynchronizedEvent on an executor (co_await awaitResult(...)).
+///
+///\tparam ResultT the result type
+///\param awaitable the awaitable (evt->result())
+///\param executor the executor to resume on
+///\param timeout the optional timeout
+///\return ScheduledResultAwaiter<ResultT> the awaiter
+///
+template <typename ResultT>
+inline ScheduledResultAwaiter<ResultT> awaitResult(
+    vda5050pp::events::SynchronizedEventAwaitable<ResultT> &&awaitable,
+    CoroutineExecutor::Ref executor,
+    std::optional<std::chrono::steady_clock::duration> timeout = std::nullopt) noexcept(true) {
+  return ScheduledResultAwaiter<ResultT>(std::move(awaitable), std::move(executor), timeout);
+}
+
+}  // namespace vda5050pp::core::common
+
+#endif  // LIBVDA5050PP_COROUTINES
+
+#endif  // VDA5050_2B_2B_CORE_COMMON_COROUTINE_H_
@@ -0,0 +1,54 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+//
+// This file contains the event processing loop shared by all event managers
+//
+
+#ifndef VDA5050_2B_2B_CORE_COMMON_EVENT_PROCESSING_H_
+#define VDA5050_2B_2B_CORE_COMMON_EVENT_PROCESSING_H_
+
+#include <exception>
+#include <string_view>
+
+#include "vda5050++/core/common/formatters.h"
+#include "vda5050++/core/logger.h"
+#include "vda5050++/exception.h"
+
+namespace vda5050pp::core::common {
+
+///
+///\brief Process queued events one by one, until there are none left.
+///
+/// An exception thrown by a listener is logged and does not stop the processing of the remaining
+/// events. The event, which caused it, is discarded.
+///
+///\tparam ProcessOneT the type of process_one (bool())
+///\param process_one processes the next event, returns false if there was none
+///\param manager_name the name of the processing manager (for logging)
+///
+template <typename ProcessOneT>
+void processEvents(ProcessOneT &&process_one, std::string_view manager_name) noexcept(true) {
+  bool processed = true;
+  while (processed) {
+    try {
+      processed = process_one();
+    } catch (const vda5050pp::VDA5050PPError &err) {
+      getEventsLogger()->error("{} caught an exception, while processing events:\n {}",
+                               manager_name, err);
+    } catch (const std::exception &err) {
+      getEventsLogger()->error("{} caught an exception, while processing events:\n {}",
+                               manager_name, err.what());
+    } catch (...) {
+      getEventsLogger()->error("{} caught an unknown exception, while processing events",
+                               manager_name);
+    }
+  }
+}
+
+}  // namespace vda5050pp::core::common
+
+#endif  // VDA5050_2B_2B_CORE_COMMON_EVENT_PROCESSING_H_
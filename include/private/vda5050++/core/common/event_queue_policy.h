@@ -0,0 +1,551 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+//
+// This file contains the queue policies of the event managers
+//
+
+#ifndef VDA5050_2B_2B_CORE_COMMON_EVENT_QUEUE_POLICY_H_
+#define VDA5050_2B_2B_CORE_COMMON_EVENT_QUEUE_POLICY_H_
+
+#include <eventpp/eventdispatcher.h>
+#include <eventpp/eventqueue.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+#include "vda5050++/config/event_manager_options.h"
+#include "vda5050++/core/common/event_statistics.h"
+#include "vda5050++/core/common/mpsc_ring_buffer.h"
+
+namespace vda5050pp::core::common {
+
+namespace detail {
+// The number of EventLane dispatches on the current thread (used to never block event workers)
+inline thread_local std::size_t t_lane_dispatch_depth = 0;
+}  // namespace detail
+
+///
+///\brief A queue of (id, event) pairs, which is backed by a MpscRingBuffer.
+///
+/// Producers do not lock and do not allocate as long as the ring buffer has free cells.
+///
+/// Without a QueueLimit (capacity 0), the lane is unbounded: if the ring buffer is full, events
+/// spill into a mutex protected overflow list (the slow path), such that enqueue never blocks and
+/// never drops events. While the overflow list is non-empty, all events go there to keep the
+/// enqueue order.
+///
+/// With a QueueLimit (capacity > 0), the ring buffer holds the capacity and producers reserve a
+/// slot with a single atomic counter. Only if the lane is full, the QueueOverflowPolicy is applied
+/// on the ring buffer and overflows are reported to the EventStatisticsRecorder. With
+/// k_drop_oldest and k_coalesce, the consumer and producers of a full lane synchronize with a
+/// mutex, since both modify pending events.
+///
+/// The lane does not have listeners, its events are dispatched with an external dispatcher.
+/// process() and processOne() must only be called by one thread at a time.
+///
+/// With LIBVDA5050PP_EVENT_INSTRUMENTATION, each event carries its enqueue time and the lane
+/// reports queue wait and handler duration to an optional EventStatisticsRecorder.
+///
+///\tparam IdT the event id type
+///\tparam EventPtrT the event (pointer) type
+///
+template <typename IdT, typename EventPtrT> class EventLane {
+public:
+  static constexpr std::size_t k_default_capacity = 1024;
+
+private:
+  struct Entry {
+    IdT id{};
+    EventPtrT event;
+#ifdef LIBVDA5050PP_EVENT_INSTRUMENTATION
+    std::chrono::steady_clock::time_point enqueued_at{};
+#endif
+  };
+
+  std::optional<MpscRingBuffer<Entry>> ring_buffer_;
+
+  EventStatisticsRecorder *statistics_recorder_ = nullptr;
+  vda5050pp::config::QueueLimit limit_;
+  std::function<void(IdT, EventPtrT &)> drop_handler_;
+
+  // The number of pending events (including reserved ones), only counted with a limit
+  std::atomic<std::size_t> size_ = 0;
+  // The number of producers waiting for space (k_block)
+  std::atomic<std::size_t> waiters_ = 0;
+  // Held by the consumer and producers of a full lane, which modify pending events
+  std::mutex consumer_mutex_;
+
+  // Guards the overflow list and the wait for space
+  std::mutex overflow_mutex_;
+  std::condition_variable not_full_cv_;
+  std::deque<Entry> overflow_;
+  std::atomic<std::size_t> overflow_size_ = 0;
+  std::atomic<std::size_t> overflow_count_ = 0;
+
+  // Overflow events taken by the consumer (older than all events in the ring buffer)
+  std::deque<Entry> taken_;
+
+  bool consumerLocked() const noexcept(true) {
+    return this->limit_.capacity > 0 &&
+           (this->limit_.policy == vda5050pp::config::QueueOverflowPolicy::k_drop_oldest ||
+            this->limit_.policy == vda5050pp::config::QueueOverflowPolicy::k_coalesce);
+  }
+
+  bool tryReserve() noexcept(true) {
+    auto size = this->size_.load();
+    while (size < this->limit_.capacity) {
+      if (this->size_.compare_exchange_weak(size, size + 1)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void push(Entry &&entry) noexcept(false) {
+    if (this->overflow_size_.load(std::memory_order_acquire) == 0 &&
+        this->ring_buffer_->tryPush(std::move(entry))) {
+      return;
+    }
+
+    std::unique_lock lock(this->overflow_mutex_);
+    this->overflow_.push_back(std::move(entry));
+    this->overflow_size_.store(this->overflow_.size(), std::memory_order_release);
+    this->overflow_count_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void reportOverflow(IdT id) noexcept(true) {
+    if (this->statistics_recorder_ != nullptr) {
+      this->statistics_recorder_->recordOverflow(static_cast<std::size_t>(id),
+                                                 this->limit_.policy);
+    }
+  }
+
+  void enqueueFull(Entry &&entry) noexcept(false) {
+    IdT reported_id = entry.id;
+    std::optional<Entry> dropped;  // Released after unlocking
+
+    switch (this->limit_.policy) {
+      case vda5050pp::config::QueueOverflowPolicy::k_block: {
+        if (detail::t_lane_dispatch_depth > 0) {
+          // Never block event workers (deadlock), exceed the capacity and report the overrun
+          this->size_++;
+          this->push(std::move(entry));
+          if (this->statistics_recorder_ != nullptr) {
+            this->statistics_recorder_->recordOverrun(static_cast<std::size_t>(reported_id));
+          }
+          return;
+        }
+        // Report before waiting, such that a stalled producer is visible
+        this->reportOverflow(reported_id);
+        {
+          std::unique_lock lock(this->overflow_mutex_);
+          this->waiters_++;
+          this->not_full_cv_.wait(lock, [this] { return this->tryReserve(); });
+          this->waiters_--;
+        }
+        this->push(std::move(entry));
+        return;
+      }
+      case vda5050pp::config::QueueOverflowPolicy::k_drop_oldest: {
+        std::unique_lock lock(this->consumer_mutex_);
+        // Take over the slot of the oldest event (it may still be written by its producer)
+        while (!this->tryReserve()) {
+          if (dropped = this->pop(); dropped.has_value()) {
+            reported_id = dropped->id;
+            break;
+          }
+          std::this_thread::yield();
+        }
+        this->push(std::move(entry));
+        if (!dropped.has_value()) {
+          return;
+        }
+        break;
+      }
+      case vda5050pp::config::QueueOverflowPolicy::k_coalesce: {
+        std::unique_lock lock(this->consumer_mutex_);
+        if (this->tryReserve()) {
+          this->push(std::move(entry));
+          return;
+        }
+        auto same_id = [&entry](const Entry &e) { return e.id == entry.id; };
+        Entry *pending = this->ring_buffer_->findNewest(same_id);
+        if (pending == nullptr) {
+          if (auto it = std::find_if(this->taken_.rbegin(), this->taken_.rend(), same_id);
+              it != this->taken_.rend()) {
+            pending = &*it;
+          }
+        }
+        if (pending != nullptr) {
+          dropped = std::move(*pending);
+          *pending = std::move(entry);
+        } else {
+          dropped = std::move(entry);
+        }
+        break;
+      }
+      default:  // k_drop_newest
+        dropped = std::move(entry);
+        break;
+    }
+
+    this->reportOverflow(reported_id);
+    if (dropped.has_value() && this->drop_handler_) {
+      this->drop_handler_(dropped->id, dropped->event);
+    }
+  }
+
+  // Take the oldest event (consumer only)
+  std::optional<Entry> pop() noexcept(false) {
+    if (!this->taken_.empty()) {
+      std::optional<Entry> entry(std::move(this->taken_.front()));
+      this->taken_.pop_front();
+      return entry;
+    }
+
+    if (auto entry = this->ring_buffer_->tryPop(); entry.has_value()) {
+      return entry;
+    }
+
+    // The ring buffer is drained, all events in the overflow list are newer
+    if (this->overflow_size_.load(std::memory_order_acquire) > 0) {
+      std::unique_lock lock(this->overflow_mutex_);
+      this->taken_.swap(this->overflow_);
+      this->overflow_size_.store(0, std::memory_order_release);
+    }
+
+    if (!this->taken_.empty()) {
+      std::optional<Entry> entry(std::move(this->taken_.front()));
+      this->taken_.pop_front();
+      return entry;
+    }
+
+    return std::nullopt;
+  }
+
+  struct DispatchDepthGuard {
+    DispatchDepthGuard() noexcept(true) { detail::t_lane_dispatch_depth++; }
+    ~DispatchDepthGuard() noexcept(true) { detail::t_lane_dispatch_depth--; }
+    DispatchDepthGuard(const DispatchDepthGuard &) = delete;
+    DispatchDepthGuard &operator=(const DispatchDepthGuard &) = delete;
+  };
+
+  std::optional<Entry> next() noexcept(false) {
+    if (this->limit_.capacity == 0) {
+      return this->pop();
+    }
+
+    std::optional<Entry> entry;
+    if (this->consumerLocked()) {
+      std::unique_lock lock(this->consumer_mutex_);
+      entry = this->pop();
+    } else {
+      entry = this->pop();
+    }
+
+    if (entry.has_value()) {
+      this->size_--;
+      if (this->waiters_.load() > 0) {
+        { std::unique_lock lock(this->overflow_mutex_); }
+        this->not_full_cv_.notify_all();
+      }
+    }
+    return entry;
+  }
+
+public:
+  ///
+  ///\brief Construct a new EventLane
+  ///
+  ///\param capacity the capacity of the ring buffer
+  ///
+  explicit EventLane(std::size_t capacity = k_default_capacity)
+      : ring_buffer_(std::in_place, capacity) {}
+
+  ///
+  ///\brief Set the recorder of the event statistics (must be set before enqueueing events).
+  /// Latencies are only recorded with LIBVDA5050PP_EVENT_INSTRUMENTATION.
+  ///
+  ///\param recorder the recorder (may be nullptr, must outlive the lane)
+  ///
+  void setStatisticsRecorder(EventStatisticsRecorder *recorder) noexcept(true) {
+    this->statistics_recorder_ = recorder;
+  }
+
+  ///
+  ///\brief Set the capacity limit of this lane (must be set before enqueueing events).
+  /// With a limit, the ring buffer is resized to the capacity.
+  ///
+  ///\param limit the limit (capacity 0: unbounded)
+  ///
+  void setLimit(const vda5050pp::config::QueueLimit &limit) noexcept(false) {
+    this->limit_ = limit;
+    if (limit.capacity > 0) {
+      this->ring_buffer_.emplace(limit.capacity);
+    }
+  }
+
+  ///
+  ///\brief Set a handler, which is called for each event dropped by the QueueLimit (must be set
+  /// before enqueueing events). It is called by the enqueueing thread without holding any lock.
+  ///
+  ///\param handler the handler (id, event)
+  ///
+  void setDropHandler(std::function<void(IdT, EventPtrT &)> handler) noexcept(true) {
+    this->drop_handler_ = std::move(handler);
+  }
+
+  ///
+  ///\brief Enqueue an event (thread-safe)
+  ///
+  ///\param id the event id
+  ///\param event the event
+  ///
+  void enqueue(IdT id, EventPtrT event) noexcept(false) {
+    Entry entry{id, std::move(event)};
+#ifdef LIBVDA5050PP_EVENT_INSTRUMENTATION
+    if (this->statistics_recorder_ != nullptr) {
+      this->statistics_recorder_->recordEnqueue(static_cast<std::size_t>(id));
+      entry.enqueued_at = std::chrono::steady_clock::now();
+    }
+#endif
+
+    if (this->limit_.capacity == 0 || this->tryReserve()) {
+      this->push(std::move(entry));
+    } else {
+      this->enqueueFull(std::move(entry));
+    }
+  }
+
+  ///
+  ///\brief Dispatch the next enqueued event (single consumer only)
+  ///
+  ///\tparam DispatcherT the dispatcher type (i.e. eventpp::EventDispatcher)
+  ///\param dispatcher the dispatcher to dispatch the event with
+  ///\return true if an event was processed
+  ///
+  template <typename DispatcherT> bool processOne(const DispatcherT &dispatcher) {
+    auto entry = this->next();
+    if (!entry.has_value()) {
+      return false;
+    }
+    DispatchDepthGuard guard;
+#ifdef LIBVDA5050PP_EVENT_INSTRUMENTATION
+    if (this->statistics_recorder_ != nullptr) {
+      auto dispatch_start = std::chrono::steady_clock::now();
+      dispatcher.dispatch(entry->id, entry->event);
+      auto dispatch_end = std::chrono::steady_clock::now();
+      this->statistics_recorder_->recordProcessed(static_cast<std::size_t>(entry->id),
+                                                  dispatch_start - entry->enqueued_at,
+                                                  dispatch_end - dispatch_start);
+      return true;
+    }
+#endif
+    dispatcher.dispatch(entry->id, entry->event);
+    return true;
+  }
+
+  ///
+  ///\brief Dispatch all enqueued events (single consumer only)
+  ///
+  ///\tparam DispatcherT the dispatcher type (i.e. eventpp::EventDispatcher)
+  ///\param dispatcher the dispatcher to dispatch the events with
+  ///\return true if any event was processed
+  ///
+  template <typename DispatcherT> bool process(const DispatcherT &dispatcher) {
+    bool processed = false;
+    while (this->processOne(dispatcher)) {
+      processed = true;
+    }
+    return processed;
+  }
+
+  ///
+  ///\brief Get the number of events, which did not fit into the ring buffer
+  ///
+  ///\return std::size_t number of events
+  ///
+  std::size_t overflowCount() const noexcept(true) {
+    return this->overflow_count_.load(std::memory_order_relaxed);
+  }
+};
+
+///
+///\brief An event queue with the eventpp::EventQueue interface, which is backed by an EventLane.
+///
+///\tparam IdT the event id type
+///\tparam EventPtrT the event (pointer) type
+///
+template <typename IdT, typename EventPtrT>
+class RingBufferEventQueue : public eventpp::EventDispatcher<IdT, void(EventPtrT)> {
+private:
+  EventLane<IdT, EventPtrT> lane_;
+
+public:
+  static constexpr std::size_t k_default_capacity = EventLane<IdT, EventPtrT>::k_default_capacity;
+
+  ///
+  ///\brief Construct a new RingBufferEventQueue
+  ///
+  ///\param capacity the capacity of the ring buffer
+  ///
+  explicit RingBufferEventQueue(std::size_t capacity = k_default_capacity) : lane_(capacity) {}
+
+  ///
+  ///\brief Enqueue an event (thread-safe)
+  ///
+  ///\param id the event id
+  ///\param event the event
+  ///
+  void enqueue(IdT id, EventPtrT event) noexcept(false) {
+    this->lane_.enqueue(id, std::move(event));
+  }
+
+  ///
+  ///\brief Dispatch the next enqueued event to the listeners (single consumer only)
+  ///
+  ///\return true if an event was processed
+  ///
+  bool processOne() { return this->lane_.processOne(*this); }
+
+  ///
+  ///\brief Dispatch all enqueued events to the listeners (single consumer only)
+  ///
+  ///\return true if any event was processed
+  ///
+  bool process() { return this->lane_.process(*this); }
+
+  ///
+  ///\brief Get the number of events, which did not fit into the ring buffer
+  ///
+  ///\return std::size_t number of events
+  ///
+  std::size_t overflowCount() const noexcept(true) { return this->lane_.overflowCount(); }
+
+  ///
+  ///\brief Set the recorder of the event statistics (see EventLane::setStatisticsRecorder)
+  ///
+  ///\param recorder the recorder (may be nullptr, must outlive the queue)
+  ///
+  void setStatisticsRecorder(EventStatisticsRecorder *recorder) noexcept(true) {
+    this->lane_.setStatisticsRecorder(recorder);
+  }
+
+  ///
+  ///\brief Set the capacity limit of the queue (see EventLane::setLimit)
+  ///
+  ///\param limit the limit (capacity 0: unbounded)
+  ///
+  void setLimit(const vda5050pp::config::QueueLimit &limit) noexcept(false) {
+    this->lane_.setLimit(limit);
+  }
+
+  ///
+  ///\brief Set the handler of dropped events (see EventLane::setDropHandler)
+  ///
+  ///\param handler the handler (id, event)
+  ///
+  void setDropHandler(std::function<void(IdT, EventPtrT &)> handler) noexcept(true) {
+    this->lane_.setDropHandler(std::move(handler));
+  }
+};
+
+///
+///\brief Attach an EventStatisticsRecorder to a queue. Queues without instrumentation
+/// (i.e. eventpp::EventQueue) are not recorded.
+///
+///\tparam QueueT the queue type
+///
+template <typename QueueT>
+void setStatisticsRecorder(QueueT &, EventStatisticsRecorder *) noexcept(true) {}
+
+///
+///\brief Attach an EventStatisticsRecorder to a RingBufferEventQueue
+///
+///\param queue the queue
+///\param recorder the recorder (may be nullptr, must outlive the queue)
+///
+template <typename IdT, typename EventPtrT>
+void setStatisticsRecorder(RingBufferEventQueue<IdT, EventPtrT> &queue,
+                           EventStatisticsRecorder *recorder) noexcept(true) {
+  queue.setStatisticsRecorder(recorder);
+}
+
+///
+///\brief Set the capacity limit of a queue. Queues without limit support
+/// (i.e. eventpp::EventQueue) stay unbounded.
+///
+///\tparam QueueT the queue type
+///
+template <typename QueueT>
+void setQueueLimit(QueueT &, const vda5050pp::config::QueueLimit &) noexcept(false) {}
+
+///
+///\brief Set the capacity limit of a RingBufferEventQueue
+///
+///\param queue the queue
+///\param limit the limit (capacity 0: unbounded)
+///
+template <typename IdT, typename EventPtrT>
+void setQueueLimit(RingBufferEventQueue<IdT, EventPtrT> &queue,
+                   const vda5050pp::config::QueueLimit &limit) noexcept(false) {
+  queue.setLimit(limit);
+}
+
+///
+///\brief Set the handler of events dropped by the queue limit. Queues without limit support
+/// (i.e. eventpp::EventQueue) never drop events.
+///
+///\tparam QueueT the queue type
+///\tparam HandlerT the handler type
+///
+template <typename QueueT, typename HandlerT>
+void setDropHandler(QueueT &, HandlerT &&) noexcept(true) {}
+
+///
+///\brief Set the handler of events dropped by the queue limit of a RingBufferEventQueue
+///
+///\param queue the queue
+///\param handler the handler (id, event)
+///
+template <typename IdT, typename EventPtrT>
+void setDropHandler(RingBufferEventQueue<IdT, EventPtrT> &queue,
+                    std::function<void(IdT, EventPtrT &)> handler) noexcept(true) {
+  queue.setDropHandler(std::move(handler));
+}
+
+///
+///\brief Queue policy selecting the (mutex protected, allocating) eventpp::EventQueue
+///
+struct EventppQueuePolicy {
+  template <typename IdT, typename EventPtrT>
+  using Queue = eventpp::EventQueue<IdT, void(EventPtrT)>;
+};
+
+///
+///\brief Queue policy selecting the lock-free RingBufferEventQueue
+///
+struct RingBufferQueuePolicy {
+  template <typename IdT, typename EventPtrT> using Queue = RingBufferEventQueue<IdT, EventPtrT>;
+};
+
+#ifdef LIBVDA5050PP_USE_EVENTPP_QUEUE
+using DefaultQueuePolicy = EventppQueuePolicy;
+#else
+using DefaultQueuePolicy = RingBufferQueuePolicy;
+#endif
+
+}  // namespace vda5050pp::core::common
+
+#endif  // VDA5050_2B_2B_CORE_COMMON_EVENT_QUEUE_POLICY_H_
@@ -0,0 +1,159 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+//
+// This file contains the per event id latency and throughput recording of the event managers
+//
+
+#ifndef VDA5050_2B_2B_CORE_COMMON_EVENT_STATISTICS_H_
+#define VDA5050_2B_2B_CORE_COMMON_EVENT_STATISTICS_H_
+
+#include <eventpp/callbacklist.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "vda5050++/config/event_manager_options.h"
+#include "vda5050++/misc/latency_histogram.h"
+#include "vda5050++/observer/event_observer.h"
+
+namespace vda5050pp::core::common {
+
+///
+///\brief A thread-safe (lock-free) recorder for a vda5050pp::misc::LatencyHistogram.
+///
+class AtomicLatencyHistogram {
+private:
+  std::array<std::atomic<uint64_t>, vda5050pp::misc::LatencyHistogram::k_buckets> counts_{};
+  std::atomic<uint64_t> min_ = UINT64_MAX;
+  std::atomic<uint64_t> max_ = 0;
+  std::atomic<uint64_t> sum_ = 0;
+
+public:
+  ///
+  ///\brief Record a single value
+  ///
+  ///\param value the value (negative values are recorded as 0)
+  ///
+  void record(std::chrono::nanoseconds value) noexcept(true);
+
+  ///
+  ///\brief Get a snapshot of the recorded values
+  ///
+  ///\return vda5050pp::misc::LatencyHistogram the snapshot
+  ///
+  vda5050pp::misc::LatencyHistogram snapshot() const noexcept(false);
+};
+
+///
+///\brief Records the queue wait, handler duration and counters per event id of an event manager.
+///
+/// The per id data is allocated on the first event of that id. Ids >= k_max_event_ids are
+/// not recorded.
+///
+class EventStatisticsRecorder {
+public:
+  static constexpr std::size_t k_max_event_ids = 64;
+
+  using OverflowCallbackList =
+      eventpp::CallbackList<void(const vda5050pp::observer::QueueOverflow &)>;
+
+private:
+  struct Slot {
+    std::atomic<uint64_t> enqueued = 0;
+    std::atomic<uint64_t> processed = 0;
+    std::atomic<uint64_t> dropped = 0;
+    std::atomic<uint64_t> blocked = 0;
+    std::atomic<uint64_t> overrun = 0;
+    AtomicLatencyHistogram queue_wait;
+    AtomicLatencyHistogram handler_duration;
+  };
+
+  std::string manager_name_;
+  std::array<std::atomic<Slot *>, k_max_event_ids> slots_{};
+  mutable OverflowCallbackList overflow_callbacks_;
+
+  Slot *slot(std::size_t id) noexcept(true);
+
+public:
+  ///
+  ///\brief Construct a new EventStatisticsRecorder
+  ///
+  ///\param manager_name the name of the recorded manager
+  ///
+  explicit EventStatisticsRecorder(std::string_view manager_name);
+
+  ~EventStatisticsRecorder() noexcept(true);
+
+  EventStatisticsRecorder(const EventStatisticsRecorder &) = delete;
+  EventStatisticsRecorder(EventStatisticsRecorder &&) = delete;
+  EventStatisticsRecorder &operator=(const EventStatisticsRecorder &) = delete;
+  EventStatisticsRecorder &operator=(EventStatisticsRecorder &&) = delete;
+
+  ///
+  ///\brief Record an enqueued event
+  ///
+  ///\param id the event id
+  ///
+  void recordEnqueue(std::size_t id) noexcept(true);
+
+  ///
+  ///\brief Record a processed event
+  ///
+  ///\param id the event id
+  ///\param queue_wait the time between enqueueing and the start of the dispatch
+  ///\param handler_duration the time all subscribers took to handle the event
+  ///
+  void recordProcessed(std::size_t id, std::chrono::nanoseconds queue_wait,
+                       std::chrono::nanoseconds handler_duration) noexcept(true);
+
+  ///
+  ///\brief Record a queue overflow, log a warning and notify the overflow callbacks
+  ///
+  ///\param id the id of the dropped or blocked event
+  ///\param policy the applied policy
+  ///
+  void recordOverflow(std::size_t id,
+                      vda5050pp::config::QueueOverflowPolicy policy) noexcept(true);
+
+  ///
+  ///\brief Record an event, which exceeded the capacity of a full k_block queue (it was
+  /// enqueued by an event worker, which must not wait) and log a warning
+  ///
+  ///\param id the id of the event
+  ///
+  void recordOverrun(std::size_t id) noexcept(true);
+
+  ///
+  ///\brief Get the callbacks, which are notified about queue overflows
+  ///
+  ///\return OverflowCallbackList& the callbacks (thread-safe)
+  ///
+  OverflowCallbackList &overflowCallbacks() const noexcept(true);
+
+  ///
+  ///\brief Get the name of the recorded manager
+  ///
+  ///\return std::string_view the name
+  ///
+  std::string_view getManagerName() const noexcept(true);
+
+  ///
+  ///\brief Get a snapshot of all recorded event ids
+  ///
+  ///\return std::vector<vda5050pp::observer::EventStatistics> the statistics
+  ///
+  std::vector<vda5050pp::observer::EventStatistics> snapshot() const noexcept(false);
+};
+
+}  // namespace vda5050pp::core::common
+
+#endif  // VDA5050_2B_2B_CORE_COMMON_EVENT_STATISTICS_H_
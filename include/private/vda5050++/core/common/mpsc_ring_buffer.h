@@ -0,0 +1,165 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+//
+// This file contains a bounded lock-free multi-producer single-consumer ring buffer
+//
+
+#ifndef VDA5050_2B_2B_CORE_COMMON_MPSC_RING_BUFFER_H_
+#define VDA5050_2B_2B_CORE_COMMON_MPSC_RING_BUFFER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace vda5050pp::core::common {
+
+///
+///\brief A bounded lock-free multi-producer single-consumer ring buffer.
+///
+/// Each cell carries a sequence number, which tells producers and the consumer, whether the cell
+/// is free or published (D. Vyukov's bounded queue). Producers only contend on a single atomic
+/// counter, the consumer does not need any read-modify-write operation at all.
+///
+/// tryPop() must only be called by one thread at a time.
+///
+///\tparam T the value type (must be default constructible and move assignable)
+///
+template <typename T> class MpscRingBuffer {
+private:
+  static constexpr std::size_t k_cache_line = 64;
+
+  struct Cell {
+    std::atomic<std::size_t> sequence;
+    T value;
+  };
+
+  std::size_t mask_;
+  std::unique_ptr<Cell[]> cells_;
+  alignas(k_cache_line) std::atomic<std::size_t> enqueue_pos_ = 0;
+  alignas(k_cache_line) std::size_t dequeue_pos_ = 0;
+
+  static std::size_t roundUpPow2(std::size_t n) noexcept(true) {
+    std::size_t ret = 2;
+    while (ret < n) {
+      ret <<= 1;
+    }
+    return ret;
+  }
+
+  static std::intptr_t distance(std::size_t a, std::size_t b) noexcept(true) {
+    return static_cast<std::intptr_t>(a - b);
+  }
+
+public:
+  ///
+  ///\brief Construct a new MpscRingBuffer
+  ///
+  ///\param capacity the minimum capacity (rounded up to the next power of two)
+  ///
+  explicit MpscRingBuffer(std::size_t capacity)
+      : mask_(roundUpPow2(capacity) - 1), cells_(std::make_unique<Cell[]>(mask_ + 1)) {
+    for (std::size_t i = 0; i <= this->mask_; i++) {
+      this->cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  MpscRingBuffer(const MpscRingBuffer &) = delete;
+  MpscRingBuffer(MpscRingBuffer &&) = delete;
+  MpscRingBuffer &operator=(const MpscRingBuffer &) = delete;
+  MpscRingBuffer &operator=(MpscRingBuffer &&) = delete;
+
+  ///
+  ///\brief Try to push a value (thread-safe, lock-free)
+  ///
+  ///\param value the value to push (only moved from on success)
+  ///\return true value was pushed \n
+  ///        false the buffer is full
+  ///
+  bool tryPush(T &&value) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    Cell *cell;
+    std::size_t pos = this->enqueue_pos_.load(std::memory_order_relaxed);
+
+    for (;;) {
+      cell = &this->cells_[pos & this->mask_];
+      auto diff = distance(cell->sequence.load(std::memory_order_acquire), pos);
+
+      if (diff == 0) {
+        if (this->enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = this->enqueue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+
+    cell->value = std::move(value);
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  ///
+  ///\brief Try to pop the next value (single consumer only)
+  ///
+  /// A value, which is currently being written by a producer, is not yet visible.
+  ///
+  ///\return std::optional<T> the value if available, otherwise std::nullopt
+  ///
+  std::optional<T> tryPop() noexcept(std::is_nothrow_move_constructible_v<T>) {
+    auto &cell = this->cells_[this->dequeue_pos_ & this->mask_];
+    auto diff =
+        distance(cell.sequence.load(std::memory_order_acquire), this->dequeue_pos_ + 1);
+
+    if (diff < 0) {
+      return std::nullopt;
+    }
+
+    std::optional<T> ret(std::move(cell.value));
+    cell.value = T();
+    cell.sequence.store(this->dequeue_pos_ + this->mask_ + 1, std::memory_order_release);
+    this->dequeue_pos_++;
+    return ret;
+  }
+
+  ///
+  ///\brief Find the newest published value, which matches a predicate (single consumer only)
+  ///
+  /// Producers never write to published cells, so the value may be modified by the consumer.
+  /// Values, which are currently being written by a producer, are skipped.
+  ///
+  ///\tparam PredT the predicate type (bool(const T &))
+  ///\param pred the predicate
+  ///\return T* the newest matching value or nullptr
+  ///
+  template <typename PredT> T *findNewest(PredT &&pred) noexcept(false) {
+    auto pos = this->enqueue_pos_.load(std::memory_order_acquire);
+    while (pos != this->dequeue_pos_) {
+      pos--;
+      auto &cell = this->cells_[pos & this->mask_];
+      if (cell.sequence.load(std::memory_order_acquire) == pos + 1 && pred(cell.value)) {
+        return &cell.value;
+      }
+    }
+    return nullptr;
+  }
+
+  ///
+  ///\brief Get the capacity of the buffer
+  ///
+  ///\return std::size_t the capacity
+  ///
+  std::size_t capacity() const noexcept(true) { return this->mask_ + 1; }
+};
+
+}  // namespace vda5050pp::core::common
+
+#endif  // VDA5050_2B_2B_CORE_COMMON_MPSC_RING_BUFFER_H_
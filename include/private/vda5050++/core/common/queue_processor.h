@@ -0,0 +1,68 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+//
+// This file contains the QueueProcessor, which runs the event processing of an event manager
+//
+
+#ifndef VDA5050_2B_2B_CORE_COMMON_QUEUE_PROCESSOR_H_
+#define VDA5050_2B_2B_CORE_COMMON_QUEUE_PROCESSOR_H_
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <optional>
+
+#include "vda5050++/config/event_manager_options.h"
+#include "vda5050++/core/common/worker_pool.h"
+#include "vda5050++/core/instance_scope.h"
+
+namespace vda5050pp::core::common {
+
+///
+///\brief The QueueProcessor schedules processing passes of an event queue on a Strand.
+///
+/// Each event manager owns one QueueProcessor, so the events of a manager are processed in order,
+/// while the workers are shared between all managers of a WorkerPool. Notifications, which arrive
+/// before a scheduled pass started, are merged into that pass.
+///
+/// Passes are only scheduled by notify(), there is no polling. An idle manager does not use any
+/// CPU and an enqueued event is processed as soon as a worker of the strand is free.
+///
+class QueueProcessor final {
+private:
+  std::function<void()> process_fn_;
+  std::atomic_bool scheduled_ = false;
+  Instance *instance_ = nullptr;
+  std::optional<Strand> strand_;  // Must be destroyed first (waits for the running pass)
+
+public:
+  ///
+  ///\brief Construct a new QueueProcessor.
+  ///
+  /// - With synchronous_event_dispatch, there is no processing at all (notify() is a no-op).
+  /// - With a shared_pool, the processing passes run on it.
+  /// - Otherwise the QueueProcessor starts it's own single worker.
+  ///
+  ///\param process_fn the function processing all currently enqueued events
+  ///\param opts the EventManagerOptions of the owning manager
+  ///\param shared_pool the WorkerPool shared between managers (may be nullptr)
+  ///\param instance the Instance bound during each pass (may be nullptr)
+  ///
+  QueueProcessor(std::function<void()> &&process_fn,
+                 const vda5050pp::config::EventManagerOptions &opts,
+                 std::shared_ptr<WorkerPool> shared_pool,
+                 Instance *instance = nullptr) noexcept(false);
+
+  ///
+  ///\brief Schedule a processing pass (call after each enqueue).
+  ///
+  void notify() noexcept(false);
+};
+
+}  // namespace vda5050pp::core::common
+
+#endif  // VDA5050_2B_2B_CORE_COMMON_QUEUE_PROCESSOR_H_
@@ -0,0 +1,142 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+//
+// This file contains the WorkerPool and the Strand executor
+//
+
+#ifndef VDA5050_2B_2B_CORE_COMMON_WORKER_POOL_H_
+#define VDA5050_2B_2B_CORE_COMMON_WORKER_POOL_H_
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "vda5050++/core/common/scoped_thread.h"
+
+namespace vda5050pp::core::common {
+
+///
+///\brief A fixed-size pool of worker threads, which execute posted tasks in FIFO order.
+///
+/// There is no ordering guarantee between tasks running on different workers. Use a Strand
+/// on top of the pool to serialize a group of tasks.
+///
+class WorkerPool final {
+private:
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<std::function<void()>> tasks_;
+  bool stop_ = false;
+  std::list<ScopedThread<void()>> workers_;
+
+  void workerTask(StopToken tkn) noexcept(true);
+
+public:
+  ///
+  ///\brief Construct a new WorkerPool and start all workers
+  ///
+  ///\param size the number of worker threads (at least one worker is started)
+  ///
+  explicit WorkerPool(std::size_t size);
+
+  ///
+  ///\brief Stop and join all workers. Pending tasks are discarded.
+  ///
+  ~WorkerPool() noexcept(true);
+
+  WorkerPool(const WorkerPool &) = delete;
+  WorkerPool(WorkerPool &&) = delete;
+  WorkerPool &operator=(const WorkerPool &) = delete;
+  WorkerPool &operator=(WorkerPool &&) = delete;
+
+  ///
+  ///\brief Post a task to the pool. Tasks posted after the pool began stopping are discarded.
+  ///
+  ///\param task the task to run on one of the workers
+  ///
+  void post(std::function<void()> &&task) noexcept(false);
+
+  ///
+  ///\brief Get the number of workers
+  ///
+  ///\return std::size_t number of workers
+  ///
+  std::size_t size() const noexcept(true);
+};
+
+///
+///\brief Call fn(i) for each i in [0, count) on the calling thread and on up to helpers workers
+/// of the pool, and return after all calls returned.
+///
+/// The calling thread takes part, so this never waits for a free worker (also not, if it is a
+/// worker of the same pool itself). The order of the calls is unspecified.
+///
+///\param pool the pool to run the helpers on
+///\param count the number of calls
+///\param helpers the maximum number of workers helping the calling thread
+///\param fn the function to call
+///\throws the first exception thrown by fn (after all calls returned)
+///
+void parallelFor(WorkerPool &pool, std::size_t count, std::size_t helpers,
+                 const std::function<void(std::size_t)> &fn) noexcept(false);
+
+///
+///\brief A Strand serializes all tasks posted to it on a (shared) WorkerPool.
+///
+/// Tasks of the same Strand never run concurrently and are executed in posting order, while
+/// different Strands may run in parallel on different workers. A Strand only occupies a worker
+/// while it has pending tasks.
+///
+class Strand final {
+private:
+  struct State {
+    std::mutex mutex;
+    std::condition_variable idle_cv;
+    std::deque<std::function<void()>> tasks;
+    bool scheduled = false;
+    bool closed = false;
+    std::thread::id running_on;
+  };
+
+  std::shared_ptr<WorkerPool> pool_;
+  std::shared_ptr<State> state_;
+
+  static void run(const std::shared_ptr<State> &state) noexcept(true);
+
+public:
+  ///
+  ///\brief Construct a new Strand on top of a pool
+  ///
+  ///\param pool the pool to run the tasks on (must not be nullptr)
+  ///
+  explicit Strand(std::shared_ptr<WorkerPool> pool) noexcept(false);
+
+  ///
+  ///\brief Discard pending tasks and wait for the currently running task (if any) to return.
+  ///
+  ~Strand() noexcept(true);
+
+  Strand(const Strand &) = delete;
+  Strand(Strand &&) = delete;
+  Strand &operator=(const Strand &) = delete;
+  Strand &operator=(Strand &&) = delete;
+
+  ///
+  ///\brief Post a task, which will run after all previously posted tasks of this Strand.
+  ///
+  ///\param task the task to run
+  ///
+  void post(std::function<void()> &&task) noexcept(false);
+};
+
+}  // namespace vda5050pp::core::common
+
+#endif  // VDA5050_2B_2B_CORE_COMMON_WORKER_POOL_H_
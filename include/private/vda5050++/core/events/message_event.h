@@ -8,8 +8,10 @@
 #ifndef VDA5050_2B_2B_CORE_EVENTS_MESSAGE_EVENT_H_
 #define VDA5050_2B_2B_CORE_EVENTS_MESSAGE_EVENT_H_
 
+#include <chrono>
 #include <memory>
 
+#include "vda5050++/core/state/state_revisions.h"
 #include "vda5050++/events/event_type.h"
 #include "vda5050++/misc/connection_status.h"
 #include "vda5050++/misc/message_error.h"
@@ -59,17 +61,27 @@ struct ValidInstantActionMessageEvent
 struct SendFactsheetMessageEvent
     : public vda5050pp::events::EventId<MessageEvent, MessageEventType::k_send_factsheet_message> {
   std::shared_ptr<vda5050::AgvFactsheet> factsheet;
+  /// The creation time, the publish latency is measured from
+  std::chrono::steady_clock::time_point created = std::chrono::steady_clock::now();
 };
 
 struct SendStateMessageEvent
     : public vda5050pp::events::EventId<MessageEvent, MessageEventType::k_send_state_message> {
   std::shared_ptr<vda5050::State> state;
+  /// The number of (coalesced) state update requests published with this state
+  uint32_t merged_update_requests = 0;
+  /// The revisions of the state parts, used to reuse their encoding (0 if unknown)
+  vda5050pp::core::state::StateRevisions revisions;
+  /// The creation time, the publish latency is measured from
+  std::chrono::steady_clock::time_point created = std::chrono::steady_clock::now();
 };
 
 struct SendVisualizationMessageEvent
     : public vda5050pp::events::EventId<MessageEvent,
                                         MessageEventType::k_send_visualization_message> {
   std::shared_ptr<vda5050::Visualization> visualization;
+  /// The creation time, the publish latency is measured from
+  std::chrono::steady_clock::time_point created = std::chrono::steady_clock::now();
 };
 
 struct ConnectionChangedEvent
@@ -8,62 +8,115 @@
 #ifndef PRIVATE_VDA5050_2B_2B_CORE_GENERIC_EVENT_MANAGER_H_
 #define PRIVATE_VDA5050_2B_2B_CORE_GENERIC_EVENT_MANAGER_H_
 
-#include <eventpp/eventqueue.h>
 #include <eventpp/utilities/argumentadapter.h>
 #include <eventpp/utilities/scopedremover.h>
 
 #include "vda5050++/config/event_manager_options.h"
+#include "vda5050++/core/common/event_processing.h"
+#include "vda5050++/core/common/event_queue_policy.h"
+#include "vda5050++/core/common/event_statistics.h"
 #include "vda5050++/core/common/formatters.h"
-#include "vda5050++/core/common/scoped_thread.h"
+#include "vda5050++/core/common/queue_processor.h"
 #include "vda5050++/core/common/type_traits.h"
 #include "vda5050++/core/logger.h"
 #include "vda5050++/events/event_type.h"
 
 namespace vda5050pp::core {
 
-/// @brief The GenericEventManager is a threaded dispatch/subscribe wrapper around the eventpp queue
+/// @brief The priority (lane) of an asynchronously dispatched event
+enum class EventPriority {
+  /// @brief Safety relevant control events (i.e. cancel, pause), processed before all others.
+  /// Only for events acting on the current state, never for events, which may refer to events
+  /// still pending in the normal lane (i.e. received InstantActions may refer to queued orders)
+  k_control,
+  /// @brief Regular events
+  k_normal,
+  /// @brief Bulk traffic (i.e. periodic messages), processed if there is nothing else to do, but
+  /// at least once per GenericEventManager::k_bulk_share normal events
+  k_bulk,
+};
+
+/// @brief The GenericEventManager is a threaded dispatch/subscribe wrapper around an event queue
 /// @tparam EventType the managed event type (must derive from vda5050pp::events::Event)
-template <typename EventType> class GenericEventManager {
+/// @tparam QueuePolicy the policy selecting the event queue implementation
+template <typename EventType, typename QueuePolicy = common::DefaultQueuePolicy>
+class GenericEventManager {
 private:
   static_assert(std::is_base_of_v<vda5050pp::events::EventBase, EventType>,
                 "EventType must be derived from vda5050pp::events::Event");
 
-  using EventQueueType =
-      eventpp::EventQueue<typename EventType::EventIdType, void(std::shared_ptr<EventType>)>;
+  using EventQueueType = typename QueuePolicy::template Queue<typename EventType::EventIdType,
+                                                               std::shared_ptr<EventType>>;
 
-  EventQueueType event_queue_;
-  const vda5050pp::config::EventManagerOptions &opts_;
-  vda5050pp::core::common::ScopedThread<void()> thread_;
+  using EventLaneType =
+      common::EventLane<typename EventType::EventIdType, std::shared_ptr<EventType>>;
 
-  void threadTask(vda5050pp::core::common::StopToken tkn) {
-    if (this->opts_.synchronous_event_dispatch) {
-      // This event loop is not needed
-      return;
+  common::EventStatisticsRecorder statistics_recorder_;  // Must outlive the queue and lanes
+  EventQueueType event_queue_;                           // Dispatcher and the k_normal lane
+  EventLaneType control_lane_;
+  EventLaneType bulk_lane_;
+  const vda5050pp::config::EventManagerOptions &opts_;
+  vda5050pp::core::common::QueueProcessor processor_;
+  // Normal events processed since the last bulk event (only used by the processing strand)
+  std::size_t normal_streak_ = 0;
+
+  /// @brief Process all control events and the next normal (or bulk) event
+  /// @return true if a normal or bulk event was processed
+  bool processNext() {
+    this->control_lane_.process(this->event_queue_);
+    // Bulk events (i.e. the state heartbeat) must not starve under steady normal load
+    if (this->normal_streak_ >= k_bulk_share && this->bulk_lane_.processOne(this->event_queue_)) {
+      this->normal_streak_ = 0;
+      return true;
     }
+    if (this->event_queue_.processOne()) {
+      this->normal_streak_++;
+      return true;
+    }
+    this->normal_streak_ = 0;
+    return this->bulk_lane_.processOne(this->event_queue_);
+  }
 
-    using namespace std::chrono_literals;
-    try {
-      while (!tkn.stopRequested()) {
-        if (this->event_queue_.processUntil([&tkn] { return tkn.stopRequested(); })) {
-          // no pause
-        } else {
-          std::this_thread::sleep_for(10ms);
-        }
-      }
-    } catch (const vda5050pp::VDA5050PPError &err) {
-      static const std::type_info &info = typeid(GenericEventManager<EventType>);
-      getEventsLogger()->error("{} caught an exception, while processing events:\n {}",
-                               common::demangle(info.name()), err);
-      // TODO: Handle critical exceptions
+  static std::string managerName() {
+    // i.e. vda5050pp::core::events::MessageEvent -> MessageEventManager
+    auto name = common::demangle(typeid(EventType).name());
+    if (auto pos = name.rfind("::"); pos != std::string::npos) {
+      name = name.substr(pos + 2);
     }
+    return name + "Manager";
+  }
+
+  void processQueue() {
+    static const std::string name = common::demangle(
+        typeid(GenericEventManager<EventType, QueuePolicy>).name());
+    common::processEvents([this] { return this->processNext(); }, name);
   }
 
 public:
-  /// @brief Construct a new GenericEventManager. Manages one thread during lifetime
-  explicit GenericEventManager(const vda5050pp::config::EventManagerOptions &opts)
-      : opts_(opts),
-        thread_(std::bind(std::mem_fn(&GenericEventManager<EventType>::threadTask), this,
-                          std::placeholders::_1)) {}
+  /// @brief A pending bulk event is processed after at most this many normal events
+  static constexpr std::size_t k_bulk_share = 8;
+
+  /// @brief Construct a new GenericEventManager. The events are processed on a strand of the
+  /// worker_pool, or on an own worker, if there is no worker_pool.
+  /// @param opts the EventManagerOptions
+  /// @param worker_pool the WorkerPool shared between event managers (may be nullptr)
+  /// @param instance the Instance bound while processing events (may be nullptr)
+  explicit GenericEventManager(
+      const vda5050pp::config::EventManagerOptions &opts,
+      std::shared_ptr<vda5050pp::core::common::WorkerPool> worker_pool = nullptr,
+      Instance *instance = nullptr)
+      : statistics_recorder_(managerName()),
+        opts_(opts),
+        processor_([this] { this->processQueue(); }, opts, worker_pool, instance) {
+    common::setStatisticsRecorder(this->event_queue_, &this->statistics_recorder_);
+    this->control_lane_.setStatisticsRecorder(&this->statistics_recorder_);
+    this->bulk_lane_.setStatisticsRecorder(&this->statistics_recorder_);
+
+    // Control events are never limited
+    const auto &limit = opts.getQueueLimit(this->statistics_recorder_.getManagerName());
+    common::setQueueLimit(this->event_queue_, limit);
+    this->bulk_lane_.setLimit(limit);
+  }
 
   /// @brief The ScopedSubscriber is an RAII base subscriber, which releases callbacks upon
   /// deconstruction
@@ -71,7 +124,7 @@ public:
   private:
     eventpp::ScopedRemover<EventQueueType> remover_;
 
-    friend class GenericEventManager<EventType>;
+    friend class GenericEventManager<EventType, QueuePolicy>;
 
     explicit ScopedSubscriber(EventQueueType &event_queue) : remover_(event_queue) {}
 
@@ -90,16 +143,31 @@ public:
     }
   };
 
-  /// @brief Enqueue an event into the underlying eventpp queue (async, depending on this->opts_)
+  /// @brief Enqueue an event into the underlying event queue (async, depending on this->opts_)
   /// @param event the event to dispatch
-  void dispatch(std::shared_ptr<EventType> event) {
+  /// @param priority the lane of the event. Control events are processed before all pending
+  /// normal and bulk events. (Ignored for synchronous dispatch)
+  void dispatch(std::shared_ptr<EventType> event,
+                EventPriority priority = EventPriority::k_normal) {
     getEventsLogger()->debug("Dispatching {} event with specialized ID={}",
                              common::demangle(typeid(*event).name()), int(event->getId()));
     if (this->opts_.synchronous_event_dispatch) {
       this->event_queue_.dispatch(event->getId(), event);
-    } else {
-      this->event_queue_.enqueue(event->getId(), event);
+      return;
     }
+
+    switch (priority) {
+      case EventPriority::k_control:
+        this->control_lane_.enqueue(event->getId(), event);
+        break;
+      case EventPriority::k_bulk:
+        this->bulk_lane_.enqueue(event->getId(), event);
+        break;
+      default:
+        this->event_queue_.enqueue(event->getId(), event);
+        break;
+    }
+    this->processor_.notify();
   }
 
   /// @brief Synchronously dispatch an event (with the calling thread)
@@ -113,6 +181,12 @@ public:
   /// @brief Get a new ScopedSubscriber associated with this Manager
   /// @return the new ScopedSubscriber
   ScopedSubscriber getScopedSubscriber() { return ScopedSubscriber(this->event_queue_); }
+
+  /// @brief Get the latency and throughput statistics of this manager
+  /// @return the statistics recorder
+  const common::EventStatisticsRecorder &getStatisticsRecorder() const {
+    return this->statistics_recorder_;
+  }
 };
 
 }  // namespace vda5050pp::core
@@ -8,15 +8,23 @@
 #ifndef PRIVATE_VDA5050_2B_2B_CORE_INSTANCE_H_
 #define PRIVATE_VDA5050_2B_2B_CORE_INSTANCE_H_
 
+#include <atomic>
+#include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <set>
 #include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "vda5050++/config.h"
 #include "vda5050++/core/action_event_manager.h"
 #include "vda5050++/core/action_status_manager.h"
+#include "vda5050++/core/common/coroutine.h"
+#include "vda5050++/core/common/worker_pool.h"
 #include "vda5050++/core/events/control_event.h"
 #include "vda5050++/core/events/factsheet_event.h"
 #include "vda5050++/core/events/interpreter_event.h"
@@ -25,6 +33,7 @@
 #include "vda5050++/core/events/state_event.h"
 #include "vda5050++/core/events/validation_event.h"
 #include "vda5050++/core/generic_event_manager.h"
+#include "vda5050++/core/instance_scope.h"
 #include "vda5050++/core/navigation_event_manager.h"
 #include "vda5050++/core/navigation_status_manager.h"
 #include "vda5050++/core/query_event_manager.h"
@@ -55,13 +64,42 @@ static constexpr std::string_view k_visualization_timer_key = "VisualizationTime
 
 class Module;
 
-class Instance {
+///
+///\brief The Instance owns the state, the event managers and the modules of one AGV.
+///
+/// There is a process wide default instance (init(), get(), reset()). Further independent
+/// instances can be created with create(). Threads working on behalf of an instance bind it with
+/// an InstanceScope, such that get() and ref() return the bound instance on these threads.
+/// Only the loggers are shared between all instances.
+///
+class Instance : public std::enable_shared_from_this<Instance> {
+public:
+  using ModuleFactory = std::function<std::shared_ptr<vda5050pp::core::Module>()>;
+
 private:
   static std::shared_ptr<Instance> instance_;
   static std::shared_mutex instance_mutex_;
 
+  struct ModuleRegistration {
+    ModuleFactory factory;
+    // Generates the default sub config of the module
+    std::shared_ptr<vda5050pp::core::Module> prototype;
+    // Registered with registerModule(), the single object is only used by the default instance
+    bool default_instance_only = false;
+  };
+  static std::map<std::string, ModuleRegistration, std::less<>> module_registrations_;
+  static std::shared_mutex module_registrations_mutex_;
+
   vda5050pp::Config config_;
 
+  // Shared by all event managers, must be constructed before them (nullptr if not used)
+  std::shared_ptr<common::WorkerPool> worker_pool_;
+
+#ifdef LIBVDA5050PP_COROUTINES
+  // Resumes the coroutines of the event handlers on the worker pool (or an own worker)
+  common::CoroutineExecutor coroutine_executor_{this->worker_pool_, this};
+#endif
+
   ActionEventManager action_event_manager_;
   ActionStatusManager action_status_manager_;
   NavigationEventManager navigation_event_manager_;
@@ -76,10 +114,17 @@ private:
   GenericEventManager<vda5050pp::core::events::StateEvent> state_event_manager_;
   GenericEventManager<vda5050pp::core::events::ValidationEvent> validation_event_manager_;
 
-  static std::map<std::string, std::shared_ptr<vda5050pp::core::Module>, std::less<>> modules_;
-  static std::shared_mutex modules_mutex_;
+  // Destroyed before the event managers, modules may still hold subscribers
+  std::map<std::string, std::shared_ptr<vda5050pp::core::Module>, std::less<>> modules_;
+  mutable std::shared_mutex modules_mutex_;
+  std::atomic_bool initialized_ = false;
 
   std::set<std::shared_ptr<vda5050pp::handler::BaseActionHandler>> action_handler_;
+  // actionType -> first registered handler, which published it
+  std::unordered_map<std::string, std::shared_ptr<vda5050pp::handler::BaseActionHandler>>
+      indexed_action_handler_;
+  // Handlers without published action types, in order of registration (matched with match())
+  std::vector<std::shared_ptr<vda5050pp::handler::BaseActionHandler>> dynamic_action_handler_;
   std::shared_ptr<vda5050pp::handler::BaseNavigationHandler> navigation_handler_;
   std::shared_ptr<vda5050pp::handler::BaseQueryHandler> query_handler_;
 
@@ -87,7 +132,13 @@ private:
   vda5050pp::core::state::StatusManager status_manager_;
 
 protected:
-  explicit Instance(const vda5050pp::Config &config);
+  ///
+  ///\brief Construct a new Instance with all registered modules.
+  ///
+  ///\param config the config
+  ///\param is_default is this the default instance (it also uses the modules of registerModule())
+  ///
+  Instance(const vda5050pp::Config &config, bool is_default);
 
   void initializeComponents();
   void deInitializeComponents();
@@ -95,20 +146,104 @@ protected:
 public:
   virtual ~Instance() = default;
 
+  ///
+  ///\brief Create and initialize the default instance (replaces the current one).
+  ///
+  ///\param config the configuration
+  ///\return std::weak_ptr<Instance> the default instance
+  ///
   static std::weak_ptr<Instance> init(const vda5050pp::Config &config) noexcept(true);
 
+  ///
+  ///\brief Create and initialize an independent instance with own modules, event managers and
+  /// state. It is not the default instance, bind it with an InstanceScope to use it on a thread.
+  /// The instance is de-initialized, when the last reference is released.
+  ///
+  ///\param config the configuration
+  ///\return std::shared_ptr<Instance> the new instance
+  ///
+  static std::shared_ptr<Instance> create(const vda5050pp::Config &config) noexcept(false);
+
+  ///
+  ///\brief Get the instance bound to the calling thread, or the default instance.
+  ///
+  ///\return std::weak_ptr<Instance>
+  ///
   static std::weak_ptr<Instance> get() noexcept(true);
 
+  ///
+  ///\brief Get the instance bound to the calling thread, or the default instance.
+  ///
+  ///\return Instance&
+  ///\throws VDA5050PPNotInitialized if there is no instance
+  ///
   static Instance &ref() noexcept(false);
 
+  ///
+  ///\brief Get the instance bound to the calling thread. Objects, which capture it at
+  /// construction, keep working on that instance on other threads (see resolve()).
+  ///
+  ///\return std::weak_ptr<Instance> the bound instance, empty if there is no binding
+  ///
+  static std::weak_ptr<Instance> threadBinding() noexcept(true);
+
+  ///
+  ///\brief Resolve an instance captured with threadBinding().
+  ///
+  ///\param binding the captured binding
+  ///\return std::shared_ptr<Instance> the captured instance or get(), if there was no binding
+  ///\throws VDA5050PPNotInitialized if the instance does not exist (anymore)
+  ///
+  static std::shared_ptr<Instance> resolve(const std::weak_ptr<Instance> &binding) noexcept(false);
+
   static void reset() noexcept(true);
 
+  ///
+  ///\brief De-initialize all modules of this instance. Can be called multiple times.
+  ///
+  void deinitialize() noexcept(true);
+
+  ///
+  ///\brief Register a module factory. Each instance created afterwards constructs its own module.
+  ///
+  ///\param key the module key
+  ///\param factory the factory
+  ///\throws VDA5050PPInvalidArgument if the key is already registered
+  ///
+  static void registerModuleFactory(std::string_view key, ModuleFactory factory) noexcept(false);
+
+  ///
+  ///\brief Register a module object and initialize it with the current instance. The object is
+  /// only used by the default instance (init()), instances of create() do not have this module.
+  /// Use registerModuleFactory() with multiple instances.
+  ///
+  ///\param key the module key
+  ///\param module_ptr the module
+  ///
   static void registerModule(std::string_view key,
                              std::shared_ptr<vda5050pp::core::Module> module_ptr) noexcept(false);
 
   static void unregisterModule(std::string_view key) noexcept(false);
 
+  ///
+  ///\brief Lookup a module of the current instance (see get()).
+  ///
+  ///\param key the module key
+  ///\return std::weak_ptr<vda5050pp::core::Module> the module
+  ///\throws VDA5050PPNotInitialized if there is no instance
+  ///\throws VDA5050PPInvalidArgument if the module is not registered
+  ///
   static std::weak_ptr<vda5050pp::core::Module> lookupModule(std::string_view key) noexcept(false);
+
+  ///
+  ///\brief Get a module of this instance.
+  ///
+  ///\param key the module key
+  ///\return std::weak_ptr<vda5050pp::core::Module> the module
+  ///\throws VDA5050PPInvalidArgument if the module is not registered
+  ///
+  std::weak_ptr<vda5050pp::core::Module> getModule(std::string_view key) const noexcept(false);
+
   static std::shared_ptr<vda5050pp::config::ModuleSubConfig> generateConfig(
       std::string_view key) noexcept(false);
   static std::list<std::string_view> registeredModules();
@@ -149,12 +284,48 @@ public:
 
   GenericEventManager<vda5050pp::core::events::StateEvent> &getStateEventManager() noexcept(true);
 
+#ifdef LIBVDA5050PP_COROUTINES
+  common::CoroutineExecutor::Ref getCoroutineExecutor() const noexcept(true);
+#endif
+
+  ///
+  ///\brief Get the worker pool of the event managers.
+  ///
+  ///\return std::shared_ptr<common::WorkerPool> the pool (nullptr, if the event managers use
+  /// own workers or synchronous dispatch)
+  ///
+  std::shared_ptr<common::WorkerPool> getWorkerPool() const noexcept(true);
+
+  ///
+  ///\brief Register an action handler. Its published action types
+  /// (BaseActionHandler::getHandledActionTypes()) are indexed here.
+  ///
+  ///\param action_handler the handler
+  ///
   void addActionHandler(
-      std::shared_ptr<vda5050pp::handler::BaseActionHandler> action_handler) noexcept(true);
+      std::shared_ptr<vda5050pp::handler::BaseActionHandler> action_handler) noexcept(false);
 
   const std::set<std::shared_ptr<vda5050pp::handler::BaseActionHandler>> &getActionHandler() const
       noexcept(true);
 
+  ///
+  ///\brief Get the handler, which published an action type.
+  ///
+  ///\param action_type the action type
+  ///\return std::shared_ptr<vda5050pp::handler::BaseActionHandler> the handler (nullptr if none)
+  ///
+  std::shared_ptr<vda5050pp::handler::BaseActionHandler> getIndexedActionHandler(
+      const std::string &action_type) const noexcept(true);
+
+  ///
+  ///\brief Get all handlers, which did not publish their action types.
+  ///
+  ///\return const std::vector<std::shared_ptr<vda5050pp::handler::BaseActionHandler>>& the
+  /// handlers in order of registration
+  ///
+  const std::vector<std::shared_ptr<vda5050pp::handler::BaseActionHandler>> &
+  getDynamicActionHandler() const noexcept(true);
+
   void setNavigationHandler(
       std::shared_ptr<vda5050pp::handler::BaseNavigationHandler> navigation_handler) noexcept(true);
 
@@ -0,0 +1,59 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+//
+// This file contains the InstanceScope, which binds an Instance to the calling thread
+//
+
+#ifndef VDA5050_2B_2B_CORE_INSTANCE_SCOPE_H_
+#define VDA5050_2B_2B_CORE_INSTANCE_SCOPE_H_
+
+namespace vda5050pp::core {
+
+class Instance;
+
+///
+///\brief Binds an Instance to the calling thread, while the scope exists. Instance::ref() and
+/// Instance::get() return the bound instance instead of the default one.
+///
+/// All threads running on behalf of an Instance (event processing, module threads) bind it, so
+/// several instances can share one process. Scopes can be nested, the previous binding is
+/// restored on destruction. A nullptr instance keeps the current binding.
+///
+class InstanceScope final {
+private:
+  Instance *previous_ = nullptr;
+  bool bound_ = false;
+
+public:
+  ///
+  ///\brief Bind an instance to the calling thread
+  ///
+  ///\param instance the instance (nullptr keeps the current binding)
+  ///
+  explicit InstanceScope(Instance *instance) noexcept(true);
+
+  ///
+  ///\brief Restore the previous binding
+  ///
+  ~InstanceScope() noexcept(true);
+
+  InstanceScope(const InstanceScope &) = delete;
+  InstanceScope(InstanceScope &&) = delete;
+  InstanceScope &operator=(const InstanceScope &) = delete;
+  InstanceScope &operator=(InstanceScope &&) = delete;
+
+  ///
+  ///\brief Get the instance bound to the calling thread
+  ///
+  ///\return Instance* the instance or nullptr, if there is no binding
+  ///
+  static Instance *current() noexcept(true);
+};
+
+}  // namespace vda5050pp::core
+
+#endif  // VDA5050_2B_2B_CORE_INSTANCE_SCOPE_H_
@@ -0,0 +1,82 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+//
+// This file contains the DecodeStage, which decodes received messages in parallel
+//
+
+#ifndef VDA5050_2B_2B_CORE_MESSAGES_DECODE_STAGE_H_
+#define VDA5050_2B_2B_CORE_MESSAGES_DECODE_STAGE_H_
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "vda5050++/core/common/worker_pool.h"
+
+namespace vda5050pp::core::messages {
+
+///
+///\brief The DecodeStage runs decode tasks in parallel on its own WorkerPool, but delivers
+/// their results per lane (i.e. per topic) in the order, in which the tasks were posted.
+///
+/// Each decode task returns a delivery, which is called after the deliveries of all previously
+/// posted tasks of the same lane. Deliveries of one lane never run concurrently, deliveries of
+/// different lanes may.
+///
+class DecodeStage final {
+public:
+  using Delivery = std::function<void()>;
+  using Task = std::function<Delivery()>;
+
+private:
+  struct Lane {
+    std::mutex mutex;
+    uint64_t next_ticket = 0;
+    uint64_t next_delivery = 0;
+    std::map<uint64_t, Delivery> done;
+    bool delivering = false;
+  };
+
+  std::vector<std::shared_ptr<Lane>> lanes_;
+  std::unique_ptr<vda5050pp::core::common::WorkerPool> pool_;
+
+  static void complete(Lane &lane, uint64_t ticket, Delivery &&delivery) noexcept(true);
+
+public:
+  ///
+  ///\brief Construct a new DecodeStage
+  ///
+  ///\param workers the number of decode threads (0 runs each task directly in post())
+  ///\param lanes the number of lanes
+  ///
+  DecodeStage(std::size_t workers, std::size_t lanes) noexcept(false);
+
+  ///
+  ///\brief Stop and join all workers. Pending tasks are discarded.
+  ///
+  ~DecodeStage() noexcept(true);
+
+  DecodeStage(const DecodeStage &) = delete;
+  DecodeStage(DecodeStage &&) = delete;
+  DecodeStage &operator=(const DecodeStage &) = delete;
+  DecodeStage &operator=(DecodeStage &&) = delete;
+
+  ///
+  ///\brief Post a decode task. Returns immediately (unless there are no workers).
+  ///
+  ///\param lane the lane of the task (< number of lanes)
+  ///\param task the decode task, an exception or an empty delivery is skipped in the sequence
+  ///
+  void post(std::size_t lane, Task &&task) noexcept(false);
+};
+
+}  // namespace vda5050pp::core::messages
+
+#endif  // VDA5050_2B_2B_CORE_MESSAGES_DECODE_STAGE_H_
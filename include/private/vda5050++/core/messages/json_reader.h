@@ -0,0 +1,142 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+//
+// This file contains a pull style JSON reader, which decodes values directly from the
+// message payload without building a JSON DOM.
+//
+
+#ifndef VDA5050_2B_2B_CORE_MESSAGES_JSON_READER_H_
+#define VDA5050_2B_2B_CORE_MESSAGES_JSON_READER_H_
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace vda5050pp::core::messages {
+
+///
+///\brief Reads JSON text value by value.
+///
+/// The reader accepts the same (strict RFC 8259) syntax as nlohmann::json::parse, including
+/// UTF-8 validation of strings. All syntax errors throw VDA5050PPJsonError, which contains
+/// the byte offset of the error.
+///
+/// Objects are read with beginObject() followed by nextKey() until it returns false, arrays
+/// with beginArray() followed by nextElement() until it returns false.
+///
+class JsonReader {
+public:
+  enum class ValueType {
+    k_object,
+    k_array,
+    k_string,
+    k_number,
+    k_boolean,
+    k_null,
+  };
+
+private:
+  std::string_view input_;
+  std::size_t pos_ = 0;
+  struct Level {
+    char close;
+    bool first;
+  };
+  std::vector<Level> levels_;
+  std::string key_buffer_;
+
+  char skipWhitespace() noexcept(true);
+  void expect(char c) noexcept(false);
+  void expectLiteral(std::string_view literal) noexcept(false);
+  bool nextMember(char close) noexcept(false);
+  std::string_view scanNumber() noexcept(false);
+  void scanString(std::string *out) noexcept(false);
+  uint32_t scanHex4() noexcept(false);
+
+public:
+  ///
+  ///\brief Construct a new JsonReader
+  ///
+  ///\param input the JSON text (must outlive the reader)
+  ///
+  explicit JsonReader(std::string_view input) noexcept(true);
+
+  ///
+  ///\brief Throw a VDA5050PPJsonError for the current position
+  ///
+  ///\param description the description of the error
+  ///
+  [[noreturn]] void fail(std::string_view description) const noexcept(false);
+
+  ///
+  ///\brief Get the type of the next value (without consuming it)
+  ///
+  ///\return ValueType the type
+  ///
+  ValueType peek() noexcept(false);
+
+  ///
+  ///\brief Get the current byte offset
+  ///
+  ///\return std::size_t the offset
+  ///
+  std::size_t position() const noexcept(true) { return this->pos_; }
+
+  void beginObject() noexcept(false);
+
+  ///
+  ///\brief Read the next key of the current object
+  ///
+  ///\param key set to the key (valid until the next call of this reader)
+  ///\return false, if the object ended
+  ///
+  bool nextKey(std::string_view &key) noexcept(false);
+
+  void beginArray() noexcept(false);
+
+  ///
+  ///\brief Advance to the next element of the current array
+  ///
+  ///\return false, if the array ended
+  ///
+  bool nextElement() noexcept(false);
+
+  ///
+  ///\brief Read a string value
+  ///
+  ///\param out set to the decoded string
+  ///
+  void readString(std::string &out) noexcept(false);
+
+  ///
+  ///\brief Read a number value
+  ///
+  ///\return std::string_view the (syntactically valid) number text
+  ///
+  std::string_view readNumber() noexcept(false);
+
+  bool readBoolean() noexcept(false);
+
+  void readNull() noexcept(false);
+
+  ///
+  ///\brief Skip the next value (of any type, without recursion)
+  ///
+  ///\return std::string_view the JSON text of the skipped value
+  ///
+  std::string_view skipValue() noexcept(false);
+
+  ///
+  ///\brief Ensure, that only whitespace follows the last value
+  ///
+  void end() noexcept(false);
+};
+
+}  // namespace vda5050pp::core::messages
+
+#endif  // VDA5050_2B_2B_CORE_MESSAGES_JSON_READER_H_
@@ -0,0 +1,168 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+//
+// This file contains a streaming JSON writer, which produces the same text as
+// nlohmann::json::dump() without building a JSON DOM.
+//
+
+#ifndef VDA5050_2B_2B_CORE_MESSAGES_JSON_WRITER_H_
+#define VDA5050_2B_2B_CORE_MESSAGES_JSON_WRITER_H_
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace vda5050pp::core::messages {
+
+///
+///\brief Writes compact JSON text into a grow-only buffer.
+///
+/// The formatting matches nlohmann::json::dump() (no indentation, strict error handling):
+/// Strings are escaped like nlohmann does, floats use the same shortest round-trip
+/// representation and non-finite floats are written as null. Strings, which are not valid
+/// UTF-8, throw a VDA5050PPJsonError (where nlohmann throws type_error.316). Keys are written in
+/// the order they are passed, so callers have to pass them sorted to match an nlohmann object.
+///
+/// The buffer keeps its capacity between messages. take() hands the buffer out without
+/// copying it; the next reset() then reserves the size of the largest message seen so far.
+///
+class JsonWriter {
+private:
+  std::string buffer_;
+  std::size_t capacity_hint_ = 0;
+  bool first_ = true;
+
+  void separate() noexcept(false) {
+    if (!this->first_) {
+      this->buffer_.push_back(',');
+    }
+    this->first_ = false;
+  }
+
+  void writeEscaped(std::string_view str) noexcept(false);
+  void writeInteger(int64_t value) noexcept(false);
+  void writeUnsigned(uint64_t value) noexcept(false);
+  void writeFloat(double value) noexcept(false);
+
+public:
+  ///
+  ///\brief Clear the buffer and reserve the largest size seen so far.
+  ///
+  void reset() noexcept(false);
+
+  ///
+  ///\brief Move the written text out of the writer (the writer must be reset before reuse).
+  ///
+  ///\return std::string the text
+  ///
+  std::string take() noexcept(true);
+
+  ///
+  ///\brief Get a view of the text written so far.
+  ///
+  ///\return std::string_view the text
+  ///
+  std::string_view view() const noexcept(true) { return this->buffer_; }
+
+  void beginObject() noexcept(false) {
+    this->separate();
+    this->buffer_.push_back('{');
+    this->first_ = true;
+  }
+
+  void endObject() noexcept(false) {
+    this->buffer_.push_back('}');
+    this->first_ = false;
+  }
+
+  ///
+  ///\brief End an object, which is written as null, if it has no members (like an
+  /// nlohmann::json, which was never assigned to).
+  ///
+  void endObjectOrNull() noexcept(false) {
+    if (this->first_) {
+      this->buffer_.back() = 'n';
+      this->buffer_.append("ull");
+    } else {
+      this->buffer_.push_back('}');
+    }
+    this->first_ = false;
+  }
+
+  void beginArray() noexcept(false) {
+    this->separate();
+    this->buffer_.push_back('[');
+    this->first_ = true;
+  }
+
+  void endArray() noexcept(false) {
+    this->buffer_.push_back(']');
+    this->first_ = false;
+  }
+
+  ///
+  ///\brief Write an object key. The next value belongs to this key.
+  ///
+  ///\param key the key
+  ///
+  void key(std::string_view key) noexcept(false) {
+    this->separate();
+    this->writeEscaped(key);
+    this->buffer_.push_back(':');
+    this->first_ = true;
+  }
+
+  void value(std::string_view value) noexcept(false) {
+    this->separate();
+    this->writeEscaped(value);
+  }
+
+  void value(const char *value) noexcept(false) { this->value(std::string_view(value)); }
+
+  void value(bool value) noexcept(false) {
+    this->separate();
+    this->buffer_.append(value ? "true" : "false");
+  }
+
+  template <typename IntegralT,
+            std::enable_if_t<std::is_integral_v<IntegralT> && !std::is_same_v<IntegralT, bool>,
+                             int> = 0>
+  void value(IntegralT value) noexcept(false) {
+    this->separate();
+    if constexpr (std::is_signed_v<IntegralT>) {
+      this->writeInteger(value);
+    } else {
+      this->writeUnsigned(value);
+    }
+  }
+
+  template <typename FloatT, std::enable_if_t<std::is_floating_point_v<FloatT>, int> = 0>
+  void value(FloatT value) noexcept(false) {
+    this->separate();
+    this->writeFloat(double(value));
+  }
+
+  void null() noexcept(false) {
+    this->separate();
+    this->buffer_.append("null");
+  }
+
+  ///
+  ///\brief Write an already serialized JSON value.
+  ///
+  ///\param json the JSON text
+  ///
+  void raw(std::string_view json) noexcept(false) {
+    this->separate();
+    this->buffer_.append(json);
+  }
+};
+
+}  // namespace vda5050pp::core::messages
+
+#endif  // VDA5050_2B_2B_CORE_MESSAGES_JSON_WRITER_H_
@@ -0,0 +1,133 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+//
+// This file contains the LoopbackTransport, which keeps all messages of the MqttModule in the
+// process (i.e. for tests and benchmarks without a broker)
+//
+
+#ifndef VDA5050_2B_2B_CORE_MESSAGES_LOOPBACK_TRANSPORT_H_
+#define VDA5050_2B_2B_CORE_MESSAGES_LOOPBACK_TRANSPORT_H_
+
+#include <mqtt/async_client.h>
+#include <vda5050/InstantActions.h>
+#include <vda5050/Order.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "vda5050++/core/messages/transport.h"
+
+namespace vda5050pp::core::messages {
+
+///
+///\brief An in-process Transport. Messages are injected by the caller and all published
+/// messages are captured with a timestamp, instead of going to a broker.
+///
+/// connect() connects immediately, publishes are delivered immediately. Injected messages
+/// are passed to the MqttModule on the calling thread, if the module subscribed to their topic
+/// (wildcard subscriptions included).
+///
+class LoopbackTransport final : public Transport {
+public:
+  // steady_clock has a nanosecond resolution on all supported platforms
+  using Clock = std::chrono::steady_clock;
+
+  ///
+  ///\brief A published message
+  ///
+  struct Capture {
+    std::string topic;
+    std::string payload;
+    Clock::time_point timestamp;
+  };
+
+private:
+  mutable std::mutex mutex_;
+  std::condition_variable captured_cv_;
+  mqtt::callback *callback_ = nullptr;
+  PublishCompletion completion_;
+  bool connected_ = false;
+  std::set<std::string, std::less<>> subscriptions_;
+  std::vector<Capture> captured_;
+
+  std::string findSubscription(std::string_view sub_topic,
+                               std::string_view serial_number) const noexcept(false);
+
+public:
+  void setCallbacks(mqtt::callback &callback, mqtt::iaction_listener &connect_listener,
+                    PublishCompletion completion) noexcept(false) override;
+  void connect() noexcept(false) override;
+  void disconnect() noexcept(false) override;
+  void subscribe(const std::string &topic, int qos) noexcept(false) override;
+  void publish(mqtt::const_message_ptr msg, void *context) noexcept(false) override;
+
+  ///
+  ///\brief Simulate a lost connection (callback.connection_lost() is called). connect()
+  /// connects again.
+  ///
+  ///\param cause the reported cause
+  ///
+  void dropConnection(const std::string &cause) noexcept(false);
+
+  ///
+  ///\brief Inject a received message. Messages on topics without a subscription are dropped.
+  ///
+  ///\param topic the topic
+  ///\param payload the payload
+  ///\return Clock::time_point the time the message was injected at
+  ///\throws VDA5050PPMqttError if the transport is not connected
+  ///
+  Clock::time_point inject(const std::string &topic, std::string payload) noexcept(false);
+
+  ///
+  ///\brief Encode and inject an order on the subscribed "order" topic. The serial number of the
+  /// header fills in a wildcard subscription.
+  ///
+  ///\param order the order
+  ///\return Clock::time_point the time the message was injected at (after encoding)
+  ///\throws VDA5050PPMqttError if the transport is not connected or there is no subscription
+  ///
+  Clock::time_point injectOrder(const vda5050::Order &order) noexcept(false);
+
+  ///
+  ///\brief Encode and inject instant actions on the subscribed "instantActions" topic. The
+  /// serial number of the header fills in a wildcard subscription.
+  ///
+  ///\param instant_actions the instant actions
+  ///\return Clock::time_point the time the message was injected at (after encoding)
+  ///\throws VDA5050PPMqttError if the transport is not connected or there is no subscription
+  ///
+  Clock::time_point injectInstantActions(const vda5050::InstantActions &instant_actions) noexcept(
+      false);
+
+  ///
+  ///\brief Get and remove all captured messages.
+  ///
+  ///\return std::vector<Capture> the captured messages in the order, in which they were published
+  ///
+  std::vector<Capture> takeCaptured() noexcept(false);
+
+  ///
+  ///\brief Wait until a number of messages was captured on a topic.
+  ///
+  ///\param sub_topic the last level of the topic (i.e. "state")
+  ///\param count the number of messages
+  ///\param timeout the maximum time to wait
+  ///\return true if the messages were captured in time
+  ///
+  bool waitForCaptured(std::string_view sub_topic, std::size_t count,
+                       std::chrono::milliseconds timeout) noexcept(false);
+};
+
+}  // namespace vda5050pp::core::messages
+
+#endif  // VDA5050_2B_2B_CORE_MESSAGES_LOOPBACK_TRANSPORT_H_
@@ -0,0 +1,55 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+//
+// This file contains the decoders for all incoming VDA5050 messages. They fill the messages
+// directly from the payload, like vda5050::json::parse(payload).get<MessageT>(), but do not
+// build a JSON DOM.
+//
+
+#ifndef VDA5050_2B_2B_CORE_MESSAGES_MESSAGE_DECODER_H_
+#define VDA5050_2B_2B_CORE_MESSAGES_MESSAGE_DECODER_H_
+
+#include <vda5050/InstantActions.h>
+#include <vda5050/Order.h>
+
+#include <string_view>
+
+#include "vda5050++/agv_description/simple_protocol_limits.h"
+
+namespace vda5050pp::core::messages {
+
+///
+///\brief Decode an Order message
+///
+/// Throws VDA5050PPJsonError (syntax errors, missing keys, wrong value types),
+/// VDA5050PPProtocolLimitExceeded (as soon as a limit is exceeded, before decoding the rest) or
+/// vda5050::json::exception (errors of the message library, e.g. an invalid timestamp).
+///
+///\param payload the JSON text
+///\param order the order to fill
+///\param limits the limits to enforce (message size, id length, node, edge and action counts)
+///
+void decode(std::string_view payload, vda5050::Order &order,
+            const vda5050pp::agv_description::SimpleProtocolLimits &limits = {}) noexcept(false);
+
+///
+///\brief Decode an InstantActions message
+///
+/// Throws VDA5050PPJsonError (syntax errors, missing keys, wrong value types),
+/// VDA5050PPProtocolLimitExceeded (as soon as a limit is exceeded, before decoding the rest) or
+/// vda5050::json::exception (errors of the message library, e.g. an invalid timestamp).
+///
+///\param payload the JSON text
+///\param instant_actions the instant actions to fill
+///\param limits the limits to enforce (message size, id length, action counts)
+///
+void decode(std::string_view payload, vda5050::InstantActions &instant_actions,
+            const vda5050pp::agv_description::SimpleProtocolLimits &limits = {}) noexcept(false);
+
+}  // namespace vda5050pp::core::messages
+
+#endif  // VDA5050_2B_2B_CORE_MESSAGES_MESSAGE_DECODER_H_
@@ -0,0 +1,93 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+//
+// This file contains the encoders for all outgoing VDA5050 messages. They write the same text as
+// vda5050::json(message).dump(), but do not build a JSON DOM.
+//
+
+#ifndef VDA5050_2B_2B_CORE_MESSAGES_MESSAGE_ENCODER_H_
+#define VDA5050_2B_2B_CORE_MESSAGES_MESSAGE_ENCODER_H_
+
+#include <vda5050/AgvFactsheet.h>
+#include <vda5050/Connection.h>
+#include <vda5050/State.h>
+#include <vda5050/Visualization.h>
+
+#include <cstdint>
+#include <string>
+
+#include "vda5050++/core/messages/json_writer.h"
+#include "vda5050++/core/state/state_revisions.h"
+
+namespace vda5050pp::core::messages {
+
+///
+///\brief Keeps the encoded JSON values of the rarely changing parts of the last State message.
+///
+struct StateFragmentCache {
+  struct Fragment {
+    uint64_t revision = 0;
+    std::string json;
+  };
+
+  Fragment action_states;
+  Fragment edge_states;
+  Fragment errors;
+  Fragment information;
+  Fragment loads;
+  Fragment node_states;
+};
+
+///
+///\brief Encode a State message
+///
+///\param writer the writer to encode into
+///\param state the message
+///
+void encode(JsonWriter &writer, const vda5050::State &state) noexcept(false);
+
+///
+///\brief Encode a State message. The encoding of each part, whose revision did not change since
+/// the last call with the same cache, is copied from the cache instead of being encoded again.
+///
+///\param writer the writer to encode into
+///\param state the message
+///\param revisions the revisions of the state parts (0 is never cached)
+///\param cache the cache (updated with all changed parts)
+///
+void encode(JsonWriter &writer, const vda5050::State &state,
+            const vda5050pp::core::state::StateRevisions &revisions,
+            StateFragmentCache &cache) noexcept(false);
+
+///
+///\brief Encode a Visualization message
+///
+///\param writer the writer to encode into
+///\param visualization the message
+///
+void encode(JsonWriter &writer, const vda5050::Visualization &visualization) noexcept(false);
+
+///
+///\brief Encode a Connection message
+///
+///\param writer the writer to encode into
+///\param connection the message
+///
+void encode(JsonWriter &writer, const vda5050::Connection &connection) noexcept(false);
+
+///
+///\brief Encode an AgvFactsheet message. The factsheet is only sent rarely, so this still
+/// uses the JSON DOM internally, but writes into the same buffer.
+///
+///\param writer the writer to encode into
+///\param factsheet the message
+///
+void encode(JsonWriter &writer, const vda5050::AgvFactsheet &factsheet) noexcept(false);
+
+}  // namespace vda5050pp::core::messages
+
+#endif  // VDA5050_2B_2B_CORE_MESSAGES_MESSAGE_ENCODER_H_
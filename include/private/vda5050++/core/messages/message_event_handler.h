@@ -8,8 +8,11 @@
 #ifndef VDA5050_2B_2B_CORE_MESSAGES_MESSAGE_EVENT_HANDLER_H_
 #define VDA5050_2B_2B_CORE_MESSAGES_MESSAGE_EVENT_HANDLER_H_
 
+#include <list>
+#include <mutex>
 #include <optional>
 
+#include "vda5050++/core/common/coroutine.h"
 #include "vda5050++/core/module.h"
 
 namespace vda5050pp::core::messages {
@@ -19,8 +22,48 @@ private:
   std::optional<GenericEventManager<vda5050pp::core::events::MessageEvent>::ScopedSubscriber>
       subscriber_;
 
+#ifdef LIBVDA5050PP_COROUTINES
+  struct PendingValidation {
+    // Either an order or instant actions
+    std::shared_ptr<const vda5050pp::core::events::ReceiveOrderMessageEvent> order_evt;
+    std::shared_ptr<const vda5050pp::core::events::ReceiveInstantActionMessageEvent>
+        instant_actions_evt;
+    // std::nullopt, if the validation failed (the message is discarded)
+    std::optional<vda5050pp::core::events::ValidationResult> result;
+    bool done = false;
+  };
+
+  // Orders and instant actions, which are validated, in order of reception. Validations may
+  // finish out of order (i.e. while one awaits a zone set query), but they are evaluated in this
+  // order.
+  mutable std::mutex pending_validations_mutex_;
+  mutable std::list<PendingValidation> pending_validations_;
+  mutable bool evaluating_ = false;
+#endif
+
   void handleOrderMessage(
       std::shared_ptr<const vda5050pp::core::events::ReceiveOrderMessageEvent> evt) const;
+#ifdef LIBVDA5050PP_COROUTINES
+  vda5050pp::core::common::Task awaitOrderValidation(
+      std::list<PendingValidation>::iterator pending,
+      vda5050pp::core::common::ScheduledResultAwaiter<vda5050pp::core::events::ValidationResult>
+          vo_result) const;
+
+  ///
+  ///\brief Complete a pending validation and evaluate all completed validations at the front of
+  /// pending_validations_, in order of reception.
+  ///
+  ///\param pending the completed validation
+  ///\param vo_res the validation result (std::nullopt, if it failed)
+  ///
+  void completeValidation(std::list<PendingValidation>::iterator pending,
+                          std::optional<vda5050pp::core::events::ValidationResult> vo_res) const;
+#endif
+  void evaluateOrderValidation(const vda5050pp::core::events::ReceiveOrderMessageEvent &evt,
+                               vda5050pp::core::events::ValidationResult vo_res) const;
+  void evaluateInstantActionsValidation(
+      const vda5050pp::core::events::ReceiveInstantActionMessageEvent &evt,
+      vda5050pp::core::events::ValidationResult v_res) const;
 
   void handleInstantActionsMessage(
       std::shared_ptr<const vda5050pp::core::events::ReceiveInstantActionMessageEvent> evt) const;
@@ -15,13 +15,24 @@
 #include <vda5050/State.h>
 #include <vda5050/Visualization.h>
 
+#include <chrono>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <vector>
 
 #include "vda5050++/agv_description/agv_description.h"
 #include "vda5050++/config/mqtt_options.h"
+#include "vda5050++/core/messages/decode_stage.h"
+#include "vda5050++/core/messages/message_encoder.h"
+#include "vda5050++/core/messages/outbound_buffer.h"
+#include "vda5050++/core/messages/publish_tracker.h"
+#include "vda5050++/core/messages/transport.h"
 #include "vda5050++/core/module.h"
+#include "vda5050++/core/state/state_revisions.h"
+#include "vda5050++/misc/outbound_buffer_statistics.h"
+#include "vda5050++/observer/message_observer.h"
 
 namespace vda5050pp::core::messages {
 
@@ -52,7 +63,10 @@ private:
   uint32_t factsheet_seq_id_ = 0;
   uint32_t state_seq_id_ = 0;
   uint32_t visualization_seq_id_ = 0;
-  std::unique_ptr<mqtt::async_client> mqtt_client_;
+  std::shared_ptr<Transport> transport_;
+  std::shared_ptr<Transport> custom_transport_;
+  // The module is owned by the instance, so it never outlives it
+  vda5050pp::core::Instance *instance_ = nullptr;
   std::string server_;
   mqtt::connect_options connect_opts_;
   std::string connection_topic_;
@@ -63,8 +77,66 @@ private:
   std::string visualization_topic_;
   std::string manufacturer_;
   std::string serial_number_;
-
-  const int k_qos = 0;
+  vda5050pp::agv_description::SimpleProtocolLimits protocol_limits_;
+
+  vda5050pp::config::MqttTopicQos qos_;
+  std::optional<std::string> persistence_dir_;
+  std::optional<int> max_buffered_messages_;
+  int mqtt_version_ = MQTTVERSION_3_1_1;
+  bool use_topic_aliases_ = false;
+  bool shared_connection_ = false;
+  std::optional<int> visualization_ttl_s_;
+
+  struct TopicAlias {
+    std::string topic;
+    int alias = 0;
+    bool announced = false;
+  };
+  static constexpr int k_state_topic_alias = 1;
+  static constexpr int k_visualization_topic_alias = 2;
+  // Topic aliases only live as long as the connection, each one is announced once per connection
+  mutable std::mutex topic_alias_mutex_;
+  mutable std::vector<TopicAlias> topic_aliases_;
+  int topic_alias_maximum_ = 0;
+
+  static constexpr std::size_t k_order_lane = 0;
+  static constexpr std::size_t k_instant_actions_lane = 1;
+  static constexpr std::size_t k_lanes = 2;
+  std::unique_ptr<DecodeStage> decode_stage_;
+
+  mutable std::mutex state_cache_mutex_;
+  mutable StateFragmentCache state_cache_;
+
+  // Outbound slots in the order, in which buffered messages are flushed
+  static constexpr std::size_t k_connection_slot = 0;
+  static constexpr std::size_t k_factsheet_slot = 1;
+  static constexpr std::size_t k_state_slot = 2;
+  static constexpr std::size_t k_visualization_slot = 3;
+  static constexpr std::size_t k_outbound_slots = 4;
+  struct OutboundMessage {
+    mqtt::message_ptr message;
+    std::size_t slot = 0;
+    std::chrono::steady_clock::time_point created;
+  };
+  mutable OutboundBuffer<OutboundMessage> outbound_buffer_{k_outbound_slots};
+
+  // Publish statistics per outbound slot
+  mutable PublishTracker publish_tracker_{{"connection", "factsheet", "state", "visualization"}};
+
+  ///
+  ///\brief Use a transport and set this module's callbacks on it.
+  ///
+  ///\param transport the transport
+  ///
+  void attachTransport(std::shared_ptr<Transport> transport) noexcept(false);
+
+  ///
+  ///\brief Dispatch an event on the message event manager of the own instance. Transport
+  /// callbacks are not running on an instance thread, so the instance is bound while dispatching.
+  ///
+  ///\param event the event
+  ///
+  void dispatchMessageEvent(std::shared_ptr<vda5050pp::core::events::MessageEvent> event) const;
 
   void fillHeaderConnection(vda5050::HeaderVDA5050 &header);
   void fillHeaderFactsheet(vda5050::HeaderVDA5050 &header);
@@ -72,9 +144,41 @@ private:
   void fillHeaderVisualization(vda5050::HeaderVDA5050 &header);
   mqtt::will_options getWill();
 
+  ///
+  ///\brief Decode a received message (runs on the DecodeStage).
+  ///
+  ///\param msg the message
+  ///\return DecodeStage::Delivery dispatches the message event (or an error event)
+  ///
+  DecodeStage::Delivery decodeMessage(const mqtt::message &msg) const;
+
+  ///
+  ///\brief Publish a message or buffer it, while the module is offline.
+  ///
+  ///\param out the message
+  ///\throws VDA5050PPMqttError if the message can neither be buffered nor published
+  ///
+  void publish(OutboundMessage &&out) const noexcept(false);
+
+  ///
+  ///\brief Publish a message now, using a topic alias for its topic, if there is one.
+  ///
+  ///\param out the message
+  ///
+  void publishNow(OutboundMessage &&out) const noexcept(false);
+
 public:
   void useMqttOptions(const vda5050pp::config::MqttOptions &opts);
 
+  ///
+  ///\brief Use a custom Transport (i.e. a LoopbackTransport) instead of connecting to the
+  /// configured broker. If the module is initialized, but was not connected yet, the transport
+  /// is used immediately. Otherwise it takes effect with the next initialize().
+  ///
+  ///\param transport the transport (nullptr restores the broker connection)
+  ///
+  void useTransport(std::shared_ptr<Transport> transport) noexcept(false);
+
   /**
    * This method is invoked when an action fails.
    * @param asyncActionToken
@@ -111,11 +215,35 @@ public:
 
   void disconnect();
 
+  // created is the creation time of the send event, the publish latency is measured from
   void sendState(const vda5050::State &state) const noexcept(false);
-  void sendFactsheet(const vda5050::AgvFactsheet &state) const noexcept(false);
-  void sendVisualization(const vda5050::Visualization &visualization) const noexcept(false);
+  void sendState(const vda5050::State &state,
+                 const vda5050pp::core::state::StateRevisions &revisions,
+                 std::chrono::steady_clock::time_point created =
+                     std::chrono::steady_clock::now()) const noexcept(false);
+  void sendFactsheet(const vda5050::AgvFactsheet &state,
+                     std::chrono::steady_clock::time_point created =
+                         std::chrono::steady_clock::now()) const noexcept(false);
+  void sendVisualization(const vda5050::Visualization &visualization,
+                         std::chrono::steady_clock::time_point created =
+                             std::chrono::steady_clock::now()) const noexcept(false);
   void sendConnection(const vda5050::Connection &connection) const noexcept(false);
 
+  ///
+  ///\brief Get the counters of the offline buffer.
+  ///
+  ///\return vda5050pp::misc::OutboundBufferStatistics the counters
+  ///
+  vda5050pp::misc::OutboundBufferStatistics getOutboundBufferStatistics() const noexcept(true);
+
+  ///
+  ///\brief Get the publish statistics of each outgoing topic.
+  ///
+  ///\return std::vector<vda5050pp::observer::PublishStatistics> the statistics
+  ///
+  std::vector<vda5050pp::observer::PublishStatistics> getPublishStatistics() const
+      noexcept(false);
+
   void initialize(vda5050pp::core::Instance &instance) override;
   void deinitialize(vda5050pp::core::Instance &instance) override;
   std::string_view describe() const override;
@@ -0,0 +1,186 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+//
+// This file contains the OutboundBuffer, which keeps outgoing messages while offline
+//
+
+#ifndef VDA5050_2B_2B_CORE_MESSAGES_OUTBOUND_BUFFER_H_
+#define VDA5050_2B_2B_CORE_MESSAGES_OUTBOUND_BUFFER_H_
+
+#include <chrono>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "vda5050++/misc/outbound_buffer_statistics.h"
+
+namespace vda5050pp::core::messages {
+
+///
+///\brief Keeps the latest outgoing message of each slot (i.e. topic) while offline.
+///
+/// A newer message replaces the buffered message of the same slot (latest wins). When going
+/// online, flush() publishes all buffered messages in slot order. Messages offered during a
+/// flush are buffered as well and published by the same flush, so they never overtake older
+/// buffered messages.
+///
+///\tparam MessagePtrT the (shared) pointer type of a message
+///
+template <typename MessagePtrT> class OutboundBuffer {
+private:
+  using Clock = std::chrono::steady_clock;
+
+  struct Entry {
+    MessagePtrT message;
+    Clock::time_point buffered_at;
+  };
+
+  mutable std::mutex mutex_;
+  std::vector<std::optional<Entry>> slots_;
+  std::optional<Clock::duration> max_age_;
+  bool enabled_ = true;
+  bool online_ = false;
+  vda5050pp::misc::OutboundBufferStatistics statistics_;
+
+  std::vector<MessagePtrT> takeLocked() noexcept(false) {
+    std::vector<MessagePtrT> ret;
+    auto now = Clock::now();
+    for (auto &slot : this->slots_) {
+      if (!slot.has_value()) {
+        continue;
+      }
+      if (this->max_age_.has_value() && now - slot->buffered_at > *this->max_age_) {
+        this->statistics_.dropped++;
+      } else {
+        this->statistics_.flushed++;
+        ret.push_back(std::move(slot->message));
+      }
+      slot.reset();
+      this->statistics_.pending--;
+    }
+    return ret;
+  }
+
+public:
+  ///
+  ///\brief Construct a new OutboundBuffer
+  ///
+  ///\param slots the number of slots
+  ///
+  explicit OutboundBuffer(std::size_t slots) noexcept(false) : slots_(slots) {}
+
+  ///
+  ///\brief Configure the buffer. Disabling it drops all buffered messages.
+  ///
+  ///\param enabled buffer messages while offline? (if not, offer() always returns false)
+  ///\param max_age messages older than this are dropped instead of flushed
+  ///
+  void configure(bool enabled,
+                 std::optional<std::chrono::steady_clock::duration> max_age) noexcept(true) {
+    std::unique_lock lock(this->mutex_);
+    this->enabled_ = enabled;
+    this->max_age_ = max_age;
+    if (!enabled) {
+      lock.unlock();
+      this->clear();
+    }
+  }
+
+  ///
+  ///\brief Buffer a message, if the buffer is offline (or flushing).
+  ///
+  ///\param slot the slot of the message
+  ///\param message the message
+  ///\return true, if the message was buffered, false if it has to be sent directly
+  ///
+  bool offer(std::size_t slot, MessagePtrT message) noexcept(true) {
+    std::unique_lock lock(this->mutex_);
+    if (!this->enabled_ || this->online_ || slot >= this->slots_.size()) {
+      return false;
+    }
+
+    auto &entry = this->slots_[slot];
+    if (entry.has_value()) {
+      this->statistics_.coalesced++;
+    } else {
+      this->statistics_.pending++;
+    }
+    this->statistics_.buffered++;
+    entry = Entry{std::move(message), Clock::now()};
+    return true;
+  }
+
+  ///
+  ///\brief Publish all buffered messages and go online. Messages, which could not be published
+  /// (publish threw), are counted as dropped, the others are still published.
+  ///
+  ///\param publish called for each buffered message (without holding the lock)
+  ///\return std::size_t the number of published messages
+  ///
+  template <typename PublishFn> std::size_t flush(PublishFn &&publish) noexcept(true) {
+    std::size_t published = 0;
+    std::unique_lock lock(this->mutex_);
+    while (true) {
+      auto batch = this->takeLocked();
+      if (batch.empty()) {
+        this->online_ = true;
+        return published;
+      }
+
+      lock.unlock();
+      std::size_t failed = 0;
+      for (auto &message : batch) {
+        try {
+          publish(std::move(message));
+          published++;
+        } catch (...) {
+          failed++;
+        }
+      }
+      lock.lock();
+      this->statistics_.flushed -= failed;
+      this->statistics_.dropped += failed;
+    }
+  }
+
+  ///
+  ///\brief Go offline, all following offered messages are buffered.
+  ///
+  void goOffline() noexcept(true) {
+    std::unique_lock lock(this->mutex_);
+    this->online_ = false;
+  }
+
+  ///
+  ///\brief Drop all buffered messages.
+  ///
+  void clear() noexcept(true) {
+    std::unique_lock lock(this->mutex_);
+    for (auto &slot : this->slots_) {
+      if (slot.has_value()) {
+        slot.reset();
+        this->statistics_.dropped++;
+        this->statistics_.pending--;
+      }
+    }
+  }
+
+  ///
+  ///\brief Get the current counters
+  ///
+  ///\return vda5050pp::misc::OutboundBufferStatistics the counters
+  ///
+  vda5050pp::misc::OutboundBufferStatistics statistics() const noexcept(true) {
+    std::unique_lock lock(this->mutex_);
+    return this->statistics_;
+  }
+};
+
+}  // namespace vda5050pp::core::messages
+
+#endif  // VDA5050_2B_2B_CORE_MESSAGES_OUTBOUND_BUFFER_H_
@@ -0,0 +1,69 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+//
+// This file contains the PahoTransport, which connects the MqttModule to an MQTT broker
+//
+
+#ifndef VDA5050_2B_2B_CORE_MESSAGES_PAHO_TRANSPORT_H_
+#define VDA5050_2B_2B_CORE_MESSAGES_PAHO_TRANSPORT_H_
+
+#include <mqtt/async_client.h>
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "vda5050++/core/messages/transport.h"
+
+namespace vda5050pp::core::messages {
+
+///
+///\brief The Transport to an MQTT broker, based on the paho async_client.
+///
+class PahoTransport final : public Transport {
+private:
+  ///
+  ///\brief Passes the completed publish tokens to the PublishCompletion.
+  ///
+  class PublishListener final : public mqtt::iaction_listener {
+  public:
+    PublishCompletion completion;
+    void on_failure(const mqtt::token &tkn) override;
+    void on_success(const mqtt::token &tkn) override;
+  };
+
+  std::unique_ptr<mqtt::async_client> client_;
+  mqtt::connect_options connect_opts_;
+  mqtt::iaction_listener *connect_listener_ = nullptr;
+  PublishListener publish_listener_;
+
+public:
+  ///
+  ///\brief Construct a new PahoTransport (does not connect yet)
+  ///
+  ///\param server the broker address
+  ///\param client_id the MQTT client id
+  ///\param create_opts the options of the client
+  ///\param persistence_dir the directory for unacknowledged messages (none keeps them in memory)
+  ///\param connect_opts the options used for each connect()
+  ///
+  PahoTransport(const std::string &server, const std::string &client_id,
+                const mqtt::create_options &create_opts,
+                const std::optional<std::string> &persistence_dir,
+                const mqtt::connect_options &connect_opts) noexcept(false);
+
+  void setCallbacks(mqtt::callback &callback, mqtt::iaction_listener &connect_listener,
+                    PublishCompletion completion) noexcept(false) override;
+  void connect() noexcept(false) override;
+  void disconnect() noexcept(false) override;
+  void subscribe(const std::string &topic, int qos) noexcept(false) override;
+  void publish(mqtt::const_message_ptr msg, void *context) noexcept(false) override;
+};
+
+}  // namespace vda5050pp::core::messages
+
+#endif  // VDA5050_2B_2B_CORE_MESSAGES_PAHO_TRANSPORT_H_
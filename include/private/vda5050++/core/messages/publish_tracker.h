@@ -0,0 +1,108 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+//
+// This file contains the PublishTracker, which records the latency and delivery of publishes
+//
+
+#ifndef VDA5050_2B_2B_CORE_MESSAGES_PUBLISH_TRACKER_H_
+#define VDA5050_2B_2B_CORE_MESSAGES_PUBLISH_TRACKER_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "vda5050++/core/common/event_statistics.h"
+#include "vda5050++/observer/message_observer.h"
+
+namespace vda5050pp::core::messages {
+
+///
+///\brief Records the latency, delivery and in-flight messages of each outgoing topic.
+///
+/// Each publish is started with beginPublish(), which returns a context for the MQTT client
+/// (i.e. the user context of the publish token). The publish is finished with endPublish(),
+/// once the token completed.
+///
+class PublishTracker final {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  ///
+  ///\brief The tracked data of a single publish.
+  ///
+  struct Context {
+    std::size_t topic = 0;
+    std::size_t bytes = 0;
+    Clock::time_point published;
+  };
+
+private:
+  struct Topic {
+    std::string name;
+    std::atomic<uint64_t> published = 0;
+    std::atomic<uint64_t> delivered = 0;
+    std::atomic<uint64_t> failed = 0;
+    std::atomic<uint64_t> in_flight = 0;
+    std::atomic<uint64_t> buffered_bytes = 0;
+    vda5050pp::core::common::AtomicLatencyHistogram event_to_publish;
+    vda5050pp::core::common::AtomicLatencyHistogram publish_to_delivery;
+  };
+
+  std::vector<std::unique_ptr<Topic>> topics_;
+  std::mutex pending_mutex_;
+  std::unordered_map<const Context *, std::unique_ptr<Context>> pending_;
+
+  void finish(const Context &context, bool delivered) noexcept(true);
+
+public:
+  ///
+  ///\brief Construct a new PublishTracker
+  ///
+  ///\param topic_names the names of the tracked topics (a topic is referred to by its index)
+  ///
+  explicit PublishTracker(const std::vector<std::string> &topic_names) noexcept(false);
+
+  ///
+  ///\brief Start tracking a publish
+  ///
+  ///\param topic the topic index
+  ///\param bytes the payload size
+  ///\param created the creation time of the message
+  ///\return Context* the context, which has to be passed to endPublish()
+  ///
+  Context *beginPublish(std::size_t topic, std::size_t bytes,
+                        Clock::time_point created) noexcept(false);
+
+  ///
+  ///\brief Finish tracking a publish. Unknown contexts are ignored.
+  ///
+  ///\param context the context returned by beginPublish()
+  ///\param delivered was the message delivered?
+  ///
+  void endPublish(const void *context, bool delivered) noexcept(true);
+
+  ///
+  ///\brief Count all pending publishes as failed (i.e. when the MQTT client is destroyed).
+  ///
+  void clear() noexcept(true);
+
+  ///
+  ///\brief Get a snapshot of all topics
+  ///
+  ///\return std::vector<vda5050pp::observer::PublishStatistics> the statistics
+  ///
+  std::vector<vda5050pp::observer::PublishStatistics> snapshot() const noexcept(false);
+};
+
+}  // namespace vda5050pp::core::messages
+
+#endif  // VDA5050_2B_2B_CORE_MESSAGES_PUBLISH_TRACKER_H_
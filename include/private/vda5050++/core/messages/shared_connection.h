@@ -0,0 +1,168 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+//
+// This file contains the SharedConnection, which multiplexes the MqttModules of several
+// instances (AGVs) over one Transport
+//
+
+#ifndef VDA5050_2B_2B_CORE_MESSAGES_SHARED_CONNECTION_H_
+#define VDA5050_2B_2B_CORE_MESSAGES_SHARED_CONNECTION_H_
+
+#include <mqtt/async_client.h>
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "vda5050++/core/messages/transport.h"
+
+namespace vda5050pp::core::messages {
+
+///
+///\brief One Transport (i.e. one broker connection), which is shared by the MqttModules of
+/// several instances.
+///
+/// Each MqttModule uses an own Endpoint of the connection. A subscription of an Endpoint
+/// becomes a wildcard subscription of the serial number level
+/// (<iface>/<version>/<manufacturer>/+/<topic>), which is subscribed only once. Received
+/// messages are routed to the Endpoint by their topic with a hash lookup.
+///
+/// The connection is established with the first connecting Endpoint and closed after the last
+/// one disconnected. There is only one last will per connection, so the Endpoints do not have one.
+///
+class SharedConnection final : public mqtt::callback,
+                               public mqtt::iaction_listener,
+                               public std::enable_shared_from_this<SharedConnection> {
+public:
+  ///
+  ///\brief Creates the Transport of a new SharedConnection.
+  ///
+  using TransportFactory = std::function<std::shared_ptr<Transport>()>;
+
+  ///
+  ///\brief The Transport of a single MqttModule on the SharedConnection.
+  ///
+  class Endpoint final : public Transport, public std::enable_shared_from_this<Endpoint> {
+  private:
+    friend class SharedConnection;
+
+    std::shared_ptr<SharedConnection> connection_;
+    // Set once by setCallbacks(), only read afterwards
+    mqtt::callback *callback_ = nullptr;
+    mqtt::iaction_listener *connect_listener_ = nullptr;
+    PublishCompletion completion_;
+
+  public:
+    explicit Endpoint(std::shared_ptr<SharedConnection> connection) noexcept(true);
+    ~Endpoint() override;
+
+    Endpoint(const Endpoint &) = delete;
+    Endpoint &operator=(const Endpoint &) = delete;
+
+    void setCallbacks(mqtt::callback &callback, mqtt::iaction_listener &connect_listener,
+                      PublishCompletion completion) noexcept(false) override;
+    void connect() noexcept(false) override;
+    void disconnect() noexcept(false) override;
+    void subscribe(const std::string &topic, int qos) noexcept(false) override;
+    void publish(mqtt::const_message_ptr msg, void *context) noexcept(false) override;
+  };
+
+private:
+  enum class State {
+    k_disconnected,
+    k_connecting,
+    k_connected,
+    // The connection was lost, the transport reconnects automatically (still in progress)
+    k_reconnecting,
+  };
+
+  static std::mutex registry_mutex_;
+  static std::map<std::string, std::weak_ptr<SharedConnection>, std::less<>> registry_;
+
+  std::shared_ptr<Transport> transport_;
+
+  mutable std::mutex mutex_;
+  State state_ = State::k_disconnected;
+  // Endpoints, which called connect() and not disconnect() (they receive all notifications)
+  std::map<const Endpoint *, std::weak_ptr<Endpoint>> connected_;
+  // Wildcard subscriptions of all Endpoints -> QoS, resubscribed on each connect
+  std::map<std::string, int, std::less<>> subscriptions_;
+  // Exact topic -> Endpoint
+  std::unordered_map<std::string, std::weak_ptr<Endpoint>> routes_;
+  // Publish context -> Endpoint, until the publish completed
+  std::unordered_map<void *, std::weak_ptr<Endpoint>> pending_publishes_;
+
+  void detach(Endpoint &endpoint) noexcept(true);
+  void connect(Endpoint &endpoint) noexcept(false);
+  void disconnect(Endpoint &endpoint) noexcept(false);
+  void subscribe(Endpoint &endpoint, const std::string &topic, int qos) noexcept(false);
+  void publish(Endpoint &endpoint, mqtt::const_message_ptr msg, void *context) noexcept(false);
+  void completePublish(void *context, bool delivered) noexcept(false);
+
+  ///
+  ///\brief Run fn for each connected Endpoint (outside of the lock).
+  ///
+  void forEachConnected(const std::function<void(Endpoint &)> &fn) noexcept(false);
+
+  ///
+  ///\brief Get all connected Endpoints, which are still alive (mutex_ has to be locked).
+  ///
+  ///\return std::vector<std::shared_ptr<Endpoint>> the Endpoints
+  ///
+  std::vector<std::shared_ptr<Endpoint>> connectedEndpoints() const noexcept(false);
+
+public:
+  ///
+  ///\brief Construct a new SharedConnection on a Transport. Use attach() for each MqttModule.
+  ///
+  ///\param transport the transport (not connected yet)
+  ///
+  explicit SharedConnection(std::shared_ptr<Transport> transport) noexcept(false);
+
+  ///
+  ///\brief Get the SharedConnection with a key. It is created with the factory, if there is
+  /// none yet. A SharedConnection lives as long as one of its Endpoints.
+  ///
+  ///\param key identifies the connection (i.e. broker and credentials)
+  ///\param factory creates the transport of a new connection
+  ///\return std::shared_ptr<SharedConnection> the connection
+  ///
+  static std::shared_ptr<SharedConnection> acquire(std::string_view key,
+                                                   const TransportFactory &factory) noexcept(false);
+
+  ///
+  ///\brief Get the wildcard subscription, which covers a topic (the serial number level is "+").
+  ///
+  ///\param topic <iface>/<version>/<manufacturer>/<serial>/<topic>
+  ///\return std::string <iface>/<version>/<manufacturer>/+/<topic>
+  ///\throws VDA5050PPInvalidArgument if the topic has no serial number level
+  ///
+  static std::string wildcardOf(std::string_view topic) noexcept(false);
+
+  ///
+  ///\brief Create a new Endpoint on this connection.
+  ///
+  ///\return std::shared_ptr<Transport> the Endpoint
+  ///
+  std::shared_ptr<Transport> attach() noexcept(false);
+
+  void on_failure(const mqtt::token &tkn) override;
+  void on_success(const mqtt::token &tkn) override;
+  void connected(const std::string &cause) override;
+  void connection_lost(const std::string &cause) override;
+  void message_arrived(mqtt::const_message_ptr msg) override;
+  void delivery_complete(mqtt::delivery_token_ptr tok) override;
+};
+
+}  // namespace vda5050pp::core::messages
+
+#endif  // VDA5050_2B_2B_CORE_MESSAGES_SHARED_CONNECTION_H_
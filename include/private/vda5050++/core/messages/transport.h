@@ -0,0 +1,76 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+//
+// This file contains the Transport interface, which carries the messages of the MqttModule
+//
+
+#ifndef VDA5050_2B_2B_CORE_MESSAGES_TRANSPORT_H_
+#define VDA5050_2B_2B_CORE_MESSAGES_TRANSPORT_H_
+
+#include <mqtt/async_client.h>
+
+#include <functional>
+#include <string>
+
+namespace vda5050pp::core::messages {
+
+///
+///\brief The connection, the MqttModule sends and receives its messages with.
+///
+/// The messages themselves are always mqtt::message objects, so the MqttModule does not
+/// care, if they go to a broker (PahoTransport) or stay in the process (LoopbackTransport).
+///
+class Transport {
+public:
+  ///
+  ///\brief Called once a publish completed. The context is the one passed to publish().
+  ///
+  using PublishCompletion = std::function<void(void *context, bool delivered)>;
+
+  virtual ~Transport() = default;
+
+  ///
+  ///\brief Set the receivers of all notifications. Called once, before connect().
+  ///
+  ///\param callback receives connection changes and incoming messages
+  ///\param connect_listener receives the result of each connection attempt (if the transport
+  /// has any)
+  ///\param completion receives completed publishes
+  ///
+  virtual void setCallbacks(mqtt::callback &callback, mqtt::iaction_listener &connect_listener,
+                            PublishCompletion completion) noexcept(false) = 0;
+
+  ///
+  ///\brief Start connecting. callback.connected() is called, once the transport is connected.
+  ///
+  virtual void connect() noexcept(false) = 0;
+
+  ///
+  ///\brief Disconnect and wait until the transport is disconnected.
+  ///
+  virtual void disconnect() noexcept(false) = 0;
+
+  ///
+  ///\brief Subscribe to a topic
+  ///
+  ///\param topic the topic
+  ///\param qos the MQTT QoS of the subscription
+  ///
+  virtual void subscribe(const std::string &topic, int qos) noexcept(false) = 0;
+
+  ///
+  ///\brief Publish a message
+  ///
+  ///\param msg the message
+  ///\param context passed to the PublishCompletion, once the publish completed
+  ///
+  virtual void publish(mqtt::const_message_ptr msg, void *context) noexcept(false) = 0;
+};
+
+}  // namespace vda5050pp::core::messages
+
+#endif  // VDA5050_2B_2B_CORE_MESSAGES_TRANSPORT_H_
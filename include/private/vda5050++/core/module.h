@@ -27,7 +27,9 @@ public:
 };
 
 template <typename M, auto &key> struct AutoRegisterModule {
-  AutoRegisterModule() { Instance::registerModule(key, std::make_shared<M>()); }
+  AutoRegisterModule() {
+    Instance::registerModuleFactory(key, [] { return std::make_shared<M>(); });
+  }
 };
 
 }  // namespace vda5050pp::core
@@ -8,22 +8,23 @@
 #ifndef PRIVATE_VDA5050_2B_2B_CORE_NAVIGATION_EVENT_MANAGER_H_
 #define PRIVATE_VDA5050_2B_2B_CORE_NAVIGATION_EVENT_MANAGER_H_
 
-#include <eventpp/eventqueue.h>
 #include <eventpp/utilities/scopedremover.h>
 
 #include <functional>
 #include <memory>
 
 #include "vda5050++/config/event_manager_options.h"
-#include "vda5050++/core/common/scoped_thread.h"
+#include "vda5050++/core/common/event_queue_policy.h"
+#include "vda5050++/core/common/event_statistics.h"
+#include "vda5050++/core/common/queue_processor.h"
 #include "vda5050++/events/navigation_event.h"
 #include "vda5050++/events/scoped_navigation_event_subscriber.h"
 
 namespace vda5050pp::core {
 
 using NavigationEventQueue =
-    eventpp::EventQueue<vda5050pp::events::NavigationEventType,
-                        void(std::shared_ptr<vda5050pp::events::NavigationEvent>)>;
+    common::DefaultQueuePolicy::Queue<vda5050pp::events::NavigationEventType,
+                                      std::shared_ptr<vda5050pp::events::NavigationEvent>>;
 class ScopedNavigationEventSubscriber : public vda5050pp::events::ScopedNavigationEventSubscriber {
 private:
   friend class NavigationEventManager;
@@ -46,16 +47,20 @@ public:
 
 class NavigationEventManager {
 private:
+  vda5050pp::core::common::EventStatisticsRecorder statistics_recorder_;
   NavigationEventQueue navigation_event_queue_;
 
   const vda5050pp::config::EventManagerOptions &opts_;
 
-  vda5050pp::core::common::ScopedThread<void()> thread_;
+  vda5050pp::core::common::QueueProcessor processor_;
 
-  void threadTask(vda5050pp::core::common::StopToken tkn) noexcept(true);
+  void processQueue() noexcept(true);
 
 public:
-  explicit NavigationEventManager(const vda5050pp::config::EventManagerOptions &opts);
+  explicit NavigationEventManager(
+      const vda5050pp::config::EventManagerOptions &opts,
+      std::shared_ptr<vda5050pp::core::common::WorkerPool> worker_pool = nullptr,
+      Instance *instance = nullptr);
 
   void dispatch(std::shared_ptr<vda5050pp::events::NavigationHorizonUpdate> data) noexcept(true);
   void dispatch(std::shared_ptr<vda5050pp::events::NavigationBaseIncreased> data) noexcept(true);
@@ -64,6 +69,9 @@ public:
   void dispatch(std::shared_ptr<vda5050pp::events::NavigationControl> data) noexcept(true);
 
   ScopedNavigationEventSubscriber getScopedNavigationEventSubscriber() noexcept(true);
+
+  const vda5050pp::core::common::EventStatisticsRecorder &getStatisticsRecorder() const
+      noexcept(true);
 };
 
 }  // namespace vda5050pp::core
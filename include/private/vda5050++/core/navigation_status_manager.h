@@ -8,29 +8,42 @@
 #ifndef PRIVATE_VDA5050_2B_2B_CORE_NAVIGATION_STATUS_MANAGER_H_
 #define PRIVATE_VDA5050_2B_2B_CORE_NAVIGATION_STATUS_MANAGER_H_
 
-#include <eventpp/eventqueue.h>
+#include <eventpp/eventdispatcher.h>
 #include <eventpp/utilities/scopedremover.h>
 
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <thread>
 
 #include "vda5050++/config/event_manager_options.h"
-#include "vda5050++/core/common/scoped_thread.h"
+#include "vda5050++/core/common/event_queue_policy.h"
+#include "vda5050++/core/common/event_statistics.h"
+#include "vda5050++/core/common/queue_processor.h"
 #include "vda5050++/events/navigation_event.h"
 
 namespace vda5050pp::core {
 
 using NavigationStatusQueue =
-    eventpp::EventQueue<vda5050pp::events::NavigationStatusType,
-                        void(std::shared_ptr<vda5050pp::events::NavigationStatus>)>;
+    common::DefaultQueuePolicy::Queue<vda5050pp::events::NavigationStatusType,
+                                      std::shared_ptr<vda5050pp::events::NavigationStatus>>;
+
+///
+///\brief Dispatches the latest NavigationStatusPosition and NavigationStatusVelocity events.
+/// They are forwarded from the NavigationStatusQueue, after coalescing (if enabled).
+///
+using NavigationStatusLatestValueDispatcher =
+    eventpp::EventDispatcher<vda5050pp::events::NavigationStatusType,
+                             void(std::shared_ptr<vda5050pp::events::NavigationStatus>)>;
 
 class ScopedNavigationStatusSubscriber {
 private:
   friend class NavigationStatusManager;
   eventpp::ScopedRemover<NavigationStatusQueue> remover_;
+  eventpp::ScopedRemover<NavigationStatusLatestValueDispatcher> latest_value_remover_;
 
-  explicit ScopedNavigationStatusSubscriber(NavigationStatusQueue &queue);
+  ScopedNavigationStatusSubscriber(NavigationStatusQueue &queue,
+                                   NavigationStatusLatestValueDispatcher &latest_value_dispatcher);
 
 public:
   void subscribe(std::function<void(std::shared_ptr<vda5050pp::events::NavigationStatusPosition>)>
@@ -51,16 +64,29 @@ public:
 
 class NavigationStatusManager {
 private:
+  vda5050pp::core::common::EventStatisticsRecorder statistics_recorder_;
   NavigationStatusQueue navigation_status_queue_;
+  NavigationStatusLatestValueDispatcher latest_value_dispatcher_;
 
   const vda5050pp::config::EventManagerOptions &opts_;
 
-  vda5050pp::core::common::ScopedThread<void()> thread_;
+  std::mutex latest_value_mutex_;
+  std::shared_ptr<vda5050pp::events::NavigationStatusPosition> pending_position_;
+  std::shared_ptr<vda5050pp::events::NavigationStatusVelocity> pending_velocity_;
+
+  vda5050pp::core::common::QueueProcessor processor_;
+
+  void processQueue() noexcept(true);
 
-  void threadTask(vda5050pp::core::common::StopToken tkn) noexcept(true);
+  void onDropped(vda5050pp::events::NavigationStatusType type) noexcept(true);
+
+  bool coalescing() const noexcept(true);
 
 public:
-  explicit NavigationStatusManager(const vda5050pp::config::EventManagerOptions &opts);
+  explicit NavigationStatusManager(
+      const vda5050pp::config::EventManagerOptions &opts,
+      std::shared_ptr<vda5050pp::core::common::WorkerPool> worker_pool = nullptr,
+      Instance *instance = nullptr);
 
   void dispatch(std::shared_ptr<vda5050pp::events::NavigationStatusPosition> data) noexcept(true);
   void dispatch(std::shared_ptr<vda5050pp::events::NavigationStatusVelocity> data) noexcept(true);
@@ -72,6 +98,9 @@ public:
   void dispatch(std::shared_ptr<vda5050pp::events::NavigationStatusControl> data) noexcept(true);
 
   ScopedNavigationStatusSubscriber getScopedNavigationStatusSubscriber() noexcept(true);
+
+  const vda5050pp::core::common::EventStatisticsRecorder &getStatisticsRecorder() const
+      noexcept(true);
 };
 
 }  // namespace vda5050pp::core
@@ -8,7 +8,6 @@
 #ifndef PRIVATE_VDA5050_2B_2B_CORE_QUERY_EVENT_MANAGER_H_
 #define PRIVATE_VDA5050_2B_2B_CORE_QUERY_EVENT_MANAGER_H_
 
-#include <eventpp/eventqueue.h>
 #include <eventpp/utilities/scopedremover.h>
 
 #include <functional>
@@ -16,14 +15,17 @@
 #include <thread>
 
 #include "vda5050++/config/event_manager_options.h"
-#include "vda5050++/core/common/scoped_thread.h"
+#include "vda5050++/core/common/event_queue_policy.h"
+#include "vda5050++/core/common/event_statistics.h"
+#include "vda5050++/core/common/queue_processor.h"
 #include "vda5050++/events/query_event.h"
 #include "vda5050++/events/scoped_query_event_subscriber.h"
 
 namespace vda5050pp::core {
 
-using QueryEventQueue = eventpp::EventQueue<vda5050pp::events::QueryEventType,
-                                            void(std::shared_ptr<vda5050pp::events::QueryEvent>)>;
+using QueryEventQueue =
+    common::DefaultQueuePolicy::Queue<vda5050pp::events::QueryEventType,
+                                      std::shared_ptr<vda5050pp::events::QueryEvent>>;
 class ScopedQueryEventSubscriber : public vda5050pp::events::ScopedQueryEventSubscriber {
 private:
   friend class QueryEventManager;
@@ -42,16 +44,20 @@ public:
 
 class QueryEventManager {
 private:
+  vda5050pp::core::common::EventStatisticsRecorder statistics_recorder_;
   QueryEventQueue query_event_queue_;
 
   const vda5050pp::config::EventManagerOptions &opts_;
 
-  vda5050pp::core::common::ScopedThread<void()> thread_;
+  vda5050pp::core::common::QueueProcessor processor_;
 
-  void threadTask(vda5050pp::core::common::StopToken tkn) noexcept(true);
+  void processQueue() noexcept(true);
 
 public:
-  explicit QueryEventManager(const vda5050pp::config::EventManagerOptions &opts);
+  explicit QueryEventManager(
+      const vda5050pp::config::EventManagerOptions &opts,
+      std::shared_ptr<vda5050pp::core::common::WorkerPool> worker_pool = nullptr,
+      Instance *instance = nullptr);
 
   void dispatch(std::shared_ptr<vda5050pp::events::QueryPauseable> data,
                 bool synchronous = false) noexcept(true);
@@ -61,6 +67,9 @@ public:
                 bool synchronous = false) noexcept(true);
 
   ScopedQueryEventSubscriber getScopedQueryEventSubscriber() noexcept(true);
+
+  const vda5050pp::core::common::EventStatisticsRecorder &getStatisticsRecorder() const
+      noexcept(true);
 };
 
 }  // namespace vda5050pp::core
@@ -16,6 +16,7 @@
 
 #include "vda5050++/core/common/math/linear_path_length_calculator.h"
 #include "vda5050++/core/state/graph.h"
+#include "vda5050++/core/state/state_revisions.h"
 #include "vda5050++/misc/order_status.h"
 #include "vda5050/ActionState.h"
 #include "vda5050/Error.h"
@@ -35,6 +36,8 @@ private:
   std::map<std::string, std::shared_ptr<vda5050::Action>, std::less<>> action_by_id_;
   std::map<std::string, std::shared_ptr<vda5050::ActionState>, std::less<>> action_state_by_id_;
   vda5050pp::misc::OrderStatus order_status_ = vda5050pp::misc::OrderStatus::k_order_idle;
+  uint64_t graph_revision_ = nextStateRevision();
+  uint64_t action_states_revision_ = nextStateRevision();
 
   inline bool invalidLock(const std::unique_lock<std::mutex> &lock) const {
     return lock.mutex() != &this->mutex_ || !lock.owns_lock();
@@ -60,6 +63,8 @@ public:
   std::shared_ptr<vda5050::Action> tryGetAction(std::string_view action_id);
   std::shared_ptr<vda5050::ActionState> getActionState(std::string_view action_id) noexcept(false);
   std::shared_ptr<vda5050::ActionState> tryGetActionState(std::string_view action_id);
+  void setActionStatus(std::string_view action_id, vda5050::ActionStatus action_status,
+                       const std::optional<std::string> &result) noexcept(false);
   std::pair<GraphElement::SequenceId, GraphElement::SequenceId> extendGraph(
       Graph &&extension) noexcept(false);
   std::pair<GraphElement::SequenceId, GraphElement::SequenceId> extendGraph(
@@ -70,6 +75,7 @@ public:
   void setAGVLastNode(uint32_t seq_id) noexcept(false);
   bool setAGVLastNodeId(std::string_view last_node_id) noexcept(false);
   void dumpTo(vda5050::State &state) const;
+  void dumpTo(vda5050::State &state, StateRevisions &revisions) const;
   void clearGraph();
   void cancelWaitingActions();
   void clearActions();
@@ -0,0 +1,48 @@
+//  Copyright Open Logistics Foundation
+//
+//  Licensed under the Open Logistics Foundation License 1.3.
+//  For details on the licensing terms, see the LICENSE file.
+//  SPDX-License-Identifier: OLFL-1.3
+//
+
+#ifndef VDA5050_2B_2B_CORE_STATE_STATE_REVISIONS_H_
+#define VDA5050_2B_2B_CORE_STATE_STATE_REVISIONS_H_
+
+#include <atomic>
+#include <cstdint>
+
+namespace vda5050pp::core::state {
+
+///
+///\brief The revisions of the rarely changing parts of a State message.
+///
+/// Each change of a part is assigned a new, process-wide unique revision (see
+/// nextStateRevision()), so equal revisions imply equal contents. The revision 0 is unknown and
+/// never matches.
+///
+struct StateRevisions {
+  /// \brief The revision of the nodeStates and edgeStates
+  uint64_t graph = 0;
+  /// \brief The revision of the actionStates
+  uint64_t action_states = 0;
+  /// \brief The revision of the loads
+  uint64_t loads = 0;
+  /// \brief The revision of the errors
+  uint64_t errors = 0;
+  /// \brief The revision of the information
+  uint64_t information = 0;
+};
+
+///
+///\brief Get a new, process-wide unique state revision (never 0).
+///
+///\return uint64_t the revision
+///
+inline uint64_t nextStateRevision() noexcept(true) {
+  static std::atomic<uint64_t> last_revision = 0;
+  return last_revision.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+}  // namespace vda5050pp::core::state
+
+#endif  // VDA5050_2B_2B_CORE_STATE_STATE_REVISIONS_H_
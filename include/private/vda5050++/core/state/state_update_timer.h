@@ -8,12 +8,15 @@
 #ifndef VDA5050_2B_2B_CORE_STATE_STATE_UPDATE_TIMER_H_
 #define VDA5050_2B_2B_CORE_STATE_STATE_UPDATE_TIMER_H_
 
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <cstdint>
+#include <limits>
 #include <memory>
+#include <mutex>
 #include <optional>
 
-#include "vda5050++/core/common/interruptable_timer.h"
 #include "vda5050++/core/common/scoped_thread.h"
 #include "vda5050++/core/module.h"
 #include "vda5050++/core/state/state_update_urgency.h"
@@ -24,6 +27,10 @@ namespace vda5050pp::core::state {
 /// \brief The StateUpdateTimer Class has a thread, that periodically sends a new state.
 /// Upon requests this period might be decreased.
 ///
+/// Requests are coalesced into a single "earliest deadline" slot. The timer thread is only woken
+/// up, if a request moves the deadline before the currently armed wakeup time point, so a burst
+/// of requests results in a single published state.
+///
 class StateUpdateTimer : public vda5050pp::core::Module {
 private:
   using TimePointT = std::chrono::system_clock::time_point;
@@ -33,18 +40,33 @@ private:
       vda5050pp::core::GenericEventManager<vda5050pp::core::events::StateEvent>::ScopedSubscriber>
       state_subscriber_;
 
-  vda5050pp::core::common::InterruptableTimer timer_;     // Must be destroyed after thread_
-  vda5050pp::core::common::ScopedThread<void()> thread_;  // Must be destroyed before timer_
+  static constexpr DurationT::rep k_no_deadline = std::numeric_limits<DurationT::rep>::max();
+
+  std::mutex wakeup_mutex_;                               // Must be destroyed after thread_
+  std::condition_variable wakeup_cv_;                     // Must be destroyed after thread_
+  vda5050pp::core::common::ScopedThread<void()> thread_;  // Must be destroyed before wakeup_*
+
+  TimePointT last_sent_;  // Guarded by wakeup_mutex_
 
-  TimePointT last_sent_;
-  std::optional<TimePointT> next_scheduled_update_;
+  vda5050pp::core::Instance *instance_ = nullptr;  // Bound by the timer thread
+
+  /// The earliest requested update (time since epoch), k_no_deadline if there is none
+  std::atomic<DurationT::rep> next_deadline_ = k_no_deadline;
+  /// The time point (since epoch), the timer thread currently sleeps until
+  std::atomic<DurationT::rep> armed_wakeup_ = k_no_deadline;
+  /// The number of requests since the last published state
+  std::atomic<uint32_t> pending_requests_ = 0;
+  /// The number of requests merged into the last published state
+  std::atomic<uint32_t> last_merged_requests_ = 0;
 
   void timerRoutine(vda5050pp::core::common::StopToken stop_token);
 
   void handleRequestStateUpdateEvent(
       std::shared_ptr<vda5050pp::core::events::RequestStateUpdateEvent> data) noexcept(false);
 
-  void doStateUpdate() const;
+  void publishState();
+
+  void doStateUpdate(uint32_t merged_requests) const;
 
 public:
   StateUpdateTimer();
@@ -60,6 +82,13 @@ public:
   /// \param urgency the urgency of the request
   ///
   void requestUpdate(StateUpdateUrgency urgency) noexcept(true);
+
+  ///
+  /// \brief Get the number of update requests, which were merged into the last published state.
+  ///
+  /// \return uint32_t the number of requests
+  ///
+  uint32_t getLastMergedRequests() const noexcept(true);
 };
 
 }  // namespace vda5050pp::core::state
@@ -23,6 +23,7 @@
 #include <string>
 
 #include "vda5050++/core/common/type_traits.h"
+#include "vda5050++/core/state/state_revisions.h"
 
 namespace vda5050pp::core::state {
 
@@ -41,6 +42,9 @@ private:
   std::optional<vda5050::Velocity> velocity_;
   bool driving_ = false;
   std::optional<double> distance_since_last_node_;
+  uint64_t loads_revision_ = nextStateRevision();
+  uint64_t errors_revision_ = nextStateRevision();
+  uint64_t information_revision_ = nextStateRevision();
 
 public:
   void setAGVPosition(const vda5050::AGVPosition &agv_position);
@@ -78,6 +82,7 @@ public:
     }
 
     alter_function(*this->loads_);
+    this->loads_revision_ = nextStateRevision();
     return true;
   }
 
@@ -115,6 +120,7 @@ public:
                   "Expected type void(std::vector<vda5050::Error> &)");
     std::unique_lock lock(this->mutex_);
     alter_function(this->errors_);
+    this->errors_revision_ = nextStateRevision();
     return true;
   }
 
@@ -127,9 +133,11 @@ public:
         "Expected type void(std::vector<vda5050::Info> &)");
     std::unique_lock lock(this->mutex_);
     alter_function(this->information_);
+    this->information_revision_ = nextStateRevision();
   }
 
   void dumpTo(vda5050::State &state);
+  void dumpTo(vda5050::State &state, StateRevisions &revisions);
 };
 
 }  // namespace vda5050pp::core::state
@@ -22,6 +22,7 @@ private:
   vda5050pp::core::common::InterruptableTimer timer_;
   vda5050pp::core::common::ScopedThread<void()> thread_;
   std::chrono::system_clock::duration update_period_;
+  vda5050pp::core::Instance *instance_ = nullptr;  // Bound by the timer thread
 
 protected:
   void sendVisualization() const;
@@ -8,20 +8,22 @@
 #ifndef PRIVATE_VDA5050_2B_2B_CORE_STATUS_EVENT_MANAGER_H_
 #define PRIVATE_VDA5050_2B_2B_CORE_STATUS_EVENT_MANAGER_H_
 
-#include <eventpp/eventqueue.h>
 #include <eventpp/utilities/scopedremover.h>
 
 #include <functional>
 #include <memory>
 
 #include "vda5050++/config/event_manager_options.h"
-#include "vda5050++/core/common/scoped_thread.h"
+#include "vda5050++/core/common/event_queue_policy.h"
+#include "vda5050++/core/common/event_statistics.h"
+#include "vda5050++/core/common/queue_processor.h"
 #include "vda5050++/events/status_event.h"
 
 namespace vda5050pp::core {
 
-using StatusEventQueue = eventpp::EventQueue<vda5050pp::events::StatusEventType,
-                                             void(std::shared_ptr<vda5050pp::events::StatusEvent>)>;
+using StatusEventQueue =
+    common::DefaultQueuePolicy::Queue<vda5050pp::events::StatusEventType,
+                                      std::shared_ptr<vda5050pp::events::StatusEvent>>;
 class ScopedStatusEventSubscriber {
 private:
   friend class StatusEventManager;
@@ -64,21 +66,28 @@ public:
 
 class StatusEventManager {
 private:
+  vda5050pp::core::common::EventStatisticsRecorder statistics_recorder_;
   StatusEventQueue status_event_queue_;
 
   const vda5050pp::config::EventManagerOptions &opts_;
 
-  vda5050pp::core::common::ScopedThread<void()> thread_;
+  vda5050pp::core::common::QueueProcessor processor_;
 
-  void threadTask(vda5050pp::core::common::StopToken tkn) noexcept(true);
+  void processQueue() noexcept(true);
 
 public:
-  explicit StatusEventManager(const vda5050pp::config::EventManagerOptions &opts);
+  explicit StatusEventManager(
+      const vda5050pp::config::EventManagerOptions &opts,
+      std::shared_ptr<vda5050pp::core::common::WorkerPool> worker_pool = nullptr,
+      Instance *instance = nullptr);
 
   void dispatch(std::shared_ptr<vda5050pp::events::StatusEvent> data,
                 bool synchronous = false) noexcept(false);
 
   ScopedStatusEventSubscriber getScopedStatusEventSubscriber() noexcept(true);
+
+  const vda5050pp::core::common::EventStatisticsRecorder &getStatisticsRecorder() const
+      noexcept(true);
 };
 
 }  // namespace vda5050pp::core
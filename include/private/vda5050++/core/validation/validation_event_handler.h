@@ -8,8 +8,12 @@
 #ifndef VDA5050_2B_2B_CORE_VALIDATION_VALIDATION_EVENT_HANDLER_H_
 #define VDA5050_2B_2B_CORE_VALIDATION_VALIDATION_EVENT_HANDLER_H_
 
+#include <list>
+#include <memory>
 #include <optional>
+#include <vector>
 
+#include "vda5050++/core/common/coroutine.h"
 #include "vda5050++/core/events/validation_event.h"
 #include "vda5050++/core/module.h"
 
@@ -22,6 +26,23 @@ private:
       subscriber_;
 
   void handleValidateOrder(std::shared_ptr<vda5050pp::core::events::ValidateOrderEvent> evt) const;
+#ifdef LIBVDA5050PP_COROUTINES
+  vda5050pp::core::common::Task validateOrder(
+      std::shared_ptr<vda5050pp::core::events::ValidateOrderEvent> evt,
+      vda5050pp::events::SynchronizedEventToken<vda5050pp::core::events::ValidationResult>
+          result_token) const;
+#endif
+  std::list<vda5050::Error> checkOrder(const vda5050::Order &order) const;
+  std::list<vda5050::Error> validateOrderActions(const vda5050::Order &order) const;
+
+  ///
+  ///\brief Dispatch ActionValidate events synchronously. With parallel_action_validation, they
+  /// are dispatched in parallel on the worker pool.
+  ///
+  ///\param events the events (their results are set, when this returns)
+  ///
+  void dispatchActionValidates(
+      const std::vector<std::shared_ptr<vda5050pp::events::ActionValidate>> &events) const;
   void handleValidateInstantActions(
       std::shared_ptr<vda5050pp::core::events::ValidateInstantActionsEvent> evt) const;
 
@@ -24,6 +24,20 @@ struct SimpleProtocolLimits {
   std::optional<bool> id_numerical_only;
   std::optional<uint32_t> max_load_id_len;
   std::optional<uint32_t> max_loads;
+  /// Maximum size of a received message in bytes
+  std::optional<uint32_t> max_message_len;
+  /// Maximum number of nodes of a received order
+  std::optional<uint32_t> max_order_nodes;
+  /// Maximum number of edges of a received order
+  std::optional<uint32_t> max_order_edges;
+  /// Maximum number of actions of a received node
+  std::optional<uint32_t> max_node_actions;
+  /// Maximum number of actions of a received edge
+  std::optional<uint32_t> max_edge_actions;
+  /// Maximum number of actions of a received instantActions message
+  std::optional<uint32_t> max_instant_actions;
+  /// Maximum number of parameters of a received action
+  std::optional<uint32_t> max_action_parameters;
 };
 
 }  // namespace vda5050pp::agv_description
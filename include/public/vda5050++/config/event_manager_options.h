@@ -8,14 +8,99 @@
 #ifndef PUBLIC_VDA5050_2B_2B_CONFIG_EVENT_MANAGER_OPTIONS_H_
 #define PUBLIC_VDA5050_2B_2B_CONFIG_EVENT_MANAGER_OPTIONS_H_
 
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+
 namespace vda5050pp::config {
 
+///
+///\brief What to do with an event, which is enqueued into a full event queue.
+///
+enum class QueueOverflowPolicy {
+  ///\brief Wait until the queue has space. Threads, which are currently processing events of any
+  /// EventManager, never wait (to avoid deadlocks) and exceed the capacity instead. This is
+  /// logged and counted as overrun (see vda5050pp::observer::EventStatistics::overrun).
+  k_block,
+  ///\brief Drop the oldest pending event of the queue.
+  k_drop_oldest,
+  ///\brief Drop the new event.
+  k_drop_newest,
+  ///\brief Replace the newest pending event with the same type. If there is none, the new event
+  /// is dropped.
+  k_coalesce,
+};
+
+///
+///\brief The capacity limit of an EventManager queue.
+///
+struct QueueLimit {
+  ///\brief The maximum number of pending events (0: unbounded).
+  std::size_t capacity = 0;
+
+  ///\brief What to do if the queue is full.
+  QueueOverflowPolicy policy = QueueOverflowPolicy::k_block;
+};
+
 ///
 ///\brief The EventManagerOptions struct contains all common settings for the internal
 /// EventManagers.
 ///
 struct EventManagerOptions {
+  ///\brief The minimum number of workers of a pool. A message waits for its validation, which
+  /// waits for queries, each on a worker of its own.
+  static constexpr std::size_t k_min_worker_pool_size = 3;
+
+  ///\brief Disable all internal event processing workers, use direct dispatch only.
   bool synchronous_event_dispatch = false;
+
+  ///\brief The number of workers shared by all EventManagers. Each EventManager is processed
+  /// in order on a strand of this pool. If 0, each EventManager uses it's own worker.
+  /// Note: some internal handlers block their worker while waiting for the result of another
+  /// EventManager, so the pool has at least k_min_worker_pool_size workers (smaller values are
+  /// raised). A pool shared by multiple Instances should have 2 more workers per Instance.
+  std::size_t worker_pool_size = 0;
+
+  ///\brief Share the worker pool with all other Instances in the process, which enable this
+  /// option (see Handle::createInstance()). The pool is created with the worker_pool_size of the
+  /// first Instance. Has no effect, if worker_pool_size is 0.
+  bool share_worker_pool = false;
+
+  ///\brief Only process the latest NavigationStatusPosition and NavigationStatusVelocity.
+  /// Samples, which are superseded before they were processed, are dropped. The newest sample
+  /// checks for a reached node, if any dropped sample requested it. The result of a dropped
+  /// sample is false. If a queue limit drops the wakeup of a pending sample, the sample is dropped
+  /// as well, such that the next sample is processed again.
+  bool coalesce_navigation_status = false;
+
+  ///\brief Validate the actions of an order in parallel on the worker pool. The ActionValidate
+  /// subscribers are called concurrently, action handlers only, if they are thread-safe (see
+  /// BaseActionHandler::isThreadSafe()). Has no effect, if worker_pool_size is 0.
+  bool parallel_action_validation = false;
+
+  ///\brief The queue limit of all EventManagers, which are not listed in queue_limits.
+  /// Dropped events with a result (i.e. ActionValidate) are never resolved, use with care.
+  /// Control events (i.e. cancel, pause) are never limited.
+  QueueLimit default_queue_limit;
+
+  ///\brief The queue limit per EventManager name (i.e. "MessageEventManager",
+  /// "StatusEventManager"), see vda5050pp::observer::EventStatistics::manager.
+  std::map<std::string, QueueLimit, std::less<>> queue_limits;
+
+  ///
+  ///\brief Get the queue limit of an EventManager
+  ///
+  ///\param manager the name of the EventManager
+  ///\return const QueueLimit& the limit of the manager or the default_queue_limit
+  ///
+  const QueueLimit &getQueueLimit(std::string_view manager) const {
+    if (auto it = this->queue_limits.find(manager); it != this->queue_limits.end()) {
+      return it->second;
+    }
+    return this->default_queue_limit;
+  }
 };
 
 }  // namespace vda5050pp::config
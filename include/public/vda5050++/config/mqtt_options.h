@@ -9,10 +9,29 @@
 #define PUBLIC_VDA5050_2B_2B_CONFIG_MQTT_OPTIONS_H_
 
 #include <chrono>
+#include <cstddef>
 #include <optional>
 #include <string>
 
 namespace vda5050pp::config {
+///
+///\brief The MQTT QoS level (0, 1 or 2) used for each topic.
+///
+struct MqttTopicQos {
+  ///\brief QoS of sent connection messages (and the last will)
+  int connection = 0;
+  ///\brief QoS of sent factsheet messages
+  int factsheet = 0;
+  ///\brief QoS of the instantActions subscription
+  int instant_actions = 0;
+  ///\brief QoS of the order subscription
+  int order = 0;
+  ///\brief QoS of sent state messages
+  int state = 0;
+  ///\brief QoS of sent visualization messages
+  int visualization = 0;
+};
+
 ///
 ///\brief Configuration struct for the MqttConnector.
 ///
@@ -39,6 +58,36 @@ struct MqttOptions {
   std::optional<std::chrono::system_clock::duration> keep_alive_interval_;
   ///\brief Timeout duration during connect
   std::optional<std::chrono::system_clock::duration> connect_timeout_;
+  ///\brief Number of threads decoding received messages (0 decodes on the MQTT callback thread)
+  std::size_t decode_workers = 2;
+  ///\brief Keep the latest state, visualization, factsheet and connection message while offline
+  /// and send them right after reconnecting
+  bool offline_buffering = true;
+  ///\brief Drop buffered messages older than this instead of sending them after reconnecting
+  std::optional<std::chrono::system_clock::duration> offline_max_age_;
+  ///\brief QoS level of each topic
+  MqttTopicQos qos;
+  ///\brief Store QoS 1/2 messages in this directory until they are acknowledged
+  /// (in memory, if not set)
+  std::optional<std::string> persistence_dir;
+  ///\brief Max number of QoS 1/2 messages, which are in flight at the same time
+  std::optional<int> max_inflight;
+  ///\brief Max number of messages paho queues while (re)connecting, the oldest one is dropped
+  /// when exceeded (paho does not queue, if not set)
+  std::optional<int> max_buffered_messages;
+  ///\brief MQTT protocol version (3: v3.1, 4: v3.1.1, 5: v5)
+  int mqtt_version = 4;
+  ///\brief Send state and visualization messages with topic aliases (MQTT 5 only, as far as the
+  /// broker allows topic aliases). Only QoS 0 messages use aliases, and none are used with a
+  /// persistence_dir or max_buffered_messages, since paho may resend these messages on a new
+  /// connection.
+  bool topic_aliases = true;
+  ///\brief Let the broker discard visualization messages, which were not delivered within this
+  /// time (MQTT 5 only, rounded up to seconds)
+  std::optional<std::chrono::system_clock::duration> visualization_ttl_;
+  ///\brief Share one connection with all instances of the process, which use the same server,
+  /// username and MQTT version (there is no last will and no topic aliases on it)
+  bool shared_connection = false;
 };
 
 }  // namespace vda5050pp::config
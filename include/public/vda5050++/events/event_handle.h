@@ -15,6 +15,10 @@
 #include "vda5050++/events/scoped_query_event_subscriber.h"
 #include "vda5050++/events/status_event.h"
 
+namespace vda5050pp::core {
+class Instance;
+}  // namespace vda5050pp::core
+
 namespace vda5050pp::events {
 
 ///
@@ -22,7 +26,16 @@ namespace vda5050pp::events {
 /// vda5050pp::handler and vda505pp::sinks).
 ///
 class EventHandle {
+private:
+  // The instance bound at construction (empty: the default instance)
+  std::weak_ptr<vda5050pp::core::Instance> instance_;
+
 public:
+  ///
+  ///\brief Construct a new EventHandle for the instance bound to the calling thread
+  /// (see vda5050pp::Handle::bind()) or, if there is none, the default instance.
+  ///
+  EventHandle() noexcept(true);
   ///
   ///\brief Is this EventHandle valid i.e. is the library initialized?
   ///
@@ -8,11 +8,23 @@
 #ifndef PUBLIC_VDA5050_2B_2B_EVENTS_SYNCHRONIZED_EVENT_H_
 #define PUBLIC_VDA5050_2B_2B_EVENTS_SYNCHRONIZED_EVENT_H_
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <exception>
 #include <future>
 #include <memory>
-#include <mutex>
+#include <optional>
+
+#ifdef LIBVDA5050PP_COROUTINES
+#if !defined(__cpp_impl_coroutine)
+#error "LIBVDA5050PP_COROUTINES requires a compiler with C++20 coroutine support"
+#endif
+#include <coroutine>
+#endif
 
 #include "vda5050++/exception.h"
+#include "vda5050++/misc/pool_allocator.h"
 
 namespace vda5050pp::events {
 
@@ -20,25 +32,365 @@ namespace vda5050pp::events {
 template <typename ResultT> class SynchronizedEvent;
 
 ///
-///\brief The result state shared amongst all event tokens.
+///\brief The type independent part of the result state shared amongst all event tokens and the
+/// future. It is a single-shot cell, which is driven by one atomic state word. Waiters sleep on
+/// the state word itself (futex on linux), the producer only issues a wake syscall, if there is
+/// a sleeping waiter.
+///
+struct _SharedResultStateBase {
+  static constexpr uint32_t k_empty = 0;
+  static constexpr uint32_t k_acquired = 1;
+  static constexpr uint32_t k_value = 2;
+  static constexpr uint32_t k_exception = 3;
+  static constexpr uint32_t k_status_mask = 3;
+  static constexpr uint32_t k_waiting = 4;
+  static constexpr uint32_t k_continuation = 8;
+
+  ///
+  ///\brief The state word (status | k_waiting)
+  ///
+  std::atomic<uint32_t> state{k_empty};
+
+  ///
+  ///\brief Was the future already retrieved?
+  ///
+  std::atomic_bool retrieved{false};
+
+  ///
+  ///\brief The number of producers, i.e. events and acquired tokens referring to this state.
+  ///
+  std::atomic<uint32_t> producers{0};
+
+  ///
+  ///\brief The exception, which is set in place of a value.
+  ///
+  std::exception_ptr exception;
+
+  ///
+  ///\brief Called by the publishing thread, if k_continuation is set (used by awaiters).
+  ///
+  void (*continuation)(void *) = nullptr;
+
+  ///
+  ///\brief The argument passed to the continuation.
+  ///
+  void *continuation_arg = nullptr;
+
+  ///
+  ///\brief Block until the state word is not equal to expected anymore or the deadline passed.
+  /// Spurious wake ups are possible.
+  ///
+  ///\param word the word to wait on
+  ///\param expected the expected value of the word
+  ///\param deadline the deadline (nullptr for none)
+  ///
+  static void waitOnWord(std::atomic<uint32_t> &word, uint32_t expected,
+                         const std::chrono::steady_clock::time_point *deadline) noexcept(true);
+
+  ///
+  ///\brief Wake all threads waiting on the word.
+  ///
+  ///\param word the word
+  ///
+  static void wakeWord(std::atomic<uint32_t> &word) noexcept(true);
+
+  ///
+  ///\brief Try to acquire the state, i.e. get exclusive write access.
+  ///
+  ///\return was the state acquired?
+  ///
+  bool tryAcquire() noexcept(true) {
+    auto s = this->state.load(std::memory_order_relaxed);
+    while ((s & k_status_mask) == k_empty) {
+      if (this->state.compare_exchange_weak(s, (s & ~k_status_mask) | k_acquired,
+                                            std::memory_order_acquire,
+                                            std::memory_order_relaxed)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  ///
+  ///\brief Give up an acquisition without setting a result. Does nothing if there is no
+  /// acquisition (anymore).
+  ///
+  void unacquire() noexcept(true) {
+    auto s = this->state.load(std::memory_order_relaxed);
+    while ((s & k_status_mask) == k_acquired) {
+      if (this->state.compare_exchange_weak(s, s & ~k_status_mask, std::memory_order_release,
+                                            std::memory_order_relaxed)) {
+        return;
+      }
+    }
+  }
+
+  ///
+  ///\brief Is the state acquired, i.e. can a result be set?
+  ///
+  ///\return is acquired?
+  ///
+  bool isAcquired() const noexcept(true) {
+    return (this->state.load(std::memory_order_relaxed) & k_status_mask) == k_acquired;
+  }
+
+  ///
+  ///\brief Publish the result (value or exception) and wake up all waiters, if there are any.
+  /// The state must be acquired.
+  ///
+  ///\param status k_value or k_exception
+  ///
+  void publish(uint32_t status) noexcept(true) {
+    auto old = this->state.exchange(status, std::memory_order_acq_rel);
+    if (old & k_waiting) {
+      wakeWord(this->state);
+    }
+    if (old & k_continuation) {
+      this->continuation(this->continuation_arg);
+    }
+  }
+
+  ///
+  ///\brief Register a continuation, which is called once by the publishing thread.
+  /// At most one continuation can be registered.
+  ///
+  ///\param fn the continuation
+  ///\param arg the argument of the continuation
+  ///\return false if the result is already ready (the continuation will not be called)
+  ///
+  bool setContinuation(void (*fn)(void *), void *arg) noexcept(true) {
+    this->continuation = fn;
+    this->continuation_arg = arg;
+    auto s = this->state.load(std::memory_order_relaxed);
+    while ((s & k_status_mask) < k_value) {
+      if (this->state.compare_exchange_weak(s, s | k_continuation, std::memory_order_acq_rel,
+                                            std::memory_order_acquire)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  ///
+  ///\brief Remove the registered continuation before it is called.
+  ///
+  ///\return true if the continuation was removed and will not be called.
+  ///
+  bool removeContinuation() noexcept(true) {
+    auto s = this->state.load(std::memory_order_relaxed);
+    while ((s & k_continuation) != 0 && (s & k_status_mask) < k_value) {
+      if (this->state.compare_exchange_weak(s, s & ~k_continuation, std::memory_order_acq_rel,
+                                            std::memory_order_relaxed)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  ///
+  ///\brief Is the result (value or exception) ready?
+  ///
+  ///\return is ready?
+  ///
+  bool isReady() const noexcept(true) {
+    return (this->state.load(std::memory_order_acquire) & k_status_mask) >= k_value;
+  }
+
+  ///
+  ///\brief Wait until the result was published or the deadline passed.
+  ///
+  ///\param deadline the deadline (nullptr for none)
+  ///\return true if the result is ready
+  ///
+  bool waitUntil(const std::chrono::steady_clock::time_point *deadline) noexcept(true) {
+    auto s = this->state.load(std::memory_order_acquire);
+    while ((s & k_status_mask) < k_value) {
+      if (deadline != nullptr && std::chrono::steady_clock::now() >= *deadline) {
+        return false;
+      }
+      if ((s & k_waiting) == 0 &&
+          !this->state.compare_exchange_weak(s, s | k_waiting, std::memory_order_acquire)) {
+        continue;
+      }
+      waitOnWord(this->state, s | k_waiting, deadline);
+      s = this->state.load(std::memory_order_acquire);
+    }
+    return true;
+  }
+
+  ///
+  ///\brief Register a producer (event or acquired token).
+  ///
+  void addProducer() noexcept(true) { this->producers.fetch_add(1, std::memory_order_relaxed); }
+
+  ///
+  ///\brief Unregister a producer. If the last producer is released without a result, a
+  /// std::future_error(broken_promise) is published in place of the value (like std::promise).
+  ///
+  void releaseProducer() noexcept(true) {
+    if (this->producers.fetch_sub(1, std::memory_order_acq_rel) == 1 && this->tryAcquire()) {
+      this->exception =
+          std::make_exception_ptr(std::future_error(std::future_errc::broken_promise));
+      this->publish(k_exception);
+    }
+  }
+
+  ///
+  ///\brief Rethrow the stored exception, if there is one. The result must be ready.
+  ///
+  void rethrowIfException() const noexcept(false) {
+    if ((this->state.load(std::memory_order_acquire) & k_status_mask) == k_exception) {
+      std::rethrow_exception(this->exception);
+    }
+  }
+};
+
+///
+///\brief The result state shared amongst all event tokens and the future.
 ///
 ///\tparam ResultT the result type.
 ///
-template <typename ResultT> struct _SharedResultState {
+template <typename ResultT> struct _SharedResultState : _SharedResultStateBase {
+  ///
+  ///\brief The storage of the result value.
+  ///
+  std::optional<ResultT> value;
+
+  ///
+  ///\brief The promise behind a std::future retrieved via SynchronizedEvent::getFuture().
+  /// It is only created on demand.
+  ///
+  std::optional<std::promise<ResultT>> promise;
+
+  ///
+  ///\brief Move the published result into the promise (continuation of getFuture()).
+  ///
+  ///\param arg the _SharedResultState
+  ///
+  static void forwardToPromise(void *arg) noexcept(true) {
+    auto &state = *static_cast<_SharedResultState *>(arg);
+    if ((state.state.load(std::memory_order_acquire) & k_status_mask) == k_exception) {
+      state.promise->set_exception(state.exception);
+    } else {
+      state.promise->set_value(std::move(*state.value));
+    }
+  }
+
+  ///
+  ///\brief Set the value and publish it. The state must be acquired.
+  ///
+  ///\param r the value
+  ///
+  template <typename T> void setValue(T &&r) noexcept(false) {
+    this->value.emplace(std::forward<T>(r));
+    this->publish(k_value);
+  }
+
+  ///
+  ///\brief Take the result out of the state. The result must be ready.
+  ///
+  ///\return ResultT the value
+  ///\throws the exception, which was set in place of the value
+  ///
+  ResultT take() noexcept(false) {
+    this->rethrowIfException();
+    return std::move(*this->value);
+  }
+};
+
+///
+///\brief _SharedResultState specialization for void value types.
+///
+template <> struct _SharedResultState<void> : _SharedResultStateBase {
+  ///
+  ///\brief The promise behind a std::future retrieved via SynchronizedEvent::getFuture().
+  /// It is only created on demand.
+  ///
+  std::optional<std::promise<void>> promise;
+
   ///
-  ///\brief The access mutex
+  ///\brief Forward the published result to the promise (continuation of getFuture()).
   ///
-  std::mutex mutex;
+  ///\param arg the _SharedResultState
+  ///
+  static void forwardToPromise(void *arg) noexcept(true) {
+    auto &state = *static_cast<_SharedResultState *>(arg);
+    if ((state.state.load(std::memory_order_acquire) & k_status_mask) == k_exception) {
+      state.promise->set_exception(state.exception);
+    } else {
+      state.promise->set_value();
+    }
+  }
+
+  ///
+  ///\brief Publish the (void) value. The state must be acquired.
+  ///
+  void setValue() noexcept(true) { this->publish(k_value); }
+
+  ///
+  ///\brief Take the result out of the state. The result must be ready.
+  ///
+  ///\throws the exception, which was set in place of the value
+  ///
+  void take() noexcept(false) { this->rethrowIfException(); }
+};
+
+///
+///\brief A counted producer reference to a _SharedResultState. When the last producer reference
+/// is gone without a result, the result state is broken.
+///
+///\tparam ResultT the result type.
+///
+template <typename ResultT> class _SharedResultProducer {
+private:
+  std::shared_ptr<_SharedResultState<ResultT>> state_;
+
+public:
+  _SharedResultProducer() = default;
+
+  explicit _SharedResultProducer(std::shared_ptr<_SharedResultState<ResultT>> state) noexcept(true)
+      : state_(std::move(state)) {
+    if (this->state_ != nullptr) {
+      this->state_->addProducer();
+    }
+  }
+
+  _SharedResultProducer(const _SharedResultProducer &other) noexcept(true)
+      : _SharedResultProducer(other.state_) {}
+
+  _SharedResultProducer(_SharedResultProducer &&other) noexcept(true)
+      : state_(std::move(other.state_)) {}
+
+  _SharedResultProducer &operator=(_SharedResultProducer other) noexcept(true) {
+    std::swap(this->state_, other.state_);
+    return *this;
+  }
+
+  ~_SharedResultProducer() noexcept(true) { this->reset(); }
 
   ///
-  ///\brief The promise, where the result will be written into.
+  ///\brief Release this producer reference.
   ///
-  std::promise<ResultT> promise;
+  void reset() noexcept(true) {
+    if (auto state = std::move(this->state_); state != nullptr) {
+      state->releaseProducer();
+    }
+  }
 
   ///
-  ///\brief Is this result state still live, i.e. is the promise still unused?
+  ///\brief Get the referenced state.
   ///
-  bool live = true;
+  ///\return const std::shared_ptr<_SharedResultState<ResultT>>& the state (may be nullptr)
+  ///
+  const std::shared_ptr<_SharedResultState<ResultT>> &get() const noexcept(true) {
+    return this->state_;
+  }
+
+  _SharedResultState<ResultT> *operator->() const noexcept(true) { return this->state_.get(); }
+  _SharedResultState<ResultT> &operator*() const noexcept(true) { return *this->state_; }
+
+  bool operator==(std::nullptr_t) const noexcept(true) { return this->state_ == nullptr; }
+  bool operator!=(std::nullptr_t) const noexcept(true) { return this->state_ != nullptr; }
 };
 
 ///
@@ -56,37 +408,66 @@ protected:
 };
 
 ///
-///\brief This token will be retrieved from a SynchronizedEvent. Every owner of such a token
-/// can try to acquire it in order to set a result.
+///\brief The common part of all SynchronizedEventTokens. An acquired token gives up its
+/// acquisition, when it is destroyed without setting a result.
 ///
 ///\tparam ResultT the result type.
 ///
-template <typename ResultT> class SynchronizedEventToken : private _SynchronizedEventTokenStatic {
-public:
-  using result_type = ResultT;
+template <typename ResultT>
+class _SynchronizedEventTokenBase : protected _SynchronizedEventTokenStatic {
+protected:
+  _SharedResultProducer<ResultT> acquired_shared_state_;
 
-private:
-  friend class SynchronizedEvent<ResultT>;
-  std::unique_lock<std::mutex> lock_;
-  std::shared_ptr<_SharedResultState<ResultT>> acquired_shared_state_;
+  ///
+  ///\brief Construct a new (not acquired) token.
+  ///
+  _SynchronizedEventTokenBase() = default;
 
   ///
-  ///\brief Construct a new (acquired) SynchronizedEventToken.
+  ///\brief Construct a new (acquired) token.
   ///
-  ///\param lock a lock for the mutex of the _SharedResultState.
   ///\param acquired_shared_state a pointer to the acquired _SharedResultState.
   ///
-  SynchronizedEventToken(
-      std::unique_lock<std::mutex> &&lock,
+  explicit _SynchronizedEventTokenBase(
       std::shared_ptr<_SharedResultState<ResultT>> acquired_shared_state) noexcept(true)
-      : lock_(std::move(lock)), acquired_shared_state_(acquired_shared_state) {}
+      : acquired_shared_state_(std::move(acquired_shared_state)) {}
 
   ///
-  ///\brief Construct a new (not acquired) SynchronizedEventToken.
+  ///\brief Get the shared state, if it can be written.
   ///
-  SynchronizedEventToken() = default;
+  ///\return _SharedResultState<ResultT>& the shared state
+  ///\throws VDA5050PPSynchronizedEventNotAcquired when the token is not acquired.
+  ///
+  _SharedResultState<ResultT> &writableState() const noexcept(false) {
+    if (this->acquired_shared_state_ == nullptr || !this->acquired_shared_state_->isAcquired()) {
+      throw notAcquiredException();
+    }
+    return *this->acquired_shared_state_;
+  }
 
 public:
+  _SynchronizedEventTokenBase(const _SynchronizedEventTokenBase &) = delete;
+  _SynchronizedEventTokenBase &operator=(const _SynchronizedEventTokenBase &) = delete;
+
+  _SynchronizedEventTokenBase(_SynchronizedEventTokenBase &&other) noexcept(true)
+      : acquired_shared_state_(std::move(other.acquired_shared_state_)) {}
+
+  _SynchronizedEventTokenBase &operator=(_SynchronizedEventTokenBase &&other) noexcept(true) {
+    if (this != &other) {
+      if (this->acquired_shared_state_ != nullptr) {
+        this->acquired_shared_state_->unacquire();
+      }
+      this->acquired_shared_state_ = std::move(other.acquired_shared_state_);
+    }
+    return *this;
+  }
+
+  ~_SynchronizedEventTokenBase() noexcept(true) {
+    if (this->acquired_shared_state_ != nullptr) {
+      this->acquired_shared_state_->unacquire();
+    }
+  }
+
   ///
   ///\brief Is this Token acquired, i.e. can the result be set?
   ///
@@ -94,23 +475,6 @@ public:
   ///
   bool isAcquired() const noexcept(true) { return this->acquired_shared_state_ != nullptr; }
 
-  ///
-  ///\brief Set the result value. This token must be acquired.
-  ///
-  ///\tparam T the value type.
-  ///\param r the value to set.
-  ///\throws VDA5050PPSynchronizedEventNotAcquired when the token is not acquired.
-  ///
-  template <typename T> void setValue(T &&r) const noexcept(false) {
-    static_assert(std::is_convertible_v<T, ResultT>,
-                  "setValue(T &&r) can only accept T as convertible to ResultT");
-    if (this->acquired_shared_state_ == nullptr || !this->acquired_shared_state_->live) {
-      throw notAcquiredException();
-    }
-    this->acquired_shared_state_->promise.set_value(std::forward<T>(r));
-    this->acquired_shared_state_->live = false;
-  }
-
   ///
   ///\brief Set an exception, in place of a value. The token must be acquired.
   ///
@@ -118,11 +482,9 @@ public:
   ///\throws VDA5050PPSynchronizedEventNotAcquired when the token is not acquired.
   ///
   void setException(std::exception_ptr e) const noexcept(false) {
-    if (this->acquired_shared_state_ == nullptr || !this->acquired_shared_state_->live) {
-      throw notAcquiredException();
-    }
-    this->acquired_shared_state_->promise.set_exception(e);
-    this->acquired_shared_state_->live = false;
+    auto &state = this->writableState();
+    state.exception = e;
+    state.publish(_SharedResultStateBase::k_exception);
   }
 
   ///
@@ -131,11 +493,8 @@ public:
   ///\throws VDA5050PPSynchronizedEventNotAcquired when the token is not acquired.
   ///
   void release() noexcept(false) {
-    if (this->acquired_shared_state_ == nullptr || !this->acquired_shared_state_->live) {
-      throw notAcquiredException();
-    }
-    this->lock_.unlock();
-    this->acquired_shared_state_ = nullptr;
+    this->writableState().unacquire();
+    this->acquired_shared_state_.reset();
   }
 
   ///
@@ -146,28 +505,67 @@ public:
   operator bool() const noexcept(true) { return this->isAcquired(); }
 };
 
+///
+///\brief This token will be retrieved from a SynchronizedEvent. Every owner of such a token
+/// can try to acquire it in order to set a result.
+///
+///\tparam ResultT the result type.
+///
+template <typename ResultT>
+class SynchronizedEventToken : public _SynchronizedEventTokenBase<ResultT> {
+public:
+  using result_type = ResultT;
+
+private:
+  friend class SynchronizedEvent<ResultT>;
+
+  ///
+  ///\brief Construct a new (acquired) SynchronizedEventToken.
+  ///
+  ///\param acquired_shared_state a pointer to the acquired _SharedResultState.
+  ///
+  explicit SynchronizedEventToken(
+      std::shared_ptr<_SharedResultState<ResultT>> acquired_shared_state) noexcept(true)
+      : _SynchronizedEventTokenBase<ResultT>(std::move(acquired_shared_state)) {}
+
+  ///
+  ///\brief Construct a new (not acquired) SynchronizedEventToken.
+  ///
+  SynchronizedEventToken() = default;
+
+public:
+  ///
+  ///\brief Set the result value. This token must be acquired.
+  ///
+  ///\tparam T the value type.
+  ///\param r the value to set.
+  ///\throws VDA5050PPSynchronizedEventNotAcquired when the token is not acquired.
+  ///
+  template <typename T> void setValue(T &&r) const noexcept(false) {
+    static_assert(std::is_convertible_v<T, ResultT>,
+                  "setValue(T &&r) can only accept T as convertible to ResultT");
+    this->writableState().setValue(std::forward<T>(r));
+  }
+};
+
 ///
 ///\brief SynchronizedEventToken specialization for void value types.
 ///
-template <> class SynchronizedEventToken<void> : private _SynchronizedEventTokenStatic {
+template <> class SynchronizedEventToken<void> : public _SynchronizedEventTokenBase<void> {
 public:
   using result_type = void;
 
 private:
   friend class SynchronizedEvent<void>;
-  std::unique_lock<std::mutex> lock_;
-  std::shared_ptr<_SharedResultState<void>> acquired_shared_state_;
 
   ///
   ///\brief Construct a new (acquired) SynchronizedEventToken.
   ///
-  ///\param lock a lock for the mutex of the _SharedResultState.
   ///\param acquired_shared_state a pointer to the acquired _SharedResultState.
   ///
-  SynchronizedEventToken(
-      std::unique_lock<std::mutex> &&lock,
+  explicit SynchronizedEventToken(
       std::shared_ptr<_SharedResultState<void>> acquired_shared_state) noexcept(true)
-      : lock_(std::move(lock)), acquired_shared_state_(acquired_shared_state) {}
+      : _SynchronizedEventTokenBase<void>(std::move(acquired_shared_state)) {}
 
   ///
   ///\brief Construct a new (not acquired) SynchronizedEventToken.
@@ -176,59 +574,158 @@ private:
 
 public:
   ///
-  ///\brief Is this Token acquired, i.e. can the result be set?
+  ///\brief Set the result value. This token must be acquired.
   ///
-  ///\return is acquired?
+  ///\throws VDA5050PPSynchronizedEventNotAcquired when the token is not acquired.
   ///
-  bool isAcquired() const noexcept(true) { return this->acquired_shared_state_ != nullptr; }
+  void setValue() const noexcept(false) { this->writableState().setValue(); }
+};
+
+///
+///\brief The future of a SynchronizedEvent result. It mirrors the interface of std::future,
+/// but waits directly on the shared result state of the event.
+///
+///\tparam ResultT the result type.
+///
+template <typename ResultT> class SynchronizedEventFuture {
+private:
+  friend class SynchronizedEvent<ResultT>;
+  std::shared_ptr<_SharedResultState<ResultT>> shared_state_;
+
+  explicit SynchronizedEventFuture(
+      std::shared_ptr<_SharedResultState<ResultT>> shared_state) noexcept(true)
+      : shared_state_(std::move(shared_state)) {}
+
+  _SharedResultState<ResultT> &validState() const noexcept(false) {
+    if (this->shared_state_ == nullptr) {
+      throw std::future_error(std::future_errc::no_state);
+    }
+    return *this->shared_state_;
+  }
 
+public:
   ///
-  ///\brief Set the result value. This token must be acquired.
+  ///\brief Construct a new (invalid) SynchronizedEventFuture
   ///
-  ///\throws VDA5050PPSynchronizedEventNotAcquired when the token is not acquired.
+  SynchronizedEventFuture() = default;
+
   ///
-  void setValue() const noexcept(false) {
-    if (this->acquired_shared_state_ == nullptr || !this->acquired_shared_state_->live) {
-      throw notAcquiredException();
+  ///\brief Does this future refer to a result state, i.e. get() was not called yet?
+  ///
+  ///\return is valid?
+  ///
+  bool valid() const noexcept(true) { return this->shared_state_ != nullptr; }
+
+  ///
+  ///\brief Block until the result is available.
+  ///
+  ///\throws std::future_error if the future is not valid.
+  ///
+  void wait() const noexcept(false) { this->validState().waitUntil(nullptr); }
+
+  ///
+  ///\brief Block until the result is available or the timeout passed.
+  ///
+  ///\param timeout the maximum time to wait.
+  ///\return std::future_status ready or timeout.
+  ///\throws std::future_error if the future is not valid.
+  ///
+  template <typename Rep, typename Period>
+  std::future_status wait_for(const std::chrono::duration<Rep, Period> &timeout) const
+      noexcept(false) {
+    auto &state = this->validState();
+    auto now = std::chrono::steady_clock::now();
+    auto max_timeout = std::chrono::steady_clock::time_point::max() - now;
+
+    if (std::chrono::duration<double>(timeout) >= std::chrono::duration<double>(max_timeout)) {
+      state.waitUntil(nullptr);
+      return std::future_status::ready;
     }
-    this->acquired_shared_state_->promise.set_value();
-    this->acquired_shared_state_->live = false;
+
+    auto deadline = now + std::chrono::ceil<std::chrono::steady_clock::duration>(timeout);
+    return state.waitUntil(&deadline) ? std::future_status::ready : std::future_status::timeout;
   }
 
   ///
-  ///\brief Set an exception, in place of a value. The token must be acquired.
+  ///\brief Block until the result is available or the time point was reached.
   ///
-  ///\param e the exception pointer.
-  ///\throws VDA5050PPSynchronizedEventNotAcquired when the token is not acquired.
+  ///\param time_point the time point to wait for.
+  ///\return std::future_status ready or timeout.
+  ///\throws std::future_error if the future is not valid.
   ///
-  void setException(std::exception_ptr e) const noexcept(false) {
-    if (this->acquired_shared_state_ == nullptr || !this->acquired_shared_state_->live) {
-      throw notAcquiredException();
-    }
-    this->acquired_shared_state_->promise.set_exception(e);
-    this->acquired_shared_state_->live = false;
+  template <typename Clock, typename Duration>
+  std::future_status wait_until(const std::chrono::time_point<Clock, Duration> &time_point) const
+      noexcept(false) {
+    return this->wait_for(time_point - Clock::now());
   }
 
   ///
-  ///\brief Release an acquired token. This is only useful, if the token was acquired.
+  ///\brief Wait for the result and get it. Afterwards the future is not valid anymore.
   ///
-  ///\throws VDA5050PPSynchronizedEventNotAcquired when the token is not acquired.
+  ///\return ResultT the result.
+  ///\throws std::future_error if the future is not valid.
+  ///\throws the exception, which was set in place of the value.
   ///
-  void release() noexcept(false) {
-    if (this->acquired_shared_state_ == nullptr || !this->acquired_shared_state_->live) {
-      throw notAcquiredException();
-    }
-    this->lock_.unlock();
-    this->acquired_shared_state_ = nullptr;
+  ResultT get() noexcept(false) {
+    this->wait();
+    auto state = std::move(this->shared_state_);
+    return state->take();
+  }
+};
+
+#ifdef LIBVDA5050PP_COROUTINES
+///
+///\brief An awaitable for the result of a SynchronizedEvent (co_await evt->result()).
+/// Only available if the library was built with LIBVDA5050PP_COROUTINES.
+///
+/// The awaiting coroutine is resumed by the thread, which sets the result. No thread is blocked
+/// while waiting.
+///
+///\tparam ResultT the result type.
+///
+template <typename ResultT> class SynchronizedEventAwaitable {
+protected:
+  std::shared_ptr<_SharedResultState<ResultT>> shared_state_;
+
+  explicit SynchronizedEventAwaitable(
+      std::shared_ptr<_SharedResultState<ResultT>> shared_state) noexcept(true)
+      : shared_state_(std::move(shared_state)) {}
+
+private:
+  friend class SynchronizedEvent<ResultT>;
+
+  static void resume(void *address) noexcept(true) {
+    std::coroutine_handle<>::from_address(address).resume();
   }
 
+public:
   ///
-  ///\brief Returns this->isAcquired()
+  ///\brief Is the result already available, i.e. no suspension is needed?
   ///
-  ///\return is this token acquired?
+  ///\return is ready?
   ///
-  operator bool() const noexcept(true) { return this->isAcquired(); }
+  bool await_ready() const noexcept(true) { return this->shared_state_->isReady(); }
+
+  ///
+  ///\brief Suspend the awaiting coroutine until the result is set.
+  ///
+  ///\param handle the awaiting coroutine.
+  ///\return false if the result became ready in the meantime (do not suspend).
+  ///
+  bool await_suspend(std::coroutine_handle<> handle) noexcept(true) {
+    return this->shared_state_->setContinuation(&SynchronizedEventAwaitable::resume,
+                                                handle.address());
+  }
+
+  ///
+  ///\brief Get the result.
+  ///
+  ///\return ResultT the result.
+  ///\throws the exception, which was set in place of the value.
+  ///
+  ResultT await_resume() noexcept(false) { return this->shared_state_->take(); }
 };
+#endif  // LIBVDA5050PP_COROUTINES
 
 ///
 ///\brief A base type for SynchronizedEvents. It only provides the result members, not the actual
@@ -238,6 +735,9 @@ public:
 /// The sender can wait for the SynchronizedEvent (getFuture()), while the recipient can
 /// set a result via acquireResultToken().
 ///
+/// If the event and all acquired tokens are destroyed without a result, the result is a
+/// std::future_error(broken_promise).
+///
 ///\tparam ResultT the result of the synchronized event.
 ///
 template <typename ResultT> class SynchronizedEvent {
@@ -245,18 +745,64 @@ public:
   using result_type = ResultT;
 
 private:
-  std::shared_ptr<_SharedResultState<ResultT>> shared_state_ =
-      std::make_shared<_SharedResultState<ResultT>>();
+  _SharedResultProducer<ResultT> shared_state_{
+      vda5050pp::misc::makePooled<_SharedResultState<ResultT>>()};
+
+  void markRetrieved() noexcept(false) {
+    if (this->shared_state_->retrieved.exchange(true, std::memory_order_relaxed)) {
+      throw std::future_error(std::future_errc::future_already_retrieved);
+    }
+  }
 
 public:
   ///
   ///\brief Get a future object of the result. (Called by sender)
   ///
+  /// The result is forwarded into a std::promise, which is only created by this call. Use
+  /// getSynchronizedFuture() to wait on the result state directly.
+  ///
   ///\return std::future<ResultT>
+  ///\throws std::future_error if the future was already retrieved.
+  ///
+  std::future<ResultT> getFuture() noexcept(false) {
+    this->markRetrieved();
+    auto &state = *this->shared_state_;
+    state.promise.emplace(std::allocator_arg,
+                          vda5050pp::misc::PoolAllocator<std::promise<ResultT>>());
+    auto future = state.promise->get_future();
+    if (!state.setContinuation(&_SharedResultState<ResultT>::forwardToPromise, &state)) {
+      // Already published
+      _SharedResultState<ResultT>::forwardToPromise(&state);
+    }
+    return future;
+  }
+
+  ///
+  ///\brief Get a SynchronizedEventFuture of the result, which waits on the result state
+  /// directly (no std::promise involved). This can be used in place of getFuture().
+  /// (Called by sender)
+  ///
+  ///\return SynchronizedEventFuture<ResultT>
+  ///\throws std::future_error if the future was already retrieved.
+  ///
+  SynchronizedEventFuture<ResultT> getSynchronizedFuture() noexcept(false) {
+    this->markRetrieved();
+    return SynchronizedEventFuture<ResultT>(this->shared_state_.get());
+  }
+
+#ifdef LIBVDA5050PP_COROUTINES
+  ///
+  ///\brief Get an awaitable of the result (co_await evt->result()). This can be used in place of
+  /// getFuture(). (Called by sender)
+  ///
+  ///\return SynchronizedEventAwaitable<ResultT>
+  ///\throws std::future_error if the result (future) was already retrieved.
   ///
-  std::future<ResultT> getFuture() noexcept(true) {
-    return this->shared_state_->promise.get_future();
+  SynchronizedEventAwaitable<ResultT> result() noexcept(false) {
+    this->markRetrieved();
+    return SynchronizedEventAwaitable<ResultT>(this->shared_state_.get());
   }
+#endif
 
   ///
   ///\brief Try to acquire a SynchronizedEventToken. (Called by recipient)
@@ -264,9 +810,8 @@ public:
   ///\return SynchronizedEventToken<ResultT>
   ///
   SynchronizedEventToken<ResultT> acquireResultToken() noexcept(true) {
-    std::unique_lock lock(this->shared_state_->mutex, std::defer_lock);
-    if (lock.try_lock() && this->shared_state_->live) {
-      return SynchronizedEventToken(std::move(lock), this->shared_state_);
+    if (this->shared_state_->tryAcquire()) {
+      return SynchronizedEventToken<ResultT>(this->shared_state_.get());
     } else {
       return {};
     }
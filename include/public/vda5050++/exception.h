@@ -289,6 +289,30 @@ public:
   std::string format() const noexcept(true) override;
 };
 
+///\brief This exception is thrown, when the library cannot decode or encode a JSON message.
+class VDA5050PPJsonError : public VDA5050PPError {
+public:
+  ///\brief format the exception contents.
+  ///\return the formatted string
+  explicit VDA5050PPJsonError(VDA5050PPErrorContext &&context) noexcept(true);
+
+  ///\brief format the exception contents.
+  ///\return the formatted string
+  std::string format() const noexcept(true) override;
+};
+
+///\brief This exception is thrown, when a received message exceeds the AGV's protocol limits.
+class VDA5050PPProtocolLimitExceeded : public VDA5050PPError {
+public:
+  ///\brief format the exception contents.
+  ///\return the formatted string
+  explicit VDA5050PPProtocolLimitExceeded(VDA5050PPErrorContext &&context) noexcept(true);
+
+  ///\brief format the exception contents.
+  ///\return the formatted string
+  std::string format() const noexcept(true) override;
+};
+
 }  // namespace vda5050pp
 
 #endif  // INCLUDE_PUBLIC_VDA5050_2B_2B_EXCEPTION_H_
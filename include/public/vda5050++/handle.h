@@ -8,6 +8,8 @@
 #ifndef INCLUDE_PUBLIC_VDA5050_2B_2B_HANDLE_H_
 #define INCLUDE_PUBLIC_VDA5050_2B_2B_HANDLE_H_
 
+#include <memory>
+
 #include "vda5050++/config.h"
 #include "vda5050++/handler/base_action_handler.h"
 #include "vda5050++/handler/base_navigation_handler.h"
@@ -19,6 +21,11 @@
 #include <spdlog/spdlog.h>
 #endif
 
+namespace vda5050pp::core {
+class Instance;
+class InstanceScope;
+}  // namespace vda5050pp::core
+
 namespace vda5050pp {
 
 ///
@@ -26,12 +33,57 @@ namespace vda5050pp {
 /// It can be constructed and deconstructed at will. The library can be controlled
 /// by the member functions.
 ///
+/// A default constructed Handle controls the default instance of the library. Handles returned
+/// by createInstance() control an own instance, so one process can run several AGVs.
+///
 class Handle {
+private:
+  // nullptr: the default instance
+  std::shared_ptr<vda5050pp::core::Instance> instance_;
+
+  std::shared_ptr<vda5050pp::core::Instance> getInstance() const noexcept(false);
+
 public:
+  ///
+  ///\brief Binds the instance of a Handle to the calling thread, while it exists. Sinks,
+  /// observers and EventHandles constructed in the meantime use this instance, even if they
+  /// are used on other threads later.
+  ///
+  class Binding {
+  private:
+    std::shared_ptr<vda5050pp::core::Instance> instance_;
+    std::unique_ptr<vda5050pp::core::InstanceScope> scope_;
+
+  public:
+    explicit Binding(std::shared_ptr<vda5050pp::core::Instance> instance) noexcept(true);
+    ~Binding() noexcept(true);
+    Binding(const Binding &) = delete;
+    Binding(Binding &&) = delete;
+    Binding &operator=(const Binding &) = delete;
+    Binding &operator=(Binding &&) = delete;
+  };
+
+  ///
+  ///\brief Create and start an additional, independent instance of the library. It has its own
+  /// modules, event managers, state and MQTT connection. Only the loggers are shared.
+  ///
+  ///\param config the configuration to use
+  ///\return Handle a Handle controlling the new instance (shutdown() stops it)
+  ///
+  static Handle createInstance(const vda5050pp::Config &config) noexcept(false);
+
+  ///
+  ///\brief Bind the instance of this Handle to the calling thread (see Binding). Does nothing
+  /// for the default instance.
+  ///
+  ///\return Binding the binding, which is released on destruction
+  ///
+  [[nodiscard]] Binding bind() const noexcept(true);
+
   /// \brief Initialize zhe library.
   /// \param config The configuration to use
   /// The library will try to establish an MQTT Connection and will be
-  /// ready to process messages.
+  /// ready to process messages. (Only for the default instance, see createInstance())
   void initialize(const vda5050pp::Config &config) const noexcept(true);
 
   /// \brief Register a new ActionHandler. Upon receiving actions an appropiate
@@ -15,8 +15,11 @@
 #include <any>
 #include <list>
 #include <memory>
+#include <optional>
+#include <string>
 #include <string_view>
 #include <variant>
+#include <vector>
 
 #include "vda5050++/handler/action_state.h"
 #include "vda5050++/misc/action_context.h"
@@ -96,6 +99,27 @@ public:
   ///\return std::list<vda5050::AgvAction>
   ///
   virtual std::list<vda5050::AgvAction> getActionDescription() const noexcept(false) = 0;
+
+  ///
+  ///\brief Declare, that match() and validate() may be called concurrently for different actions.
+  /// With event_manager_options.parallel_action_validation, the actions of an order are then
+  /// validated in parallel. The calls of handlers, which are not thread-safe, are serialized.
+  ///
+  ///\return bool is this handler thread-safe (false by default)
+  ///
+  virtual bool isThreadSafe() const noexcept(true) { return false; }
+
+  ///
+  ///\brief Publish the action types handled by this handler. They are read once, when the handler
+  /// is registered, and actions of these types are routed to it with a hash lookup, without
+  /// calling match(). Handlers, which match dynamically, return std::nullopt (the default), then
+  /// match() is called for each action, which has no indexed handler.
+  ///
+  ///\return std::optional<std::vector<std::string>> the handled action types or std::nullopt
+  ///
+  virtual std::optional<std::vector<std::string>> getHandledActionTypes() const noexcept(false) {
+    return std::nullopt;
+  }
 };
 
 }  // namespace vda5050pp::handler
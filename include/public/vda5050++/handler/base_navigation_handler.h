@@ -16,6 +16,10 @@
 #include <memory>
 #include <string_view>
 
+namespace vda5050pp::core {
+class Instance;
+}  // namespace vda5050pp::core
+
 namespace vda5050pp::handler {
 
 ///
@@ -23,6 +27,12 @@ namespace vda5050pp::handler {
 /// NavigationEvents and dispatch NavigationStatusEvents.
 ///
 class BaseNavigationHandler {
+private:
+  friend class vda5050pp::core::Instance;
+
+  // The instance, this handler was registered with (empty: the default instance)
+  std::weak_ptr<vda5050pp::core::Instance> instance_;
+
 public:
   virtual ~BaseNavigationHandler() = default;
 
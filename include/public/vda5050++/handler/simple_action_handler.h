@@ -65,6 +65,23 @@ public:
   ///\return std::list<vda5050::AgvAction>
   ///
   std::list<vda5050::AgvAction> getActionDescription() const noexcept(false) override;
+
+  ///
+  ///\brief match() and validate() only read the declarations, so they are thread-safe. Override
+  /// this, if a derived class overrides them in a way, which is not.
+  ///
+  ///\return true
+  ///
+  bool isThreadSafe() const noexcept(true) override;
+
+  ///
+  ///\brief Publish the action type of the declaration, so its actions are routed to this
+  /// handler without calling match(). Override this to return std::nullopt, if a derived class
+  /// overrides match().
+  ///
+  ///\return std::optional<std::vector<std::string>> the declared action type
+  ///
+  std::optional<std::vector<std::string>> getHandledActionTypes() const noexcept(false) override;
 };
 
 }  // namespace vda5050pp::handler
@@ -59,6 +59,7 @@ public:
 
   ///
   ///\brief Add a declaration for actions that will be handled by this handler.
+  /// The action types are indexed at registration, so add all declarations before.
   ///
   ///\param decl the action declaration
   ///
@@ -89,6 +90,23 @@ public:
   ///\return std::list<vda5050::AgvAction>
   ///
   std::list<vda5050::AgvAction> getActionDescription() const noexcept(false) override;
+
+  ///
+  ///\brief match() and validate() only read the declarations, so they are thread-safe. Override
+  /// this, if a derived class overrides them in a way, which is not.
+  ///
+  ///\return true
+  ///
+  bool isThreadSafe() const noexcept(true) override;
+
+  ///
+  ///\brief Publish the action types of the declarations, so their actions are routed to this
+  /// handler without calling match(). Override this to return std::nullopt, if a derived class
+  /// overrides match().
+  ///
+  ///\return std::optional<std::vector<std::string>> the declared action types
+  ///
+  std::optional<std::vector<std::string>> getHandledActionTypes() const noexcept(false) override;
 };
 
 }  // namespace vda5050pp::handler
@@ -85,6 +85,21 @@ public:
     return std::static_pointer_cast<T>(this->contained_);
   }
 
+  ///
+  ///\brief Get a typed std::shared_ptr to const from the underlying data
+  ///
+  ///\throws BadAnyPtrCast if the stored type cannot be casted to T
+  ///\tparam T the type to cast the underlying data to
+  ///\return std::shared_ptr<const T> the casted pointer
+  ///
+  template <typename T> std::shared_ptr<const T> get() const noexcept(false) {
+    if (this->info_.get() != typeid(T)) {
+      throw BadAnyPtrCast();
+    }
+
+    return std::static_pointer_cast<const T>(this->contained_);
+  }
+
   ///
   ///\brief Convert this to a typed std::shared_ptr
   ///
@@ -0,0 +1,146 @@
+//  Copyright Open Logistics Foundation
+//
+//  Licensed under the Open Logistics Foundation License 1.3.
+//  For details on the licensing terms, see the LICENSE file.
+//  SPDX-License-Identifier: OLFL-1.3
+//
+
+#ifndef PUBLIC_VDA5050_2B_2B_MISC_LATENCY_HISTOGRAM_H_
+#define PUBLIC_VDA5050_2B_2B_MISC_LATENCY_HISTOGRAM_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace vda5050pp::misc {
+
+///
+///\brief A log-linear (HDR-style) histogram of latencies in nanoseconds.
+///
+/// Values below k_sub_buckets are counted exactly. Larger values are bucketed by their magnitude
+/// (highest set bit) and the following k_sub_bucket_bits bits, such that the relative error of a
+/// bucket is at most 1/k_sub_buckets. Values above 2^(k_max_magnitude + 1) ns are counted in the
+/// last bucket.
+///
+/// This is a snapshot (value type), the library records into its own thread-safe histograms.
+///
+class LatencyHistogram {
+public:
+  static constexpr std::size_t k_sub_bucket_bits = 3;
+  static constexpr std::size_t k_sub_buckets = std::size_t(1) << k_sub_bucket_bits;
+  static constexpr std::size_t k_max_magnitude = 40;
+  static constexpr std::size_t k_buckets =
+      (k_max_magnitude - k_sub_bucket_bits + 2) * k_sub_buckets;
+
+private:
+  std::vector<uint64_t> counts_;
+  uint64_t count_ = 0;
+  uint64_t min_ = 0;
+  uint64_t max_ = 0;
+  uint64_t sum_ = 0;
+
+public:
+  ///
+  ///\brief Get the bucket index of a value
+  ///
+  ///\param value the value in nanoseconds
+  ///\return std::size_t the bucket index (< k_buckets)
+  ///
+  static constexpr std::size_t bucketIndex(uint64_t value) noexcept(true) {
+    if (value < k_sub_buckets) {
+      return std::size_t(value);
+    }
+
+    std::size_t magnitude = 0;
+    for (uint64_t v = value; v > 1; v >>= 1) {
+      magnitude++;
+    }
+    if (magnitude > k_max_magnitude) {
+      return k_buckets - 1;
+    }
+
+    auto shift = magnitude - k_sub_bucket_bits;
+    auto sub_bucket = std::size_t(value >> shift) & (k_sub_buckets - 1);
+    return (shift + 1) * k_sub_buckets + sub_bucket;
+  }
+
+  ///
+  ///\brief Get the largest value, which is counted in a bucket
+  ///
+  ///\param index the bucket index
+  ///\return uint64_t the largest value in nanoseconds
+  ///
+  static constexpr uint64_t bucketUpperBound(std::size_t index) noexcept(true) {
+    if (index < k_sub_buckets) {
+      return index;
+    }
+
+    auto shift = index / k_sub_buckets - 1;
+    auto sub_bucket = index % k_sub_buckets;
+    return ((uint64_t(k_sub_buckets + sub_bucket + 1)) << shift) - 1;
+  }
+
+  ///
+  ///\brief Construct an empty LatencyHistogram
+  ///
+  LatencyHistogram();
+
+  ///
+  ///\brief Construct a LatencyHistogram from recorded data
+  ///
+  ///\param counts the count of each bucket (resized to k_buckets)
+  ///\param min the smallest recorded value
+  ///\param max the largest recorded value
+  ///\param sum the sum of all recorded values
+  ///
+  LatencyHistogram(std::vector<uint64_t> counts, uint64_t min, uint64_t max, uint64_t sum);
+
+  ///
+  ///\brief Get the number of recorded values
+  ///
+  ///\return uint64_t the number of values
+  ///
+  uint64_t getCount() const noexcept(true);
+
+  ///
+  ///\brief Get the smallest recorded value
+  ///
+  ///\return std::chrono::nanoseconds the smallest value (0 if empty)
+  ///
+  std::chrono::nanoseconds getMin() const noexcept(true);
+
+  ///
+  ///\brief Get the largest recorded value
+  ///
+  ///\return std::chrono::nanoseconds the largest value (0 if empty)
+  ///
+  std::chrono::nanoseconds getMax() const noexcept(true);
+
+  ///
+  ///\brief Get the mean of all recorded values
+  ///
+  ///\return std::chrono::nanoseconds the mean (0 if empty)
+  ///
+  std::chrono::nanoseconds getMean() const noexcept(true);
+
+  ///
+  ///\brief Get an upper bound of the given percentile
+  ///
+  ///\param percentile the percentile in [0, 100]
+  ///\return std::chrono::nanoseconds the value below which percentile % of all values are
+  /// (0 if empty)
+  ///
+  std::chrono::nanoseconds getPercentile(double percentile) const noexcept(true);
+
+  ///
+  ///\brief Get the count of each bucket
+  ///
+  ///\return const std::vector<uint64_t>& the counts (see bucketUpperBound)
+  ///
+  const std::vector<uint64_t> &getBuckets() const noexcept(true);
+};
+
+}  // namespace vda5050pp::misc
+
+#endif  // PUBLIC_VDA5050_2B_2B_MISC_LATENCY_HISTOGRAM_H_
@@ -17,6 +17,7 @@ namespace vda5050pp::misc {
 enum class MessageErrorType {
   k_delivery,
   k_json_deserialization,
+  k_protocol_limits,
 };
 
 }  // namespace vda5050pp::misc
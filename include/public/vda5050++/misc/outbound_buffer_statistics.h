@@ -0,0 +1,33 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+
+#ifndef PUBLIC_VDA5050_2B_2B_MISC_OUTBOUND_BUFFER_STATISTICS_H_
+#define PUBLIC_VDA5050_2B_2B_MISC_OUTBOUND_BUFFER_STATISTICS_H_
+
+#include <cstdint>
+
+namespace vda5050pp::misc {
+
+///
+///\brief The counters of the buffer, which keeps outgoing messages while the connection is down.
+///
+struct OutboundBufferStatistics {
+  /// Messages buffered while offline
+  uint64_t buffered = 0;
+  /// Buffered messages replaced by a newer message of the same topic
+  uint64_t coalesced = 0;
+  /// Buffered messages discarded without being sent (expired or shut down)
+  uint64_t dropped = 0;
+  /// Buffered messages sent after reconnecting
+  uint64_t flushed = 0;
+  /// Messages currently buffered
+  uint64_t pending = 0;
+};
+
+}  // namespace vda5050pp::misc
+
+#endif  // PUBLIC_VDA5050_2B_2B_MISC_OUTBOUND_BUFFER_STATISTICS_H_
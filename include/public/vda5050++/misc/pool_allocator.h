@@ -0,0 +1,184 @@
+//  Copyright Open Logistics Foundation
+//
+//  Licensed under the Open Logistics Foundation License 1.3.
+//  For details on the licensing terms, see the LICENSE file.
+//  SPDX-License-Identifier: OLFL-1.3
+//
+
+#ifndef PUBLIC_VDA5050_2B_2B_MISC_POOL_ALLOCATOR_H_
+#define PUBLIC_VDA5050_2B_2B_MISC_POOL_ALLOCATOR_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+
+namespace vda5050pp::misc {
+
+///
+///\brief A thread-safe pool of fixed size memory blocks.
+///
+/// Released blocks are kept in a free list and handed out again, such that steady-state
+/// allocations of the same size do not reach the heap. At most k_max_free_blocks are cached,
+/// further blocks are returned to the heap.
+///
+/// There is exactly one pool per block size.
+///
+///\tparam BlockSize the size of each block
+///
+template <std::size_t BlockSize> class FixedBlockPool {
+private:
+  struct FreeBlock {
+    FreeBlock *next;
+  };
+
+  static_assert(BlockSize >= sizeof(FreeBlock), "BlockSize is too small");
+
+  std::mutex mutex_;
+  FreeBlock *free_list_ = nullptr;
+  std::size_t free_count_ = 0;
+
+  FixedBlockPool() = default;
+
+public:
+  ///
+  ///\brief The maximum number of cached blocks.
+  ///
+  static constexpr std::size_t k_max_free_blocks = 4096;
+
+  FixedBlockPool(const FixedBlockPool &) = delete;
+  FixedBlockPool(FixedBlockPool &&) = delete;
+  FixedBlockPool &operator=(const FixedBlockPool &) = delete;
+  FixedBlockPool &operator=(FixedBlockPool &&) = delete;
+
+  ///
+  ///\brief Get the pool instance for BlockSize.
+  ///
+  ///\return FixedBlockPool& the pool
+  ///
+  static FixedBlockPool &instance() noexcept(false) {
+    // Intentionally never destroyed, pooled objects may be released during static destruction.
+    static auto *pool = new FixedBlockPool();
+    return *pool;
+  }
+
+  ///
+  ///\brief Allocate a block. Reuses a cached block if possible.
+  ///
+  ///\return void* the block
+  ///
+  void *allocate() noexcept(false) {
+    {
+      std::unique_lock lock(this->mutex_);
+      if (this->free_list_ != nullptr) {
+        FreeBlock *block = this->free_list_;
+        this->free_list_ = block->next;
+        this->free_count_--;
+        return block;
+      }
+    }
+    return ::operator new(BlockSize);
+  }
+
+  ///
+  ///\brief Release a block, which was allocated by this pool.
+  ///
+  ///\param ptr the block
+  ///
+  void deallocate(void *ptr) noexcept(true) {
+    {
+      std::unique_lock lock(this->mutex_);
+      if (this->free_count_ < k_max_free_blocks) {
+        this->free_list_ = new (ptr) FreeBlock{this->free_list_};
+        this->free_count_++;
+        return;
+      }
+    }
+    ::operator delete(ptr);
+  }
+};
+
+///
+///\brief A std compatible allocator, which serves single objects from a FixedBlockPool
+/// matching their (aligned) size.
+///
+/// Array allocations and over-aligned types are forwarded to std::allocator.
+///
+///\tparam T the value type
+///
+template <typename T> class PoolAllocator {
+private:
+  template <typename U> static constexpr bool isPoolable() {
+    return alignof(U) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+  }
+
+  template <typename U> static constexpr std::size_t blockSize() {
+    constexpr std::size_t align = alignof(std::max_align_t);
+    return (std::max(sizeof(U), sizeof(void *)) + align - 1) / align * align;
+  }
+
+public:
+  using value_type = T;
+
+  PoolAllocator() noexcept(true) = default;
+
+  template <typename U> PoolAllocator(const PoolAllocator<U> &) noexcept(true) {}
+
+  ///
+  ///\brief Allocate memory for n objects of type T.
+  ///
+  ///\param n the number of objects
+  ///\return T* the uninitialized memory
+  ///
+  T *allocate(std::size_t n) noexcept(false) {
+    if constexpr (isPoolable<T>()) {
+      if (n == 1) {
+        return static_cast<T *>(FixedBlockPool<blockSize<T>()>::instance().allocate());
+      }
+    }
+    return std::allocator<T>().allocate(n);
+  }
+
+  ///
+  ///\brief Release memory allocated by allocate(n).
+  ///
+  ///\param ptr the memory
+  ///\param n the number of objects
+  ///
+  void deallocate(T *ptr, std::size_t n) noexcept(true) {
+    if constexpr (isPoolable<T>()) {
+      if (n == 1) {
+        FixedBlockPool<blockSize<T>()>::instance().deallocate(ptr);
+        return;
+      }
+    }
+    std::allocator<T>().deallocate(ptr, n);
+  }
+
+  template <typename U> bool operator==(const PoolAllocator<U> &) const noexcept(true) {
+    return true;
+  }
+
+  template <typename U> bool operator!=(const PoolAllocator<U> &) const noexcept(true) {
+    return false;
+  }
+};
+
+///
+///\brief Create a shared object (and its control block) in pooled memory. This is a drop-in
+/// replacement for std::make_shared.
+///
+///\tparam T the object type
+///\tparam Args the constructor argument types
+///\param args the constructor arguments
+///\return std::shared_ptr<T> the shared object
+///
+template <typename T, typename... Args> std::shared_ptr<T> makePooled(Args &&...args) {
+  return std::allocate_shared<T>(PoolAllocator<T>(), std::forward<Args>(args)...);
+}
+
+}  // namespace vda5050pp::misc
+
+#endif  // PUBLIC_VDA5050_2B_2B_MISC_POOL_ALLOCATOR_H_
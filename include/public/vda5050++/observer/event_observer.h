@@ -0,0 +1,112 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+
+#ifndef PUBLIC_VDA5050_2B_2B_OBSERVER_EVENT_OBSERVER_H_
+#define PUBLIC_VDA5050_2B_2B_OBSERVER_EVENT_OBSERVER_H_
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "vda5050++/config/event_manager_options.h"
+#include "vda5050++/misc/any_ptr.h"
+#include "vda5050++/misc/latency_histogram.h"
+
+namespace vda5050pp::observer {
+
+///
+///\brief The statistics of a single event id of an event manager.
+///
+struct EventStatistics {
+  /// \brief The name of the event manager
+  std::string manager;
+  /// \brief The (integral) id of the event inside of the manager
+  int event_id = 0;
+  /// \brief The number of enqueued events
+  uint64_t enqueued = 0;
+  /// \brief The number of processed events
+  uint64_t processed = 0;
+  /// \brief The number of events dropped due to a full queue
+  uint64_t dropped = 0;
+  /// \brief The number of events enqueued into a full queue with the k_block policy
+  uint64_t blocked = 0;
+  /// \brief The number of events, which exceeded the capacity of a full queue with the k_block
+  /// policy, because they were enqueued by an event worker (which never waits)
+  uint64_t overrun = 0;
+  /// \brief The time between enqueueing and the start of the dispatch
+  vda5050pp::misc::LatencyHistogram queue_wait;
+  /// \brief The time all subscribers took to handle the event
+  vda5050pp::misc::LatencyHistogram handler_duration;
+};
+
+///
+///\brief Describes the overflow of an event manager queue.
+///
+struct QueueOverflow {
+  /// \brief The name of the event manager
+  std::string_view manager;
+  /// \brief The (integral) id of the dropped or blocked event
+  int event_id = 0;
+  /// \brief The applied policy
+  vda5050pp::config::QueueOverflowPolicy policy = vda5050pp::config::QueueOverflowPolicy::k_block;
+  /// \brief The total number of overflows of this manager and event id (including this one)
+  uint64_t count = 0;
+};
+
+///
+///\brief The EventObserver class is used to observe the latency and throughput of the event
+/// managers inside the library.
+///
+/// Only asynchronously dispatched events are recorded. The recording can be disabled at compile
+/// time with the LIBVDA5050PP_EVENT_INSTRUMENTATION CMake option.
+///
+class EventObserver {
+private:
+  vda5050pp::misc::AnyPtr opaque_state_;
+
+public:
+  ///
+  ///\brief Construct a new Event Observer object (requires a running instance)
+  ///
+  EventObserver();
+
+  ///
+  ///\brief Check if the library was compiled with event instrumentation
+  ///
+  ///\return true if statistics are recorded
+  ///
+  static bool isEnabled();
+
+  ///
+  ///\brief Get the statistics of all event ids, which were enqueued so far
+  ///
+  ///\return std::vector<EventStatistics> the statistics
+  ///
+  std::vector<EventStatistics> getStatistics() const;
+
+  ///
+  ///\brief Get the statistics of all event ids of a single event manager
+  ///
+  ///\param manager the name of the manager (see EventStatistics::manager)
+  ///\return std::vector<EventStatistics> the statistics
+  ///
+  std::vector<EventStatistics> getStatistics(std::string_view manager) const;
+
+  ///
+  ///\brief Add a callback to be called when an event manager queue overflows
+  /// (see vda5050pp::config::QueueLimit). The callback is called by the enqueueing thread
+  /// and must return quickly.
+  ///
+  ///\param callback the callback to be called
+  ///
+  void onQueueOverflow(std::function<void(const QueueOverflow &)> callback);
+};
+
+}  // namespace vda5050pp::observer
+#endif  // PUBLIC_VDA5050_2B_2B_OBSERVER_EVENT_OBSERVER_H_
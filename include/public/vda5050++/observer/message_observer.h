@@ -19,13 +19,40 @@
 #include <functional>
 #include <optional>
 #include <shared_mutex>
+#include <string>
+#include <vector>
 
 #include "vda5050++/misc/any_ptr.h"
 #include "vda5050++/misc/connection_status.h"
+#include "vda5050++/misc/latency_histogram.h"
 #include "vda5050++/misc/message_error.h"
+#include "vda5050++/misc/outbound_buffer_statistics.h"
 
 namespace vda5050pp::observer {
 
+///
+///\brief The publish statistics of a single outgoing MQTT topic.
+///
+struct PublishStatistics {
+  /// \brief The topic (connection, factsheet, state or visualization)
+  std::string topic;
+  /// \brief The number of messages handed to the MQTT client
+  uint64_t published = 0;
+  /// \brief The number of delivered messages (QoS 0: sent, QoS 1/2: acknowledged)
+  uint64_t delivered = 0;
+  /// \brief The number of messages, which could not be delivered
+  uint64_t failed = 0;
+  /// \brief The number of messages currently published, but not delivered yet (gauge)
+  uint64_t in_flight = 0;
+  /// \brief The payload bytes of all in-flight messages (gauge)
+  uint64_t buffered_bytes = 0;
+  /// \brief The time from the creation of the send event until the message is handed to the
+  /// MQTT client (includes the time buffered while offline)
+  vda5050pp::misc::LatencyHistogram event_to_publish;
+  /// \brief The time from handing the message to the MQTT client until it was delivered
+  vda5050pp::misc::LatencyHistogram publish_to_delivery;
+};
+
 ///
 ///\brief The MessageObserver class is used observe the messaging status inside the library.
 ///
@@ -108,6 +135,22 @@ public:
   ///
   std::optional<vda5050pp::misc::ConnectionStatus> getConnectionStatus() const;
 
+  ///
+  ///\brief Get the counters of the buffer, which keeps outgoing messages while offline
+  ///
+  ///\return std::optional<vda5050pp::misc::OutboundBufferStatistics> the counters
+  /// (empty, if the MQTT module is not available)
+  ///
+  std::optional<vda5050pp::misc::OutboundBufferStatistics> getOutboundBufferStatistics() const;
+
+  ///
+  ///\brief Get the publish statistics of each outgoing topic
+  ///
+  ///\return std::vector<PublishStatistics> the statistics
+  /// (empty, if the MQTT module is not available)
+  ///
+  std::vector<PublishStatistics> getPublishStatistics() const;
+
   ///
   ///\brief Add a callback to be called when a valid order message is received
   ///
@@ -12,8 +12,14 @@
 #include <vda5050/Node.h>
 #include <vda5050/Velocity.h>
 
+#include <memory>
+
 #include "vda5050++/events/navigation_event.h"
 
+namespace vda5050pp::core {
+class Instance;
+}  // namespace vda5050pp::core
+
 namespace vda5050pp::sinks {
 
 ///
@@ -21,7 +27,16 @@ namespace vda5050pp::sinks {
 /// library.
 ///
 class NavigationSink {
+private:
+  // The instance bound at construction (empty: the default instance)
+  std::weak_ptr<vda5050pp::core::Instance> instance_;
+
 public:
+  ///
+  ///\brief Construct a new NavigationSink for the instance bound to the calling thread
+  /// (see vda5050pp::Handle::bind()) or, if there is none, the default instance.
+  ///
+  NavigationSink() noexcept(true);
   ///
   ///\brief set the current AGVPosition.
   ///
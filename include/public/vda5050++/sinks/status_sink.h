@@ -9,6 +9,7 @@
 #define PUBLIC_VDA5050_2B_2B_SINKS_STATUS_SINK_H_
 
 #include <functional>
+#include <memory>
 #include <string_view>
 #include <vector>
 
@@ -18,6 +19,10 @@
 #include "vda5050/Load.h"
 #include "vda5050/OperatingMode.h"
 
+namespace vda5050pp::core {
+class Instance;
+}  // namespace vda5050pp::core
+
 namespace vda5050pp::sinks {
 
 ///
@@ -25,7 +30,16 @@ namespace vda5050pp::sinks {
 /// library.
 ///
 class StatusSink {
+private:
+  // The instance bound at construction (empty: the default instance)
+  std::weak_ptr<vda5050pp::core::Instance> instance_;
+
 public:
+  ///
+  ///\brief Construct a new StatusSink for the instance bound to the calling thread
+  /// (see vda5050pp::Handle::bind()) or, if there is none, the default instance.
+  ///
+  StatusSink() noexcept(true);
   ///
   ///\brief Add a new Load to the state.
   ///
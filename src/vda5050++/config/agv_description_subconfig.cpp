@@ -189,6 +189,27 @@ static vda5050pp::agv_description::SimpleProtocolLimits fromSimpleProtocolLimits
   if (auto ml = node["max_loads"].value<uint32_t>(); ml) {
     simple_protocol_limits.max_loads = *ml;
   }
+  if (auto value = node["max_message_len"].value<uint32_t>(); value) {
+    simple_protocol_limits.max_message_len = *value;
+  }
+  if (auto value = node["max_order_nodes"].value<uint32_t>(); value) {
+    simple_protocol_limits.max_order_nodes = *value;
+  }
+  if (auto value = node["max_order_edges"].value<uint32_t>(); value) {
+    simple_protocol_limits.max_order_edges = *value;
+  }
+  if (auto value = node["max_node_actions"].value<uint32_t>(); value) {
+    simple_protocol_limits.max_node_actions = *value;
+  }
+  if (auto value = node["max_edge_actions"].value<uint32_t>(); value) {
+    simple_protocol_limits.max_edge_actions = *value;
+  }
+  if (auto value = node["max_instant_actions"].value<uint32_t>(); value) {
+    simple_protocol_limits.max_instant_actions = *value;
+  }
+  if (auto value = node["max_action_parameters"].value<uint32_t>(); value) {
+    simple_protocol_limits.max_action_parameters = *value;
+  }
 
   return simple_protocol_limits;
 }
@@ -206,8 +227,29 @@ static toml::table toSimpleProtocolLimitsTable(
   if (simple_protocol_limits.max_load_id_len) {
     table.insert("max_load_id_len", *simple_protocol_limits.max_load_id_len);
   }
-  if (simple_protocol_limits.max_id_len) {
-    table.insert("max_id_len", *simple_protocol_limits.max_id_len);
+  if (simple_protocol_limits.max_loads) {
+    table.insert("max_loads", *simple_protocol_limits.max_loads);
+  }
+  if (simple_protocol_limits.max_message_len) {
+    table.insert("max_message_len", *simple_protocol_limits.max_message_len);
+  }
+  if (simple_protocol_limits.max_order_nodes) {
+    table.insert("max_order_nodes", *simple_protocol_limits.max_order_nodes);
+  }
+  if (simple_protocol_limits.max_order_edges) {
+    table.insert("max_order_edges", *simple_protocol_limits.max_order_edges);
+  }
+  if (simple_protocol_limits.max_node_actions) {
+    table.insert("max_node_actions", *simple_protocol_limits.max_node_actions);
+  }
+  if (simple_protocol_limits.max_edge_actions) {
+    table.insert("max_edge_actions", *simple_protocol_limits.max_edge_actions);
+  }
+  if (simple_protocol_limits.max_instant_actions) {
+    table.insert("max_instant_actions", *simple_protocol_limits.max_instant_actions);
+  }
+  if (simple_protocol_limits.max_action_parameters) {
+    table.insert("max_action_parameters", *simple_protocol_limits.max_action_parameters);
   }
 
   return table;
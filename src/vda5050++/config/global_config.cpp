@@ -6,16 +6,84 @@
 //
 #include "vda5050++/config/global_config.h"
 
+#include <algorithm>
+
 #include "vda5050++/core/config.h"
 
 using namespace vda5050pp::config;
 
+inline QueueOverflowPolicy queueOverflowPolicyFromString(std::string_view str) {
+  if (str == "block") {
+    return QueueOverflowPolicy::k_block;
+  } else if (str == "drop_oldest") {
+    return QueueOverflowPolicy::k_drop_oldest;
+  } else if (str == "drop_newest") {
+    return QueueOverflowPolicy::k_drop_newest;
+  } else if (str == "coalesce") {
+    return QueueOverflowPolicy::k_coalesce;
+  } else {
+    throw vda5050pp::VDA5050PPTOMLError(
+        MK_FN_EX_CONTEXT(fmt::format("Unknown QueueOverflowPolicy \"{}\"", str)));
+  }
+}
+
+inline std::string_view queueOverflowPolicyToString(QueueOverflowPolicy policy) {
+  switch (policy) {
+    case QueueOverflowPolicy::k_block:
+      return "block";
+    case QueueOverflowPolicy::k_drop_oldest:
+      return "drop_oldest";
+    case QueueOverflowPolicy::k_drop_newest:
+      return "drop_newest";
+    case QueueOverflowPolicy::k_coalesce:
+      return "coalesce";
+    default:
+      throw vda5050pp::VDA5050PPTOMLError(
+          MK_FN_EX_CONTEXT(fmt::format("Unknown QueueOverflowPolicy \"{}\"", int(policy))));
+  }
+}
+
+inline QueueLimit queueLimitFrom(toml::node_view<const toml::node> node_view) {
+  QueueLimit limit;
+  limit.capacity =
+      static_cast<std::size_t>(std::max<int64_t>(0, node_view["capacity"].value_or<int64_t>(0)));
+  if (auto policy = node_view["policy"].value<std::string_view>(); policy.has_value()) {
+    limit.policy = queueOverflowPolicyFromString(*policy);
+  }
+  return limit;
+}
+
+inline toml::table queueLimitTo(const QueueLimit &limit) {
+  return toml::table{
+      {"capacity", static_cast<int64_t>(limit.capacity)},
+      {"policy", queueOverflowPolicyToString(limit.policy)},
+  };
+}
+
 void GlobalConfig::getFrom(const ConstConfigNode &node) {
   auto node_view = core::config::ConstConfigNode::upcast(node).get();
 
   this->LoggingSubConfig::getFrom(node);
   this->event_manager_options_.synchronous_event_dispatch =
       node_view["event_manager_options.synchronous_event_dispatch"].value_or(false);
+  this->event_manager_options_.worker_pool_size = static_cast<std::size_t>(std::max<int64_t>(
+      0, node_view["event_manager_options.worker_pool_size"].value_or<int64_t>(0)));
+  this->event_manager_options_.share_worker_pool =
+      node_view["event_manager_options.share_worker_pool"].value_or(false);
+  this->event_manager_options_.coalesce_navigation_status =
+      node_view["event_manager_options.coalesce_navigation_status"].value_or(false);
+  this->event_manager_options_.parallel_action_validation =
+      node_view["event_manager_options.parallel_action_validation"].value_or(false);
+  this->event_manager_options_.default_queue_limit =
+      queueLimitFrom(node_view["event_manager_options.default_queue_limit"]);
+  this->event_manager_options_.queue_limits.clear();
+  if (auto limits = node_view["event_manager_options.queue_limits"].as_table();
+      limits != nullptr) {
+    for (const auto &[manager, limit] : *limits) {
+      this->event_manager_options_.queue_limits[std::string(manager.str())] =
+          queueLimitFrom(toml::node_view<const toml::node>(limit));
+    }
+  }
 
   auto bl = node_view["module_black_list"];
   auto wl = node_view["module_white_list"];
@@ -39,9 +107,24 @@ void GlobalConfig::putTo(ConfigNode &node) const {
   auto table = core::config::ConfigNode::upcast(node).get().as_table();
 
   this->LoggingSubConfig::putTo(node);
-  table->insert("event_manager_options",
-                toml::table{{"synchronous_event_dispatch",
-                             this->event_manager_options_.synchronous_event_dispatch}});
+  toml::table queue_limits;
+  for (const auto &[manager, limit] : this->event_manager_options_.queue_limits) {
+    queue_limits.insert(manager, queueLimitTo(limit));
+  }
+
+  table->insert(
+      "event_manager_options",
+      toml::table{
+          {"synchronous_event_dispatch", this->event_manager_options_.synchronous_event_dispatch},
+          {"worker_pool_size", static_cast<int64_t>(this->event_manager_options_.worker_pool_size)},
+          {"share_worker_pool", this->event_manager_options_.share_worker_pool},
+          {"coalesce_navigation_status",
+           this->event_manager_options_.coalesce_navigation_status},
+          {"parallel_action_validation",
+           this->event_manager_options_.parallel_action_validation},
+          {"default_queue_limit", queueLimitTo(this->event_manager_options_.default_queue_limit)},
+          {"queue_limits", std::move(queue_limits)},
+      });
 
   if (!this->module_bw_list_.empty()) {
     toml::array module_list;
@@ -6,11 +6,22 @@
 //
 #include "vda5050++/config/mqtt_subconfig.h"
 
+#include <algorithm>
+
 #include "vda5050++/core/config.h"
 
 using namespace vda5050pp::config;
 using namespace std::string_view_literals;
 
+static int getQos(toml::node_view<const toml::node> qos_node, std::string_view key) {
+  auto qos = qos_node[key].value_or<int64_t>(0);
+  if (qos < 0 || qos > 2) {
+    throw vda5050pp::VDA5050PPInvalidConfiguration(
+        MK_FN_EX_CONTEXT(fmt::format("MQTT QoS of {} must be 0, 1 or 2 (got {})", key, qos)));
+  }
+  return static_cast<int>(qos);
+}
+
 constexpr std::optional<std::chrono::milliseconds> applyMS(std::optional<int64_t> value) {
   if (value.has_value()) {
     return std::chrono::milliseconds(value.value());
@@ -35,6 +46,31 @@ void MqttSubConfig::getFrom(const ConstConfigNode &node) {
   this->options_.keep_alive_interval_ =
       applyMS(toml_node["keep_alive_interval_ms"].value<int64_t>());
   this->options_.connect_timeout_ = applyMS(toml_node["connect_timeout_ms"].value<int64_t>());
+  this->options_.decode_workers = static_cast<std::size_t>(
+      std::max<int64_t>(0, toml_node["decode_workers"].value_or<int64_t>(2)));
+  this->options_.offline_buffering = toml_node["offline_buffering"].value_or(true);
+  this->options_.offline_max_age_ =
+      applyMS(toml_node["offline_max_age_ms"].value<int64_t>());
+
+  auto qos_node = toml_node["qos"];
+  this->options_.qos.connection = getQos(qos_node, "connection");
+  this->options_.qos.factsheet = getQos(qos_node, "factsheet");
+  this->options_.qos.instant_actions = getQos(qos_node, "instant_actions");
+  this->options_.qos.order = getQos(qos_node, "order");
+  this->options_.qos.state = getQos(qos_node, "state");
+  this->options_.qos.visualization = getQos(qos_node, "visualization");
+  this->options_.persistence_dir = toml_node["persistence_dir"].value<std::string>();
+  this->options_.max_inflight = toml_node["max_inflight"].value<int>();
+  this->options_.max_buffered_messages = toml_node["max_buffered_messages"].value<int>();
+  this->options_.mqtt_version = toml_node["mqtt_version"].value_or(4);
+  if (this->options_.mqtt_version < 3 || this->options_.mqtt_version > 5) {
+    throw vda5050pp::VDA5050PPInvalidConfiguration(MK_EX_CONTEXT(fmt::format(
+        "MQTT version must be 3, 4 or 5 (got {})", this->options_.mqtt_version)));
+  }
+  this->options_.topic_aliases = toml_node["topic_aliases"].value_or(true);
+  this->options_.visualization_ttl_ =
+      applyMS(toml_node["visualization_ttl_ms"].value<int64_t>());
+  this->options_.shared_connection = toml_node["shared_connection"].value_or(false);
 }
 
 void MqttSubConfig::putTo(ConfigNode &node) const {
@@ -79,6 +115,43 @@ void MqttSubConfig::putTo(ConfigNode &node) const {
                                      this->options_.connect_timeout_.value())
                                      .count());
   }
+  toml_node.as_table()->insert("decode_workers",
+                               static_cast<int64_t>(this->options_.decode_workers));
+  toml_node.as_table()->insert("offline_buffering", this->options_.offline_buffering);
+  if (this->options_.offline_max_age_.has_value()) {
+    toml_node.as_table()->insert("offline_max_age_ms",
+                                 std::chrono::duration_cast<std::chrono::milliseconds>(
+                                     this->options_.offline_max_age_.value())
+                                     .count());
+  }
+
+  toml::table qos_table;
+  qos_table.insert("connection", this->options_.qos.connection);
+  qos_table.insert("factsheet", this->options_.qos.factsheet);
+  qos_table.insert("instant_actions", this->options_.qos.instant_actions);
+  qos_table.insert("order", this->options_.qos.order);
+  qos_table.insert("state", this->options_.qos.state);
+  qos_table.insert("visualization", this->options_.qos.visualization);
+  toml_node.as_table()->insert("qos", std::move(qos_table));
+  if (this->options_.persistence_dir.has_value()) {
+    toml_node.as_table()->insert("persistence_dir", this->options_.persistence_dir.value());
+  }
+  if (this->options_.max_inflight.has_value()) {
+    toml_node.as_table()->insert("max_inflight", this->options_.max_inflight.value());
+  }
+  if (this->options_.max_buffered_messages.has_value()) {
+    toml_node.as_table()->insert("max_buffered_messages",
+                                 this->options_.max_buffered_messages.value());
+  }
+  toml_node.as_table()->insert("mqtt_version", this->options_.mqtt_version);
+  toml_node.as_table()->insert("topic_aliases", this->options_.topic_aliases);
+  if (this->options_.visualization_ttl_.has_value()) {
+    toml_node.as_table()->insert("visualization_ttl_ms",
+                                 std::chrono::duration_cast<std::chrono::milliseconds>(
+                                     this->options_.visualization_ttl_.value())
+                                     .count());
+  }
+  toml_node.as_table()->insert("shared_connection", this->options_.shared_connection);
 }
 
 void MqttSubConfig::setOptions(const MqttOptions &options) { this->options_ = options; }
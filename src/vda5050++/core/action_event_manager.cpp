@@ -9,14 +9,12 @@
 
 #include <eventpp/utilities/argumentadapter.h>
 
-#include <chrono>
-
+#include "vda5050++/core/common/event_processing.h"
 #include "vda5050++/core/common/exception.h"
 #include "vda5050++/core/common/formatters.h"
 #include "vda5050++/core/logger.h"
 
 using namespace vda5050pp::core;
-using namespace std::chrono_literals;
 
 ScopedActionEventSubscriber::ScopedActionEventSubscriber(ActionEventQueue &queue)
     : remover_(queue) {}
@@ -92,30 +90,21 @@ void ScopedActionEventSubscriber::subscribe(
           std::move(callback)));
 }
 
-ActionEventManager::ActionEventManager(const vda5050pp::config::EventManagerOptions &opts)
-    : opts_(opts),
-      thread_(
-          std::bind(std::mem_fn(&ActionEventManager::threadTask), this, std::placeholders::_1)) {}
-
-void ActionEventManager::threadTask(vda5050pp::core::common::StopToken tkn) noexcept(true) {
-  if (this->opts_.synchronous_event_dispatch) {
-    // This thread loop is not needed
-    return;
-  }
+ActionEventManager::ActionEventManager(
+    const vda5050pp::config::EventManagerOptions &opts,
+    std::shared_ptr<vda5050pp::core::common::WorkerPool> worker_pool, Instance *instance)
+    : statistics_recorder_("ActionEventManager"),
+      opts_(opts),
+      processor_([this] { this->processQueue(); }, opts, worker_pool, instance) {
+  vda5050pp::core::common::setStatisticsRecorder(this->action_event_queue_,
+                                                 &this->statistics_recorder_);
+  vda5050pp::core::common::setQueueLimit(
+      this->action_event_queue_, opts.getQueueLimit(this->statistics_recorder_.getManagerName()));
+}
 
-  try {
-    while (!tkn.stopRequested()) {
-      if (this->action_event_queue_.processUntil([&tkn] { return tkn.stopRequested(); })) {
-        // no pause
-      } else {
-        std::this_thread::sleep_for(10ms);
-      }
-    }
-  } catch (const vda5050pp::VDA5050PPError &err) {
-    getEventsLogger()->error(
-        "ActionEventManager caught an exception, while processing events:\n {}", err);
-    // TODO: Handle critical exceptions
-  }
+void ActionEventManager::processQueue() noexcept(true) {
+  vda5050pp::core::common::processEvents([this] { return this->action_event_queue_.processOne(); },
+                                         "ActionEventManager");
 }
 
 void ActionEventManager::dispatch(std::shared_ptr<vda5050pp::events::ActionList> data,
@@ -124,6 +113,7 @@ void ActionEventManager::dispatch(std::shared_ptr<vda5050pp::events::ActionList>
     this->action_event_queue_.dispatch(vda5050pp::events::ActionEventType::k_action_list, data);
   } else {
     this->action_event_queue_.enqueue(vda5050pp::events::ActionEventType::k_action_list, data);
+    this->processor_.notify();
   }
 }
 
@@ -133,6 +123,7 @@ void ActionEventManager::dispatch(std::shared_ptr<vda5050pp::events::ActionValid
     this->action_event_queue_.dispatch(vda5050pp::events::ActionEventType::k_action_validate, data);
   } else {
     this->action_event_queue_.enqueue(vda5050pp::events::ActionEventType::k_action_validate, data);
+    this->processor_.notify();
   }
 }
 
@@ -142,6 +133,7 @@ void ActionEventManager::dispatch(std::shared_ptr<vda5050pp::events::ActionPrepa
     this->action_event_queue_.dispatch(vda5050pp::events::ActionEventType::k_action_prepare, data);
   } else {
     this->action_event_queue_.enqueue(vda5050pp::events::ActionEventType::k_action_prepare, data);
+    this->processor_.notify();
   }
 }
 
@@ -151,6 +143,7 @@ void ActionEventManager::dispatch(std::shared_ptr<vda5050pp::events::ActionStart
     this->action_event_queue_.dispatch(vda5050pp::events::ActionEventType::k_action_start, data);
   } else {
     this->action_event_queue_.enqueue(vda5050pp::events::ActionEventType::k_action_start, data);
+    this->processor_.notify();
   }
 }
 
@@ -160,6 +153,7 @@ void ActionEventManager::dispatch(std::shared_ptr<vda5050pp::events::ActionPause
     this->action_event_queue_.dispatch(vda5050pp::events::ActionEventType::k_action_pause, data);
   } else {
     this->action_event_queue_.enqueue(vda5050pp::events::ActionEventType::k_action_pause, data);
+    this->processor_.notify();
   }
 }
 
@@ -169,6 +163,7 @@ void ActionEventManager::dispatch(std::shared_ptr<vda5050pp::events::ActionResum
     this->action_event_queue_.dispatch(vda5050pp::events::ActionEventType::k_action_resume, data);
   } else {
     this->action_event_queue_.enqueue(vda5050pp::events::ActionEventType::k_action_resume, data);
+    this->processor_.notify();
   }
 }
 
@@ -178,6 +173,7 @@ void ActionEventManager::dispatch(std::shared_ptr<vda5050pp::events::ActionCance
     this->action_event_queue_.dispatch(vda5050pp::events::ActionEventType::k_action_cancel, data);
   } else {
     this->action_event_queue_.enqueue(vda5050pp::events::ActionEventType::k_action_cancel, data);
+    this->processor_.notify();
   }
 }
 
@@ -187,9 +183,15 @@ void ActionEventManager::dispatch(std::shared_ptr<vda5050pp::events::ActionForge
     this->action_event_queue_.dispatch(vda5050pp::events::ActionEventType::k_action_forget, data);
   } else {
     this->action_event_queue_.enqueue(vda5050pp::events::ActionEventType::k_action_forget, data);
+    this->processor_.notify();
   }
 }
 
 ScopedActionEventSubscriber ActionEventManager::getScopedActionEventSubscriber() noexcept(true) {
   return ScopedActionEventSubscriber(this->action_event_queue_);
-}
\ No newline at end of file
+}
+
+const vda5050pp::core::common::EventStatisticsRecorder &
+ActionEventManager::getStatisticsRecorder() const noexcept(true) {
+  return this->statistics_recorder_;
+}
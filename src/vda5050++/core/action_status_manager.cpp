@@ -9,14 +9,12 @@
 
 #include <eventpp/utilities/argumentadapter.h>
 
-#include <chrono>
-
+#include "vda5050++/core/common/event_processing.h"
 #include "vda5050++/core/common/exception.h"
 #include "vda5050++/core/common/formatters.h"
 #include "vda5050++/core/logger.h"
 
 using namespace vda5050pp::core;
-using namespace std::chrono_literals;
 
 ScopedActionStatusSubscriber::ScopedActionStatusSubscriber(ActionStatusQueue &queue)
     : remover_(queue) {}
@@ -75,30 +73,21 @@ void ScopedActionStatusSubscriber::subscribe(
           std::move(callback)));
 }
 
-ActionStatusManager::ActionStatusManager(const vda5050pp::config::EventManagerOptions &opts)
-    : opts_(opts),
-      thread_(
-          std::bind(std::mem_fn(&ActionStatusManager::threadTask), this, std::placeholders::_1)) {}
-
-void ActionStatusManager::threadTask(vda5050pp::core::common::StopToken tkn) noexcept(true) {
-  if (this->opts_.synchronous_event_dispatch) {
-    // This event loop is not needed
-    return;
-  }
+ActionStatusManager::ActionStatusManager(
+    const vda5050pp::config::EventManagerOptions &opts,
+    std::shared_ptr<vda5050pp::core::common::WorkerPool> worker_pool, Instance *instance)
+    : statistics_recorder_("ActionStatusManager"),
+      opts_(opts),
+      processor_([this] { this->processQueue(); }, opts, worker_pool, instance) {
+  vda5050pp::core::common::setStatisticsRecorder(this->action_status_queue_,
+                                                 &this->statistics_recorder_);
+  vda5050pp::core::common::setQueueLimit(
+      this->action_status_queue_, opts.getQueueLimit(this->statistics_recorder_.getManagerName()));
+}
 
-  try {
-    while (!tkn.stopRequested()) {
-      if (this->action_status_queue_.processUntil([&tkn] { return tkn.stopRequested(); })) {
-        // no pause
-      } else {
-        std::this_thread::sleep_for(10ms);
-      }
-    }
-  } catch (const vda5050pp::VDA5050PPError &err) {
-    getEventsLogger()->error(
-        "ActionStatusManager caught an exception, while processing events:\n {}", err);
-    // TODO: Handle critical exceptions
-  }
+void ActionStatusManager::processQueue() noexcept(true) {
+  vda5050pp::core::common::processEvents([this] { return this->action_status_queue_.processOne(); },
+                                         "ActionStatusManager");
 }
 
 void ActionStatusManager::dispatch(
@@ -109,6 +98,7 @@ void ActionStatusManager::dispatch(
   } else {
     this->action_status_queue_.enqueue(
         vda5050pp::events::ActionStatusType::k_action_status_initializing, data);
+    this->processor_.notify();
   }
 }
 
@@ -120,6 +110,7 @@ void ActionStatusManager::dispatch(
   } else {
     this->action_status_queue_.enqueue(vda5050pp::events::ActionStatusType::k_action_status_waiting,
                                        data);
+    this->processor_.notify();
   }
 }
 
@@ -131,6 +122,7 @@ void ActionStatusManager::dispatch(
   } else {
     this->action_status_queue_.enqueue(vda5050pp::events::ActionStatusType::k_action_status_running,
                                        data);
+    this->processor_.notify();
   }
 }
 
@@ -142,6 +134,7 @@ void ActionStatusManager::dispatch(
   } else {
     this->action_status_queue_.enqueue(vda5050pp::events::ActionStatusType::k_action_status_paused,
                                        data);
+    this->processor_.notify();
   }
 }
 
@@ -153,6 +146,7 @@ void ActionStatusManager::dispatch(
   } else {
     this->action_status_queue_.enqueue(
         vda5050pp::events::ActionStatusType::k_action_status_finished, data);
+    this->processor_.notify();
   }
 }
 
@@ -164,9 +158,15 @@ void ActionStatusManager::dispatch(
   } else {
     this->action_status_queue_.enqueue(vda5050pp::events::ActionStatusType::k_action_status_failed,
                                        data);
+    this->processor_.notify();
   }
 }
 
 ScopedActionStatusSubscriber ActionStatusManager::getScopedActionStatusSubscriber() noexcept(true) {
   return ScopedActionStatusSubscriber(this->action_status_queue_);
-}
\ No newline at end of file
+}
+
+const vda5050pp::core::common::EventStatisticsRecorder &
+ActionStatusManager::getStatisticsRecorder() const noexcept(true) {
+  return this->statistics_recorder_;
+}
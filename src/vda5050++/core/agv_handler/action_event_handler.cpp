@@ -40,6 +40,7 @@ void ActionEventHandler::initialize(vda5050pp::core::Instance &instance) noexcep
 
 void ActionEventHandler::deinitialize(vda5050pp::core::Instance &) noexcept(false) {
   this->subscriber_.reset();
+  std::unique_lock lock(this->handled_actions_mutex_);
   this->handled_actions_.clear();
 }
 
@@ -65,44 +66,64 @@ void ActionEventHandler::handleValidateEvent(
     return;
   }
 
-  // Search appropiate handler
-  for (auto action_handler : Instance::ref().getActionHandler()) {
-    if (action_handler->match(*data->action)) {
-      // Get the validation result
-      vda5050pp::handler::ValidationResult validation_result;
-      try {
-        validation_result = action_handler->validate(*data->action, data->context);
-      } catch (vda5050pp::VDA5050PPError &e) {
-        e.addAdditionalContext("action_handler.action_id", data->action->actionId);
-        getAGVHandlerLogger()->error(
-            "ActionHandler(@{}).validate threw an exception, cannot validate.",
-            data->action->actionId);
-        result_token.setException(std::current_exception());
-        throw std::move(e);
+  // Search appropiate handler (actions may be validated in parallel, see isThreadSafe())
+  auto &instance = Instance::ref();
+  std::unique_lock unsafe_lock(this->unsafe_handler_mutex_, std::defer_lock);
+  auto action_handler = instance.getIndexedActionHandler(data->action->actionType);
+  if (action_handler == nullptr) {
+    // Fall back to the handlers, which match dynamically
+    for (const auto &dynamic_handler : instance.getDynamicActionHandler()) {
+      if (!dynamic_handler->isThreadSafe() && !unsafe_lock.owns_lock()) {
+        unsafe_lock.lock();
       }
+      if (dynamic_handler->match(*data->action)) {
+        action_handler = dynamic_handler;
+        break;
+      }
+    }
+  }
 
-      // Register a new action store if there was no error and the action is meant to be kept
-      if (validation_result.errors.empty() && data->keep) {
-        ActionStore store;
-        store.action = data->action;
-        store.action_parameters = std::make_shared<
-            std::map<std::string, vda5050pp::handler::ParameterValue, std::less<>>>(
-            std::move(validation_result.parameters));
-        store.action_handler = action_handler;
+  if (action_handler == nullptr) {
+    // Not matched
+    getAGVHandlerLogger()->debug("Action(type={}, id={}) is unhandled.", data->action->actionType,
+                                 data->action->actionId);
+    result_token.release();
+    return;
+  }
 
-        this->handled_actions_.insert_or_assign(data->action->actionId, std::move(store));
-      }
+  if (!action_handler->isThreadSafe() && !unsafe_lock.owns_lock()) {
+    unsafe_lock.lock();
+  }
 
-      result_token.setValue(std::move(validation_result.errors));
+  // Get the validation result
+  vda5050pp::handler::ValidationResult validation_result;
+  try {
+    validation_result = action_handler->validate(*data->action, data->context);
+  } catch (vda5050pp::VDA5050PPError &e) {
+    e.addAdditionalContext("action_handler.action_id", data->action->actionId);
+    getAGVHandlerLogger()->error("ActionHandler(@{}).validate threw an exception, cannot validate.",
+                                 data->action->actionId);
+    result_token.setException(std::current_exception());
+    throw std::move(e);
+  }
+  if (unsafe_lock.owns_lock()) {
+    unsafe_lock.unlock();
+  }
 
-      return;
-    }
+  // Register a new action store if there was no error and the action is meant to be kept
+  if (validation_result.errors.empty() && data->keep) {
+    ActionStore store;
+    store.action = data->action;
+    store.action_parameters =
+        std::make_shared<std::map<std::string, vda5050pp::handler::ParameterValue, std::less<>>>(
+            std::move(validation_result.parameters));
+    store.action_handler = action_handler;
+
+    std::unique_lock lock(this->handled_actions_mutex_);
+    this->handled_actions_.insert_or_assign(data->action->actionId, std::move(store));
   }
 
-  // Not matched
-  getAGVHandlerLogger()->debug("Action(type={}, id={}) is unhandled.", data->action->actionType,
-                               data->action->actionId);
-  result_token.release();
+  result_token.setValue(std::move(validation_result.errors));
 }
 
 void ActionEventHandler::handleActionListEvent(
@@ -282,6 +303,8 @@ void ActionEventHandler::handleForgetEvent(
 
 std::optional<std::reference_wrapper<ActionEventHandler::ActionStore>>
 ActionEventHandler::tryFindHandledAction(std::string_view action_id) {
+  // The references stay valid, only this thread removes action stores
+  std::unique_lock lock(this->handled_actions_mutex_);
   auto it = this->handled_actions_.find(action_id);
 
   if (it == this->handled_actions_.end()) {
@@ -292,6 +315,7 @@ ActionEventHandler::tryFindHandledAction(std::string_view action_id) {
 }
 
 bool ActionEventHandler::tryRemoveActionStore(std::string_view action_id) {
+  std::unique_lock lock(this->handled_actions_mutex_);
   auto it = this->handled_actions_.find(action_id);
 
   if (it == this->handled_actions_.end()) {
@@ -8,34 +8,38 @@
 
 #include "vda5050++/core/common/exception.h"
 #include "vda5050++/core/instance.h"
+#include "vda5050++/misc/pool_allocator.h"
 
 using namespace vda5050pp::core::agv_handler;
 
 ActionState::ActionState(std::shared_ptr<const vda5050::Action> action) noexcept(true)
-    : vda5050pp::handler::ActionState(std::move(action)) {}
+    : vda5050pp::handler::ActionState(std::move(action)), instance_(Instance::threadBinding()) {}
 
 void ActionState::setRunning() noexcept(false) {
-  auto &manager = Instance::ref().getActionStatusManager();
+  auto instance = Instance::resolve(this->instance_);
+  auto &manager = instance->getActionStatusManager();
 
-  auto event = std::make_shared<vda5050pp::events::ActionStatusRunning>();
+  auto event = vda5050pp::misc::makePooled<vda5050pp::events::ActionStatusRunning>();
   event->action_id = this->getAction().actionId;
 
   manager.dispatch(event);
 }
 
 void ActionState::setPaused() noexcept(false) {
-  auto &manager = Instance::ref().getActionStatusManager();
+  auto instance = Instance::resolve(this->instance_);
+  auto &manager = instance->getActionStatusManager();
 
-  auto event = std::make_shared<vda5050pp::events::ActionStatusPaused>();
+  auto event = vda5050pp::misc::makePooled<vda5050pp::events::ActionStatusPaused>();
   event->action_id = this->getAction().actionId;
 
   manager.dispatch(event);
 }
 
 void ActionState::setFinished() noexcept(false) {
-  auto &manager = Instance::ref().getActionStatusManager();
+  auto instance = Instance::resolve(this->instance_);
+  auto &manager = instance->getActionStatusManager();
 
-  auto event = std::make_shared<vda5050pp::events::ActionStatusFinished>();
+  auto event = vda5050pp::misc::makePooled<vda5050pp::events::ActionStatusFinished>();
   event->action_id = this->getAction().actionId;
   event->action_result = std::nullopt;
 
@@ -43,9 +47,10 @@ void ActionState::setFinished() noexcept(false) {
 }
 
 void ActionState::setFinished(std::string_view result_code) noexcept(false) {
-  auto &manager = Instance::ref().getActionStatusManager();
+  auto instance = Instance::resolve(this->instance_);
+  auto &manager = instance->getActionStatusManager();
 
-  auto event = std::make_shared<vda5050pp::events::ActionStatusFinished>();
+  auto event = vda5050pp::misc::makePooled<vda5050pp::events::ActionStatusFinished>();
   event->action_id = this->getAction().actionId;
   event->action_result = result_code;
 
@@ -53,9 +58,10 @@ void ActionState::setFinished(std::string_view result_code) noexcept(false) {
 }
 
 void ActionState::setFailed() noexcept(false) {
-  auto &manager = Instance::ref().getActionStatusManager();
+  auto instance = Instance::resolve(this->instance_);
+  auto &manager = instance->getActionStatusManager();
 
-  auto event = std::make_shared<vda5050pp::events::ActionStatusFailed>();
+  auto event = vda5050pp::misc::makePooled<vda5050pp::events::ActionStatusFailed>();
   event->action_id = this->getAction().actionId;
   event->action_errors = {};
 
@@ -63,9 +69,10 @@ void ActionState::setFailed() noexcept(false) {
 }
 
 void ActionState::setFailed(const std::list<vda5050::Error> &errors) noexcept(false) {
-  auto &manager = Instance::ref().getActionStatusManager();
+  auto instance = Instance::resolve(this->instance_);
+  auto &manager = instance->getActionStatusManager();
 
-  auto event = std::make_shared<vda5050pp::events::ActionStatusFailed>();
+  auto event = vda5050pp::misc::makePooled<vda5050pp::events::ActionStatusFailed>();
   event->action_id = this->getAction().actionId;
   event->action_errors = errors;
 
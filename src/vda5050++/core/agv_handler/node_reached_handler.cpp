@@ -10,6 +10,7 @@
 #include "vda5050++/core/common/exception.h"
 #include "vda5050++/core/common/math/geometry.h"
 #include "vda5050++/core/instance.h"
+#include "vda5050++/misc/pool_allocator.h"
 
 using namespace vda5050pp::core::agv_handler;
 
@@ -64,7 +65,8 @@ void NodeReachedHandler::handleNavigationStatusPosition(
       reached);
 
   if (reached) {
-    auto reached_evt = std::make_shared<vda5050pp::events::NavigationStatusNodeReached>();
+    auto reached_evt =
+        vda5050pp::misc::makePooled<vda5050pp::events::NavigationStatusNodeReached>();
     reached_evt->node_seq_id = goal->getSequenceId();
     Instance::ref().getNavigationStatusManager().dispatch(reached_evt);
   }
@@ -0,0 +1,110 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+
+#include "vda5050++/core/common/coroutine.h"
+
+#ifdef LIBVDA5050PP_COROUTINES
+
+#include "vda5050++/core/common/exception.h"
+#include "vda5050++/core/logger.h"
+
+using namespace vda5050pp::core::common;
+
+void CoroutineExecutor::timerTask(const std::shared_ptr<State> &state) noexcept(true) {
+  std::unique_lock lock(state->mutex);
+
+  while (!state->closed) {
+    if (state->deadlines.empty()) {
+      state->cv.wait(lock);
+      continue;
+    }
+
+    auto first = state->deadlines.begin();
+    if (std::chrono::steady_clock::now() < first->first) {
+      state->cv.wait_until(lock, first->first);
+      continue;
+    }
+
+    auto fn = std::move(first->second);
+    state->deadlines.erase(first);
+    lock.unlock();
+
+    try {
+      InstanceScope scope(state->instance);
+      fn();
+    } catch (const std::exception &e) {
+      vda5050pp::core::getEventsLogger()->error("CoroutineExecutor deadline threw an exception: {}",
+                                                e.what());
+    }
+
+    lock.lock();
+  }
+}
+
+CoroutineExecutor::CoroutineExecutor(std::shared_ptr<WorkerPool> pool, Instance *instance) noexcept(
+    false)
+    : state_(std::make_shared<State>()) {
+  this->state_->pool = pool != nullptr ? std::move(pool) : std::make_shared<WorkerPool>(1);
+  this->state_->instance = instance;
+  this->timer_thread_.emplace([state = this->state_](StopToken) { timerTask(state); });
+}
+
+CoroutineExecutor::~CoroutineExecutor() noexcept(true) {
+  std::shared_ptr<WorkerPool> pool;
+  {
+    std::unique_lock lock(this->state_->mutex);
+    this->state_->closed = true;
+    this->state_->deadlines.clear();
+    // Release the pool outside of the lock, workers may currently wait for it
+    pool = std::move(this->state_->pool);
+  }
+  this->state_->cv.notify_all();
+  this->timer_thread_.reset();
+}
+
+CoroutineExecutor::Ref CoroutineExecutor::ref() const noexcept(true) {
+  return Ref(this->state_);
+}
+
+void CoroutineExecutor::Ref::post(std::coroutine_handle<> handle) const noexcept(false) {
+  std::unique_lock lock(this->state_->mutex);
+  if (this->state_->closed) {
+    return;
+  }
+  this->state_->pool->post([handle, instance = this->state_->instance] {
+    InstanceScope scope(instance);
+    handle.resume();
+  });
+}
+
+void CoroutineExecutor::Ref::postAt(std::chrono::steady_clock::time_point deadline,
+                                    std::function<void()> &&fn) const noexcept(false) {
+  {
+    std::unique_lock lock(this->state_->mutex);
+    if (this->state_->closed) {
+      return;
+    }
+    this->state_->deadlines.emplace(deadline, std::move(fn));
+  }
+  this->state_->cv.notify_one();
+}
+
+void Task::promise_type::unhandled_exception() noexcept(true) {
+  try {
+    std::rethrow_exception(std::current_exception());
+  } catch (const std::exception &e) {
+    vda5050pp::core::getEventsLogger()->error("Coroutine threw an exception: {}", e.what());
+  } catch (...) {
+    vda5050pp::core::getEventsLogger()->error("Coroutine threw an unknown exception");
+  }
+}
+
+void vda5050pp::core::common::throwResultTimedOut() {
+  throw vda5050pp::VDA5050PPSynchronizedEventTimedOut(MK_FN_EX_CONTEXT("Awaited result timed out"));
+}
+
+#endif  // LIBVDA5050PP_COROUTINES
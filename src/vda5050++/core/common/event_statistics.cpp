@@ -0,0 +1,177 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+
+#include "vda5050++/core/common/event_statistics.h"
+
+#include <new>
+
+#include "vda5050++/core/logger.h"
+
+using namespace vda5050pp::core::common;
+
+void AtomicLatencyHistogram::record(std::chrono::nanoseconds value) noexcept(true) {
+  auto ns = value.count() < 0 ? uint64_t(0) : uint64_t(value.count());
+
+  this->counts_[vda5050pp::misc::LatencyHistogram::bucketIndex(ns)].fetch_add(
+      1, std::memory_order_relaxed);
+  this->sum_.fetch_add(ns, std::memory_order_relaxed);
+
+  auto min = this->min_.load(std::memory_order_relaxed);
+  while (ns < min && !this->min_.compare_exchange_weak(min, ns, std::memory_order_relaxed)) {
+  }
+  auto max = this->max_.load(std::memory_order_relaxed);
+  while (ns > max && !this->max_.compare_exchange_weak(max, ns, std::memory_order_relaxed)) {
+  }
+}
+
+vda5050pp::misc::LatencyHistogram AtomicLatencyHistogram::snapshot() const noexcept(false) {
+  std::vector<uint64_t> counts(this->counts_.size());
+  for (std::size_t i = 0; i < counts.size(); i++) {
+    counts[i] = this->counts_[i].load(std::memory_order_relaxed);
+  }
+  return vda5050pp::misc::LatencyHistogram(std::move(counts),
+                                           this->min_.load(std::memory_order_relaxed),
+                                           this->max_.load(std::memory_order_relaxed),
+                                           this->sum_.load(std::memory_order_relaxed));
+}
+
+EventStatisticsRecorder::Slot *EventStatisticsRecorder::slot(std::size_t id) noexcept(true) {
+  if (id >= k_max_event_ids) {
+    return nullptr;
+  }
+
+  auto &slot = this->slots_[id];
+  if (auto *existing = slot.load(std::memory_order_acquire); existing != nullptr) {
+    return existing;
+  }
+
+  auto *created = new (std::nothrow) Slot();
+  if (created == nullptr) {
+    return nullptr;
+  }
+
+  Slot *expected = nullptr;
+  if (!slot.compare_exchange_strong(expected, created, std::memory_order_acq_rel)) {
+    // Another thread was faster
+    delete created;
+    return expected;
+  }
+  return created;
+}
+
+EventStatisticsRecorder::EventStatisticsRecorder(std::string_view manager_name)
+    : manager_name_(manager_name) {}
+
+EventStatisticsRecorder::~EventStatisticsRecorder() noexcept(true) {
+  for (auto &slot : this->slots_) {
+    delete slot.load(std::memory_order_acquire);
+  }
+}
+
+void EventStatisticsRecorder::recordEnqueue(std::size_t id) noexcept(true) {
+  if (auto *slot = this->slot(id); slot != nullptr) {
+    slot->enqueued.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+void EventStatisticsRecorder::recordProcessed(std::size_t id, std::chrono::nanoseconds queue_wait,
+                                              std::chrono::nanoseconds handler_duration) noexcept(
+    true) {
+  if (auto *slot = this->slot(id); slot != nullptr) {
+    slot->processed.fetch_add(1, std::memory_order_relaxed);
+    slot->queue_wait.record(queue_wait);
+    slot->handler_duration.record(handler_duration);
+  }
+}
+
+void EventStatisticsRecorder::recordOverflow(
+    std::size_t id, vda5050pp::config::QueueOverflowPolicy policy) noexcept(true) {
+  auto *slot = this->slot(id);
+  if (slot == nullptr) {
+    return;
+  }
+
+  auto &counter =
+      policy == vda5050pp::config::QueueOverflowPolicy::k_block ? slot->blocked : slot->dropped;
+  auto count = counter.fetch_add(1, std::memory_order_relaxed) + 1;
+
+  try {
+    // Only warn for the 1st, 2nd, 4th, 8th, ... overflow to not flood the log
+    if ((count & (count - 1)) == 0) {
+      getEventsLogger()->warn("{} queue is full, {} events with id={} ({} times)",
+                              this->manager_name_,
+                              policy == vda5050pp::config::QueueOverflowPolicy::k_block
+                                  ? "blocked"
+                                  : "dropped",
+                              id, count);
+    }
+
+    this->overflow_callbacks_(vda5050pp::observer::QueueOverflow{this->manager_name_, int(id),
+                                                                 policy, count});
+  } catch (const std::exception &e) {
+    // Must not break the producer
+    getEventsLogger()->error("{} queue overflow handling threw an exception: {}",
+                             this->manager_name_, e.what());
+  }
+}
+
+void EventStatisticsRecorder::recordOverrun(std::size_t id) noexcept(true) {
+  auto *slot = this->slot(id);
+  if (slot == nullptr) {
+    return;
+  }
+
+  auto count = slot->overrun.fetch_add(1, std::memory_order_relaxed) + 1;
+
+  try {
+    // Only warn for the 1st, 2nd, 4th, 8th, ... overrun to not flood the log
+    if ((count & (count - 1)) == 0) {
+      getEventsLogger()->warn(
+          "{} queue is full, an event worker exceeded its capacity with id={} ({} times)",
+          this->manager_name_, id, count);
+    }
+  } catch (const std::exception &e) {
+    // Must not break the producer
+    getEventsLogger()->error("{} queue overrun handling threw an exception: {}",
+                             this->manager_name_, e.what());
+  }
+}
+
+EventStatisticsRecorder::OverflowCallbackList &EventStatisticsRecorder::overflowCallbacks() const
+    noexcept(true) {
+  return this->overflow_callbacks_;
+}
+
+std::string_view EventStatisticsRecorder::getManagerName() const noexcept(true) {
+  return this->manager_name_;
+}
+
+std::vector<vda5050pp::observer::EventStatistics> EventStatisticsRecorder::snapshot() const
+    noexcept(false) {
+  std::vector<vda5050pp::observer::EventStatistics> ret;
+
+  for (std::size_t id = 0; id < this->slots_.size(); id++) {
+    const auto *slot = this->slots_[id].load(std::memory_order_acquire);
+    if (slot == nullptr) {
+      continue;
+    }
+
+    vda5050pp::observer::EventStatistics stats;
+    stats.manager = this->manager_name_;
+    stats.event_id = int(id);
+    stats.enqueued = slot->enqueued.load(std::memory_order_relaxed);
+    stats.processed = slot->processed.load(std::memory_order_relaxed);
+    stats.dropped = slot->dropped.load(std::memory_order_relaxed);
+    stats.blocked = slot->blocked.load(std::memory_order_relaxed);
+    stats.overrun = slot->overrun.load(std::memory_order_relaxed);
+    stats.queue_wait = slot->queue_wait.snapshot();
+    stats.handler_duration = slot->handler_duration.snapshot();
+    ret.push_back(std::move(stats));
+  }
+
+  return ret;
+}
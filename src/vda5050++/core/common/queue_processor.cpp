@@ -0,0 +1,43 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+
+#include "vda5050++/core/common/queue_processor.h"
+
+using namespace vda5050pp::core::common;
+
+QueueProcessor::QueueProcessor(std::function<void()> &&process_fn,
+                               const vda5050pp::config::EventManagerOptions &opts,
+                               std::shared_ptr<WorkerPool> shared_pool,
+                               Instance *instance) noexcept(false)
+    : process_fn_(std::move(process_fn)), instance_(instance) {
+  if (opts.synchronous_event_dispatch) {
+    // No event processing needed
+    return;
+  }
+
+  if (shared_pool != nullptr) {
+    this->strand_.emplace(shared_pool);
+  } else {
+    this->strand_.emplace(std::make_shared<WorkerPool>(1));
+  }
+}
+
+void QueueProcessor::notify() noexcept(false) {
+  if (!this->strand_.has_value()) {
+    return;
+  }
+
+  if (!this->scheduled_.exchange(true)) {
+    this->strand_->post([this] {
+      // Clear before processing, such that events enqueued during the pass schedule a new one
+      this->scheduled_ = false;
+      // The pool may be shared with other instances
+      InstanceScope scope(this->instance_);
+      this->process_fn_();
+    });
+  }
+}
@@ -0,0 +1,179 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+
+#include "vda5050++/core/common/worker_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+#include "vda5050++/core/common/exception.h"
+#include "vda5050++/core/logger.h"
+
+using namespace vda5050pp::core::common;
+
+void WorkerPool::workerTask(StopToken tkn) noexcept(true) {
+  while (!tkn.stopRequested()) {
+    std::function<void()> task;
+    {
+      std::unique_lock lock(this->mutex_);
+      this->cv_.wait(lock, [this] { return this->stop_ || !this->tasks_.empty(); });
+      if (this->stop_) {
+        return;
+      }
+      task = std::move(this->tasks_.front());
+      this->tasks_.pop_front();
+    }
+
+    try {
+      task();
+    } catch (const std::exception &e) {
+      vda5050pp::core::getEventsLogger()->error("WorkerPool task threw an exception: {}",
+                                                e.what());
+    }
+  }
+}
+
+WorkerPool::WorkerPool(std::size_t size) {
+  for (std::size_t i = 0; i < std::max<std::size_t>(size, 1); i++) {
+    this->workers_.emplace_back(
+        std::bind(std::mem_fn(&WorkerPool::workerTask), this, std::placeholders::_1));
+  }
+}
+
+WorkerPool::~WorkerPool() noexcept(true) {
+  {
+    std::unique_lock lock(this->mutex_);
+    this->stop_ = true;
+    this->tasks_.clear();
+  }
+  this->cv_.notify_all();
+
+  // Stop and join all workers
+  this->workers_.clear();
+}
+
+void WorkerPool::post(std::function<void()> &&task) noexcept(false) {
+  {
+    std::unique_lock lock(this->mutex_);
+    if (this->stop_) {
+      return;
+    }
+    this->tasks_.push_back(std::move(task));
+  }
+  this->cv_.notify_one();
+}
+
+std::size_t WorkerPool::size() const noexcept(true) { return this->workers_.size(); }
+
+void vda5050pp::core::common::parallelFor(WorkerPool &pool, std::size_t count,
+                                          std::size_t helpers,
+                                          const std::function<void(std::size_t)> &fn) {
+  struct State {
+    std::atomic_size_t next = 0;
+    std::size_t count = 0;
+    const std::function<void(std::size_t)> *fn = nullptr;
+    std::mutex mutex;
+    std::condition_variable done_cv;
+    std::size_t done = 0;
+    std::exception_ptr exception;
+  };
+  auto state = std::make_shared<State>();
+  state->count = count;
+  state->fn = &fn;
+
+  // fn is only called for claimed indices, so a helper, which starts after all indices
+  // were claimed, never touches fn (it may be gone already)
+  auto work = [](const std::shared_ptr<State> &s) {
+    for (auto i = s->next++; i < s->count; i = s->next++) {
+      std::exception_ptr exception;
+      try {
+        (*s->fn)(i);
+      } catch (...) {
+        exception = std::current_exception();
+      }
+
+      std::unique_lock lock(s->mutex);
+      if (exception && !s->exception) {
+        s->exception = exception;
+      }
+      if (++s->done == s->count) {
+        s->done_cv.notify_all();
+      }
+    }
+  };
+
+  for (std::size_t i = 0; i < std::min(helpers, count > 0 ? count - 1 : 0); i++) {
+    pool.post([state, work] { work(state); });
+  }
+  work(state);
+
+  std::unique_lock lock(state->mutex);
+  state->done_cv.wait(lock, [&state] { return state->done == state->count; });
+  if (state->exception) {
+    std::rethrow_exception(state->exception);
+  }
+}
+
+void Strand::run(const std::shared_ptr<State> &state) noexcept(true) {
+  std::unique_lock lock(state->mutex);
+
+  while (!state->closed && !state->tasks.empty()) {
+    auto task = std::move(state->tasks.front());
+    state->tasks.pop_front();
+    state->running_on = std::this_thread::get_id();
+    lock.unlock();
+
+    try {
+      task();
+    } catch (const std::exception &e) {
+      vda5050pp::core::getEventsLogger()->error("Strand task threw an exception: {}", e.what());
+    }
+
+    lock.lock();
+    state->running_on = std::thread::id();
+  }
+
+  state->scheduled = false;
+  lock.unlock();
+  state->idle_cv.notify_all();
+}
+
+Strand::Strand(std::shared_ptr<WorkerPool> pool) noexcept(false)
+    : pool_(pool), state_(std::make_shared<State>()) {
+  if (this->pool_ == nullptr) {
+    throw vda5050pp::VDA5050PPNullPointer(MK_EX_CONTEXT("Strand requires a WorkerPool"));
+  }
+}
+
+Strand::~Strand() noexcept(true) {
+  std::unique_lock lock(this->state_->mutex);
+  this->state_->closed = true;
+  this->state_->tasks.clear();
+
+  // A task of this strand may destroy the strand, do not wait for ourselves in that case
+  if (this->state_->running_on != std::this_thread::get_id()) {
+    this->state_->idle_cv.wait(lock, [this] { return !this->state_->scheduled; });
+  }
+}
+
+void Strand::post(std::function<void()> &&task) noexcept(false) {
+  {
+    std::unique_lock lock(this->state_->mutex);
+    if (this->state_->closed) {
+      return;
+    }
+    this->state_->tasks.push_back(std::move(task));
+    if (this->state_->scheduled) {
+      // The running/scheduled pass will pick up the task
+      return;
+    }
+    this->state_->scheduled = true;
+  }
+
+  this->pool_->post([state = this->state_] { Strand::run(state); });
+}
@@ -15,6 +15,7 @@
 #include "vda5050++/config/visualization_timer_subconfig.h"
 #include "vda5050++/core/instance.h"
 #include "vda5050++/core/logger.h"
+#include "vda5050++/misc/pool_allocator.h"
 
 using namespace std::chrono_literals;
 
@@ -44,8 +45,8 @@ vda5050::ProtocolFeatures vda5050pp::core::factsheet::gatherProtocolFeatures() {
 
   // Gather control actions
   auto control_action_list =
-      std::make_shared<vda5050pp::core::events::FactsheetControlActionListEvent>();
-  auto control_action_list_result = control_action_list->getFuture();
+      vda5050pp::misc::makePooled<vda5050pp::core::events::FactsheetControlActionListEvent>();
+  auto control_action_list_result = control_action_list->getSynchronizedFuture();
   Instance::ref().getFactsheetEventManager().synchronousDispatch(control_action_list);
   if (control_action_list_result.wait_for(0s) == std::future_status::timeout) {
     throw vda5050pp::VDA5050PPSynchronizedEventTimedOut(
@@ -54,8 +55,8 @@ vda5050::ProtocolFeatures vda5050pp::core::factsheet::gatherProtocolFeatures() {
   auto actions = control_action_list_result.get();
 
   // Gather user actions
-  auto action_list = std::make_shared<vda5050pp::events::ActionList>();
-  auto action_list_result = action_list->getFuture();
+  auto action_list = vda5050pp::misc::makePooled<vda5050pp::events::ActionList>();
+  auto action_list_result = action_list->getSynchronizedFuture();
   Instance::ref().getActionEventManager().dispatch(action_list);
   if (action_list_result.wait_for(1s) == std::future_status::timeout) {
     throw vda5050pp::VDA5050PPSynchronizedEventTimedOut(
@@ -80,7 +81,15 @@ vda5050::ProtocolLimits vda5050pp::core::factsheet::gatherProtocolLimits() {
 
   const auto &desc = Instance::ref().getConfig().getAgvDescription();
 
-  protocol_limits.maxArrayLens.stateLoads = desc.simple_protocol_limits.max_load_id_len;
+  protocol_limits.maxArrayLens.stateLoads = desc.simple_protocol_limits.max_loads;
+  protocol_limits.maxArrayLens.orderNodes = desc.simple_protocol_limits.max_order_nodes;
+  protocol_limits.maxArrayLens.orderEdges = desc.simple_protocol_limits.max_order_edges;
+  protocol_limits.maxArrayLens.nodeActions = desc.simple_protocol_limits.max_node_actions;
+  protocol_limits.maxArrayLens.edgeActions = desc.simple_protocol_limits.max_edge_actions;
+  protocol_limits.maxArrayLens.instantActions = desc.simple_protocol_limits.max_instant_actions;
+  protocol_limits.maxArrayLens.actionsActionsParameters =
+      desc.simple_protocol_limits.max_action_parameters;
+  protocol_limits.maxStringLens.msgLen = desc.simple_protocol_limits.max_message_len;
   protocol_limits.maxStringLens.idLen = desc.simple_protocol_limits.max_id_len;
   protocol_limits.maxStringLens.idNumericalOnly = desc.simple_protocol_limits.id_numerical_only;
   protocol_limits.maxStringLens.loadIdLen = desc.simple_protocol_limits.max_load_id_len;
@@ -9,6 +9,7 @@
 
 #include <spdlog/sinks/stdout_color_sinks.h>
 
+#include <algorithm>
 #include <future>
 
 #include "vda5050++/core/agv_handler/action_event_handler.h"
@@ -27,6 +28,7 @@
 #include "vda5050++/core/state/state_update_timer.h"
 #include "vda5050++/core/state/visualization_timer.h"
 #include "vda5050++/core/validation/validation_event_handler.h"
+#include "vda5050++/misc/pool_allocator.h"
 
 using namespace vda5050pp::core;
 using namespace std::chrono_literals;
@@ -34,8 +36,8 @@ using namespace std::chrono_literals;
 std::shared_mutex Instance::instance_mutex_;
 std::shared_ptr<Instance> Instance::instance_;
 
-std::shared_mutex Instance::modules_mutex_;
-std::map<std::string, std::shared_ptr<vda5050pp::core::Module>, std::less<>> Instance::modules_;
+std::shared_mutex Instance::module_registrations_mutex_;
+std::map<std::string, Instance::ModuleRegistration, std::less<>> Instance::module_registrations_;
 
 static const vda5050pp::core::AutoRegisterModule<vda5050pp::core::agv_handler::ActionEventHandler,
                                                  module_keys::k_action_event_handler_key>
@@ -110,6 +112,7 @@ constexpr spdlog::level::level_enum convertLogLevel(vda5050pp::config::LogLevel
 }
 
 void Instance::initializeComponents() {
+  InstanceScope scope(this);
   const auto &config = this->getConfig();
 
   auto global_level = config.getGlobalConfig().getLogLevel().value_or(config::LogLevel::k_info);
@@ -141,7 +144,8 @@ void Instance::initializeComponents() {
   }
 
   // Each one relies on Instance member construction
-  for (const auto &[name, module_ptr] : Instance::modules_) {
+  std::shared_lock m_lock(this->modules_mutex_);
+  for (const auto &[name, module_ptr] : this->modules_) {
     if (module_ptr == nullptr) {
       getInstanceLogger()->error("Module {} is nullptr, cannot initialize", name);
     } else if (this->config_.getGlobalConfig().isListedModule(name)) {
@@ -156,9 +160,11 @@ void Instance::initializeComponents() {
 void Instance::deInitializeComponents() {
   // When global dtors are called, this might yield a nullptr
   auto logger = getInstanceLogger(false);
+  InstanceScope scope(this);
 
   // Each one relies on live members
-  for (const auto &[name, module_ptr] : Instance::modules_) {
+  std::shared_lock m_lock(this->modules_mutex_);
+  for (const auto &[name, module_ptr] : this->modules_) {
     if (module_ptr == nullptr) {
       if (logger) {
         logger->error("Module {} is nullptr, cannot de-initialize", name);
@@ -172,33 +178,88 @@ void Instance::deInitializeComponents() {
   }
 }
 
-Instance::Instance(const vda5050pp::Config &config)
+static std::shared_ptr<common::WorkerPool> makeWorkerPool(
+    const vda5050pp::config::EventManagerOptions &opts) {
+  if (opts.synchronous_event_dispatch || opts.worker_pool_size == 0) {
+    return nullptr;
+  }
+  // Blocked workers wait for the results of other managers, fewer workers could deadlock
+  auto size = std::max(opts.worker_pool_size,
+                       vda5050pp::config::EventManagerOptions::k_min_worker_pool_size);
+  if (!opts.share_worker_pool) {
+    return std::make_shared<common::WorkerPool>(size);
+  }
+
+  // The first instance determines the size, the pool lives as long as one instance uses it
+  static std::mutex shared_pool_mutex;
+  static std::weak_ptr<common::WorkerPool> shared_pool;
+  std::unique_lock lock(shared_pool_mutex);
+  auto pool = shared_pool.lock();
+  if (pool == nullptr) {
+    pool = std::make_shared<common::WorkerPool>(size);
+    shared_pool = pool;
+  }
+  return pool;
+}
+
+Instance::Instance(const vda5050pp::Config &config, bool is_default)
     : config_(config),
-      action_event_manager_(config_.getGlobalConfig().getEventManagerOptions()),
-      action_status_manager_(config_.getGlobalConfig().getEventManagerOptions()),
-      navigation_event_manager_(config_.getGlobalConfig().getEventManagerOptions()),
-      navigation_status_manager_(config_.getGlobalConfig().getEventManagerOptions()),
-      status_event_manager_(config_.getGlobalConfig().getEventManagerOptions()),
-      query_event_manager_(config_.getGlobalConfig().getEventManagerOptions()),
-      control_event_manager_(config_.getGlobalConfig().getEventManagerOptions()),
-      factsheet_event_manager_(config_.getGlobalConfig().getEventManagerOptions()),
-      interpreter_event_manager_(config_.getGlobalConfig().getEventManagerOptions()),
-      message_event_manager_(config_.getGlobalConfig().getEventManagerOptions()),
-      order_event_manager_(config_.getGlobalConfig().getEventManagerOptions()),
-      state_event_manager_(config_.getGlobalConfig().getEventManagerOptions()),
-      validation_event_manager_(config_.getGlobalConfig().getEventManagerOptions()) {}
+      worker_pool_(makeWorkerPool(config_.getGlobalConfig().getEventManagerOptions())),
+      action_event_manager_(config_.getGlobalConfig().getEventManagerOptions(), worker_pool_, this),
+      action_status_manager_(config_.getGlobalConfig().getEventManagerOptions(), worker_pool_,
+                             this),
+      navigation_event_manager_(config_.getGlobalConfig().getEventManagerOptions(), worker_pool_,
+                                this),
+      navigation_status_manager_(config_.getGlobalConfig().getEventManagerOptions(), worker_pool_,
+                                 this),
+      status_event_manager_(config_.getGlobalConfig().getEventManagerOptions(), worker_pool_, this),
+      query_event_manager_(config_.getGlobalConfig().getEventManagerOptions(), worker_pool_, this),
+      control_event_manager_(config_.getGlobalConfig().getEventManagerOptions(), worker_pool_,
+                             this),
+      factsheet_event_manager_(config_.getGlobalConfig().getEventManagerOptions(), worker_pool_,
+                               this),
+      interpreter_event_manager_(config_.getGlobalConfig().getEventManagerOptions(), worker_pool_,
+                                 this),
+      message_event_manager_(config_.getGlobalConfig().getEventManagerOptions(), worker_pool_,
+                             this),
+      order_event_manager_(config_.getGlobalConfig().getEventManagerOptions(), worker_pool_, this),
+      state_event_manager_(config_.getGlobalConfig().getEventManagerOptions(), worker_pool_, this),
+      validation_event_manager_(config_.getGlobalConfig().getEventManagerOptions(), worker_pool_,
+                                this) {
+  std::shared_lock r_lock(Instance::module_registrations_mutex_);
+  for (const auto &[key, registration] : Instance::module_registrations_) {
+    // A single module object must not be initialized by several instances
+    if (is_default || !registration.default_instance_only) {
+      this->modules_.try_emplace(key, registration.factory());
+    }
+  }
+}
 
-std::weak_ptr<Instance> Instance::init(const vda5050pp::Config &config) noexcept(true) {
-  class InstanceConstructible final : public Instance {
-  public:
-    explicit InstanceConstructible(const vda5050pp::Config &config) noexcept(true)
-        : Instance(config){};
-    ~InstanceConstructible() override = default;
-  };
+class InstanceConstructible final : public Instance {
+public:
+  InstanceConstructible(const vda5050pp::Config &config, bool is_default) noexcept(true)
+      : Instance(config, is_default){};
+  ~InstanceConstructible() override = default;
+};
 
+std::shared_ptr<Instance> Instance::create(const vda5050pp::Config &config) {
+  std::shared_ptr<Instance> instance(new InstanceConstructible(config, false), [](Instance *ptr) {
+    // Stop the modules, before the members they rely on are destroyed
+    ptr->deinitialize();
+    delete ptr;
+  });
+  instance->initialized_ = true;
+  instance->initializeComponents();
+  return instance;
+}
+
+std::weak_ptr<Instance> Instance::init(const vda5050pp::Config &config) noexcept(true) {
   std::unique_lock i_lock(Instance::instance_mutex_);
 
-  Instance::instance_ = std::make_shared<InstanceConstructible>(config);
+  // The default instance may still be alive during static destruction, so it is only
+  // de-initialized by reset()
+  Instance::instance_ = std::make_shared<InstanceConstructible>(config, true);
+  Instance::instance_->initialized_ = true;
   Instance::instance_->initializeComponents();
   return Instance::instance_;
 }
@@ -206,15 +267,30 @@ std::weak_ptr<Instance> Instance::init(const vda5050pp::Config &config) noexcept
 void Instance::reset() noexcept(true) {
   std::unique_lock i_lock(Instance::instance_mutex_);
   if (Instance::instance_) {
-    Instance::instance_->deInitializeComponents();
+    Instance::instance_->deinitialize();
   }
   Instance::instance_.reset();
 }
 
-std::weak_ptr<Instance> Instance::get() noexcept(true) { return Instance::instance_; }
+void Instance::deinitialize() noexcept(true) {
+  if (this->initialized_.exchange(false)) {
+    this->deInitializeComponents();
+  }
+}
+
+std::weak_ptr<Instance> Instance::get() noexcept(true) {
+  if (auto bound = InstanceScope::current(); bound != nullptr) {
+    return bound->weak_from_this();
+  }
+  return Instance::instance_;
+}
 
 Instance &Instance::ref() noexcept(false) {
-  auto ptr = Instance::get().lock();
+  if (auto bound = InstanceScope::current(); bound != nullptr) {
+    return *bound;
+  }
+
+  auto ptr = Instance::instance_;
 
   if (ptr == nullptr) {
     throw vda5050pp::VDA5050PPNotInitialized(MK_FN_EX_CONTEXT(""));
@@ -223,60 +299,125 @@ Instance &Instance::ref() noexcept(false) {
   return *ptr;
 }
 
+std::weak_ptr<Instance> Instance::threadBinding() noexcept(true) {
+  if (auto bound = InstanceScope::current(); bound != nullptr) {
+    return bound->weak_from_this();
+  }
+  return {};
+}
+
+std::shared_ptr<Instance> Instance::resolve(const std::weak_ptr<Instance> &binding) noexcept(
+    false) {
+  // An empty weak_ptr (no binding) is ordered equivalent to a default constructed one, an
+  // expired one (destroyed instance) is not
+  const std::weak_ptr<Instance> unbound;
+  bool is_unbound = !binding.owner_before(unbound) && !unbound.owner_before(binding);
+
+  auto ptr = is_unbound ? Instance::get().lock() : binding.lock();
+  if (ptr == nullptr) {
+    throw vda5050pp::VDA5050PPNotInitialized(MK_FN_EX_CONTEXT(""));
+  }
+  return ptr;
+}
+
+void Instance::registerModuleFactory(std::string_view key,
+                                     ModuleFactory factory) noexcept(false) {
+  if (!factory) {
+    throw vda5050pp::VDA5050PPNullPointer(
+        MK_FN_EX_CONTEXT("Module factory is not allowed to be empty"));
+  }
+
+  std::unique_lock r_lock(Instance::module_registrations_mutex_);
+  auto prototype = factory();
+  if (const auto &[_, ok] = Instance::module_registrations_.try_emplace(
+          std::string(key), ModuleRegistration{std::move(factory), std::move(prototype)});
+      !ok) {
+    throw vda5050pp::VDA5050PPInvalidArgument(
+        MK_FN_EX_CONTEXT(fmt::format("Module with Key {} already registered.", key)));
+  }
+}
+
 void Instance::registerModule(std::string_view key,
                               std::shared_ptr<vda5050pp::core::Module> module_ptr) noexcept(false) {
   std::shared_lock i_lock(Instance::instance_mutex_);
-  std::unique_lock m_lock(Instance::modules_mutex_);
 
   if (module_ptr == nullptr) {
     throw vda5050pp::VDA5050PPNullPointer(
         MK_FN_EX_CONTEXT("Module pointer is not allowed to be nullptr"));
   }
 
-  // Add module
-  if (const auto &[_, ok] = Instance::modules_.try_emplace(std::string(key), module_ptr); !ok) {
-    throw vda5050pp::VDA5050PPInvalidArgument(
-        MK_FN_EX_CONTEXT(fmt::format("Module with Key {} already registered.", key)));
+  {
+    std::unique_lock r_lock(Instance::module_registrations_mutex_);
+    if (const auto &[_, ok] = Instance::module_registrations_.try_emplace(
+            std::string(key), ModuleRegistration{[module_ptr] { return module_ptr; }, module_ptr,
+                                                 true});
+        !ok) {
+      throw vda5050pp::VDA5050PPInvalidArgument(
+          MK_FN_EX_CONTEXT(fmt::format("Module with Key {} already registered.", key)));
+    }
   }
 
   // Check if initialization is required
-  if (Instance::instance_ != nullptr) {
-    if (Instance::instance_->getConfig().getGlobalConfig().isListedModule(key)) {
-      getInstanceLogger()->info("Initializing {} during runtime", key);
-      module_ptr->initialize(Instance::ref());
-    } else {
-      getInstanceLogger()->info("Module {} is disabled by black/white list", key);
-    }
+  auto instance = Instance::get().lock();
+  if (instance == nullptr) {
+    return;
+  }
+
+  std::unique_lock m_lock(instance->modules_mutex_);
+  instance->modules_.try_emplace(std::string(key), module_ptr);
+  if (instance->getConfig().getGlobalConfig().isListedModule(key)) {
+    getInstanceLogger()->info("Initializing {} during runtime", key);
+    InstanceScope scope(instance.get());
+    module_ptr->initialize(*instance);
+  } else {
+    getInstanceLogger()->info("Module {} is disabled by black/white list", key);
   }
 }
 
 void Instance::unregisterModule(std::string_view key) noexcept(false) {
   std::shared_lock i_lock(Instance::instance_mutex_);
-  std::unique_lock m_lock(Instance::modules_mutex_);
 
   // Remove module
-  auto it = Instance::modules_.find(key);
-  if (it == Instance::modules_.end()) {
-    throw vda5050pp::VDA5050PPInvalidArgument(
-        MK_FN_EX_CONTEXT(fmt::format("Module with Key {} is not registered.", key)));
+  {
+    std::unique_lock r_lock(Instance::module_registrations_mutex_);
+    auto it = Instance::module_registrations_.find(key);
+    if (it == Instance::module_registrations_.end()) {
+      throw vda5050pp::VDA5050PPInvalidArgument(
+          MK_FN_EX_CONTEXT(fmt::format("Module with Key {} is not registered.", key)));
+    }
+    Instance::module_registrations_.erase(it);
   }
-  auto m = it->second;
-  Instance::modules_.erase(it);
 
   // Check if deinitialization is required
-  if (Instance::instance_ != nullptr && m != nullptr) {
-    m->deinitialize(Instance::ref());
+  auto instance = Instance::get().lock();
+  if (instance == nullptr) {
+    return;
+  }
+
+  std::unique_lock m_lock(instance->modules_mutex_);
+  if (auto it = instance->modules_.find(key); it != instance->modules_.end()) {
+    auto m = it->second;
+    instance->modules_.erase(it);
+    if (m != nullptr) {
+      InstanceScope scope(instance.get());
+      m->deinitialize(*instance);
+    }
   }
 }
 
 std::weak_ptr<vda5050pp::core::Module> Instance::lookupModule(std::string_view key) noexcept(
     false) {
-  std::shared_lock m_lock(Instance::modules_mutex_);
+  return Instance::ref().getModule(key);
+}
+
+std::weak_ptr<vda5050pp::core::Module> Instance::getModule(std::string_view key) const
+    noexcept(false) {
+  std::shared_lock m_lock(this->modules_mutex_);
 
-  auto it = Instance::modules_.find(key);
-  if (it == Instance::modules_.end()) {
+  auto it = this->modules_.find(key);
+  if (it == this->modules_.end()) {
     throw vda5050pp::VDA5050PPInvalidArgument(
-        MK_FN_EX_CONTEXT(fmt::format("Module with Key {} is not registered.", key)));
+        MK_EX_CONTEXT(fmt::format("Module with Key {} is not registered.", key)));
   }
 
   return it->second;
@@ -284,15 +425,23 @@ std::weak_ptr<vda5050pp::core::Module> Instance::lookupModule(std::string_view k
 
 std::shared_ptr<vda5050pp::config::ModuleSubConfig> Instance::generateConfig(
     std::string_view key) noexcept(false) {
-  return Instance::lookupModule(key).lock()->generateSubConfig();
+  std::shared_lock r_lock(Instance::module_registrations_mutex_);
+
+  auto it = Instance::module_registrations_.find(key);
+  if (it == Instance::module_registrations_.end()) {
+    throw vda5050pp::VDA5050PPInvalidArgument(
+        MK_FN_EX_CONTEXT(fmt::format("Module with Key {} is not registered.", key)));
+  }
+
+  return it->second.prototype->generateSubConfig();
 }
 
 std::list<std::string_view> Instance::registeredModules() {
-  std::shared_lock m_lock(Instance::modules_mutex_);
+  std::shared_lock r_lock(Instance::module_registrations_mutex_);
 
   std::list<std::string_view> ret;
 
-  for (const auto &[key, _] : Instance::modules_) {
+  for (const auto &[key, _] : Instance::module_registrations_) {
     ret.push_back(key);
   }
 
@@ -301,21 +450,21 @@ std::list<std::string_view> Instance::registeredModules() {
 
 void Instance::start() {
   // Go online
-  auto evt = std::make_shared<vda5050pp::core::events::ControlMessagesEvent>();
+  auto evt = vda5050pp::misc::makePooled<vda5050pp::core::events::ControlMessagesEvent>();
   evt->type = vda5050pp::core::events::ControlMessagesEvent::Type::k_connect;
   this->getControlEventManager().dispatch(evt);
 
   // Send state
-  auto evt_state = std::make_shared<vda5050pp::core::events::RequestStateUpdateEvent>();
+  auto evt_state = vda5050pp::misc::makePooled<vda5050pp::core::events::RequestStateUpdateEvent>();
   evt_state->urgency = state::StateUpdateUrgency::immediate();
   this->getStateEventManager().dispatch(evt_state);
 }
 
 void Instance::stop() {
   // Go offline
-  auto evt = std::make_shared<vda5050pp::core::events::ControlMessagesEvent>();
+  auto evt = vda5050pp::misc::makePooled<vda5050pp::core::events::ControlMessagesEvent>();
   evt->type = vda5050pp::core::events::ControlMessagesEvent::Type::k_disconnect;
-  auto future = evt->getFuture();
+  auto future = evt->getSynchronizedFuture();
   this->getControlEventManager().dispatch(evt);
 
   if (auto fs = future.wait_for(1s); fs == std::future_status::timeout) {
@@ -374,6 +523,18 @@ GenericEventManager<vda5050pp::core::events::ValidationEvent>
   return this->validation_event_manager_;
 }
 
+#ifdef LIBVDA5050PP_COROUTINES
+vda5050pp::core::common::CoroutineExecutor::Ref Instance::getCoroutineExecutor() const
+    noexcept(true) {
+  return this->coroutine_executor_.ref();
+}
+#endif
+
+std::shared_ptr<vda5050pp::core::common::WorkerPool> Instance::getWorkerPool() const
+    noexcept(true) {
+  return this->worker_pool_;
+}
+
 GenericEventManager<vda5050pp::core::events::InterpreterEvent>
     &Instance::getInterpreterEventManager() noexcept(true) {
   return this->interpreter_event_manager_;
@@ -385,9 +546,28 @@ GenericEventManager<vda5050pp::core::events::StateEvent> &Instance::getStateEven
 }
 
 void Instance::addActionHandler(
-    std::shared_ptr<vda5050pp::handler::BaseActionHandler> action_handler) noexcept(true) {
-  if (action_handler != nullptr) {
-    this->action_handler_.insert(action_handler);
+    std::shared_ptr<vda5050pp::handler::BaseActionHandler> action_handler) {
+  if (action_handler == nullptr || this->action_handler_.count(action_handler) > 0) {
+    return;
+  }
+
+  // Read before registering anything, it may throw
+  auto action_types = action_handler->getHandledActionTypes();
+
+  this->action_handler_.insert(action_handler);
+  if (!action_types.has_value()) {
+    this->dynamic_action_handler_.push_back(action_handler);
+    return;
+  }
+
+  for (auto &action_type : *action_types) {
+    auto [it, inserted] =
+        this->indexed_action_handler_.try_emplace(std::move(action_type), action_handler);
+    if (!inserted && it->second != action_handler) {
+      getInstanceLogger()->warn(
+          "An ActionHandler for action type \"{}\" is registered already, keeping the first one",
+          it->first);
+    }
   }
 }
 
@@ -396,8 +576,25 @@ const std::set<std::shared_ptr<vda5050pp::handler::BaseActionHandler>> &Instance
   return this->action_handler_;
 }
 
+std::shared_ptr<vda5050pp::handler::BaseActionHandler> Instance::getIndexedActionHandler(
+    const std::string &action_type) const noexcept(true) {
+  if (auto it = this->indexed_action_handler_.find(action_type);
+      it != this->indexed_action_handler_.end()) {
+    return it->second;
+  }
+  return nullptr;
+}
+
+const std::vector<std::shared_ptr<vda5050pp::handler::BaseActionHandler>> &
+Instance::getDynamicActionHandler() const noexcept(true) {
+  return this->dynamic_action_handler_;
+}
+
 void Instance::setNavigationHandler(
     std::shared_ptr<vda5050pp::handler::BaseNavigationHandler> navigation_handler) noexcept(true) {
+  if (navigation_handler != nullptr) {
+    navigation_handler->instance_ = this->weak_from_this();
+  }
   this->navigation_handler_ = navigation_handler;
 }
 
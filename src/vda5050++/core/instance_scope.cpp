@@ -0,0 +1,28 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+
+#include "vda5050++/core/instance_scope.h"
+
+using namespace vda5050pp::core;
+
+static thread_local Instance *t_bound_instance = nullptr;
+
+InstanceScope::InstanceScope(Instance *instance) noexcept(true) {
+  if (instance != nullptr) {
+    this->previous_ = t_bound_instance;
+    this->bound_ = true;
+    t_bound_instance = instance;
+  }
+}
+
+InstanceScope::~InstanceScope() noexcept(true) {
+  if (this->bound_) {
+    t_bound_instance = this->previous_;
+  }
+}
+
+Instance *InstanceScope::current() noexcept(true) { return t_bound_instance; }
@@ -15,6 +15,7 @@
 #include "vda5050++/core/common/exception.h"
 #include "vda5050++/core/events/factsheet_event.h"
 #include "vda5050++/core/instance.h"
+#include "vda5050++/misc/pool_allocator.h"
 
 using namespace std::chrono_literals;
 
@@ -108,11 +109,12 @@ std::shared_ptr<vda5050pp::core::events::EventControlBlock>
 vda5050pp::core::interpreter::makeCancelControlBlock(
     std::shared_ptr<const vda5050::Action> action) {
   auto done_fin = [action]() {
-    auto clear_evt = std::make_shared<vda5050pp::core::events::OrderClearAfterCancel>();
+    auto clear_evt = vda5050pp::misc::makePooled<vda5050pp::core::events::OrderClearAfterCancel>();
     clear_evt->cancel_action = action;
     vda5050pp::core::Instance::ref().getOrderEventManager().synchronousDispatch(clear_evt);
 
-    auto finished_evt = std::make_shared<vda5050pp::core::events::OrderActionStatusChanged>();
+    auto finished_evt =
+        vda5050pp::misc::makePooled<vda5050pp::core::events::OrderActionStatusChanged>();
     finished_evt->action_id = action->actionId;
     finished_evt->action_status = vda5050::ActionStatus::FINISHED;
     vda5050pp::core::Instance::ref().getOrderEventManager().synchronousDispatch(finished_evt);
@@ -120,14 +122,15 @@ vda5050pp::core::interpreter::makeCancelControlBlock(
 
   using Status = vda5050pp::misc::OrderStatus;
 
-  auto fn_cancel = std::make_shared<vda5050pp::core::events::FunctionBlock>();
+  auto fn_cancel = vda5050pp::misc::makePooled<vda5050pp::core::events::FunctionBlock>();
   fn_cancel->setFunction([action] {
-    auto cancel = std::make_shared<vda5050pp::core::events::InterpreterOrderControl>();
+    auto cancel = vda5050pp::misc::makePooled<vda5050pp::core::events::InterpreterOrderControl>();
     cancel->status = vda5050pp::core::events::InterpreterOrderControl::Status::k_cancel;
     cancel->associated_action = action;
-    Instance::ref().getInterpreterEventManager().dispatch(cancel);
+    Instance::ref().getInterpreterEventManager().dispatch(cancel, EventPriority::k_control);
 
-    auto running_evt = std::make_shared<vda5050pp::core::events::OrderActionStatusChanged>();
+    auto running_evt =
+        vda5050pp::misc::makePooled<vda5050pp::core::events::OrderActionStatusChanged>();
     running_evt->action_id = action->actionId;
     running_evt->action_status = vda5050::ActionStatus::RUNNING;
     vda5050pp::core::Instance::ref().getOrderEventManager().synchronousDispatch(running_evt);
@@ -138,7 +141,7 @@ vda5050pp::core::interpreter::makeCancelControlBlock(
       Instance::ref().getOrderEventManager().getScopedSubscriber(),
       isOrderStatus<Status::k_order_idle>, std::move(done_fin));
 
-  auto chain = std::make_shared<vda5050pp::core::events::EventControlChain>();
+  auto chain = vda5050pp::misc::makePooled<vda5050pp::core::events::EventControlChain>();
   chain->add(fn_cancel);
   chain->add(latch_fin);
 
@@ -148,14 +151,16 @@ vda5050pp::core::interpreter::makeCancelControlBlock(
 std::shared_ptr<vda5050pp::core::events::EventControlBlock>
 vda5050pp::core::interpreter::makePauseControlBlock(std::shared_ptr<const vda5050::Action> action) {
   auto done_run = [action]() {
-    auto running_evt = std::make_shared<vda5050pp::core::events::OrderActionStatusChanged>();
+    auto running_evt =
+        vda5050pp::misc::makePooled<vda5050pp::core::events::OrderActionStatusChanged>();
     running_evt->action_id = action->actionId;
     running_evt->action_status = vda5050::ActionStatus::RUNNING;
     vda5050pp::core::Instance::ref().getOrderEventManager().synchronousDispatch(running_evt);
   };
 
   auto done_fin = [action]() {
-    auto finished_evt = std::make_shared<vda5050pp::core::events::OrderActionStatusChanged>();
+    auto finished_evt =
+        vda5050pp::misc::makePooled<vda5050pp::core::events::OrderActionStatusChanged>();
     finished_evt->action_id = action->actionId;
     finished_evt->action_status = vda5050::ActionStatus::FINISHED;
     vda5050pp::core::Instance::ref().getOrderEventManager().synchronousDispatch(finished_evt);
@@ -163,12 +168,12 @@ vda5050pp::core::interpreter::makePauseControlBlock(std::shared_ptr<const vda505
 
   using Status = vda5050pp::misc::OrderStatus;
 
-  auto fn_pause = std::make_shared<vda5050pp::core::events::FunctionBlock>();
+  auto fn_pause = vda5050pp::misc::makePooled<vda5050pp::core::events::FunctionBlock>();
   fn_pause->setFunction([action] {
-    auto pause = std::make_shared<vda5050pp::core::events::InterpreterOrderControl>();
+    auto pause = vda5050pp::misc::makePooled<vda5050pp::core::events::InterpreterOrderControl>();
     pause->status = vda5050pp::core::events::InterpreterOrderControl::Status::k_pause;
     pause->associated_action = action;
-    Instance::ref().getInterpreterEventManager().dispatch(pause);
+    Instance::ref().getInterpreterEventManager().dispatch(pause, EventPriority::k_control);
   });
 
   auto latch_run = std::make_shared<
@@ -186,15 +191,16 @@ vda5050pp::core::interpreter::makePauseControlBlock(std::shared_ptr<const vda505
       Instance::ref().getOrderEventManager().getScopedSubscriber(),
       isOrderStatus<Status::k_order_idle_paused>, done_fin);
 
-  auto chain_pause = std::make_shared<vda5050pp::core::events::EventControlChain>();
+  auto chain_pause = vda5050pp::misc::makePooled<vda5050pp::core::events::EventControlChain>();
   chain_pause->add(latch_run);
   chain_pause->add(latch_fin);
 
-  auto pause_alternative = std::make_shared<vda5050pp::core::events::EventControlAlternative>();
+  auto pause_alternative =
+      vda5050pp::misc::makePooled<vda5050pp::core::events::EventControlAlternative>();
   pause_alternative->add(latch_idle_fin);  // Finish idle pause
   pause_alternative->add(chain_pause);     // Finish active pause
 
-  auto chain = std::make_shared<vda5050pp::core::events::EventControlChain>();
+  auto chain = vda5050pp::misc::makePooled<vda5050pp::core::events::EventControlChain>();
   chain->add(fn_pause);
   chain->add(pause_alternative);
 
@@ -205,14 +211,16 @@ std::shared_ptr<vda5050pp::core::events::EventControlBlock>
 vda5050pp::core::interpreter::makeResumeControlBlock(
     std::shared_ptr<const vda5050::Action> action) {
   auto done_run = [action]() {
-    auto running_evt = std::make_shared<vda5050pp::core::events::OrderActionStatusChanged>();
+    auto running_evt =
+        vda5050pp::misc::makePooled<vda5050pp::core::events::OrderActionStatusChanged>();
     running_evt->action_id = action->actionId;
     running_evt->action_status = vda5050::ActionStatus::RUNNING;
     vda5050pp::core::Instance::ref().getOrderEventManager().synchronousDispatch(running_evt);
   };
 
   auto done_fin = [action]() {
-    auto finished_evt = std::make_shared<vda5050pp::core::events::OrderActionStatusChanged>();
+    auto finished_evt =
+        vda5050pp::misc::makePooled<vda5050pp::core::events::OrderActionStatusChanged>();
     finished_evt->action_id = action->actionId;
     finished_evt->action_status = vda5050::ActionStatus::FINISHED;
     vda5050pp::core::Instance::ref().getOrderEventManager().synchronousDispatch(finished_evt);
@@ -220,12 +228,12 @@ vda5050pp::core::interpreter::makeResumeControlBlock(
 
   using Status = vda5050pp::misc::OrderStatus;
 
-  auto fn_resume = std::make_shared<vda5050pp::core::events::FunctionBlock>();
+  auto fn_resume = vda5050pp::misc::makePooled<vda5050pp::core::events::FunctionBlock>();
   fn_resume->setFunction([action] {
-    auto resume = std::make_shared<vda5050pp::core::events::InterpreterOrderControl>();
+    auto resume = vda5050pp::misc::makePooled<vda5050pp::core::events::InterpreterOrderControl>();
     resume->status = vda5050pp::core::events::InterpreterOrderControl::Status::k_resume;
     resume->associated_action = action;
-    Instance::ref().getInterpreterEventManager().dispatch(resume);
+    Instance::ref().getInterpreterEventManager().dispatch(resume, EventPriority::k_control);
   });
 
   auto latch_run = std::make_shared<
@@ -243,15 +251,16 @@ vda5050pp::core::interpreter::makeResumeControlBlock(
       Instance::ref().getOrderEventManager().getScopedSubscriber(),
       isOrderStatus<Status::k_order_idle>, done_fin);
 
-  auto resume_chain = std::make_shared<vda5050pp::core::events::EventControlChain>();
+  auto resume_chain = vda5050pp::misc::makePooled<vda5050pp::core::events::EventControlChain>();
   resume_chain->add(latch_run);
   resume_chain->add(latch_fin);
 
-  auto resume_alternative = std::make_shared<vda5050pp::core::events::EventControlAlternative>();
+  auto resume_alternative =
+      vda5050pp::misc::makePooled<vda5050pp::core::events::EventControlAlternative>();
   resume_alternative->add(latch_idle_fin);
   resume_alternative->add(resume_chain);
 
-  auto chain = std::make_shared<vda5050pp::core::events::EventControlChain>();
+  auto chain = vda5050pp::misc::makePooled<vda5050pp::core::events::EventControlChain>();
   chain->add(fn_resume);
   chain->add(resume_alternative);
 
@@ -261,29 +270,30 @@ vda5050pp::core::interpreter::makeResumeControlBlock(
 std::shared_ptr<vda5050pp::core::events::EventControlBlock>
 vda5050pp::core::interpreter::makeFactsheetRequestControlBlock(
     std::shared_ptr<const vda5050::Action> action) {
-  auto send_fs = std::make_shared<vda5050pp::core::events::FunctionBlock>();
+  auto send_fs = vda5050pp::misc::makePooled<vda5050pp::core::events::FunctionBlock>();
   send_fs->setFunction([] {
-    auto g_evt = std::make_shared<vda5050pp::core::events::FactsheetGatherEvent>();
-    auto result = g_evt->getFuture();
+    auto g_evt = vda5050pp::misc::makePooled<vda5050pp::core::events::FactsheetGatherEvent>();
+    auto result = g_evt->getSynchronizedFuture();
     Instance::ref().getFactsheetEventManager().synchronousDispatch(g_evt);
     if (result.wait_for(1us) == std::future_status::timeout) {
       throw vda5050pp::VDA5050PPSynchronizedEventTimedOut(
           MK_FN_EX_CONTEXT("Unhandled FactsheetGatherEvent"));
     }
-    auto fs_evt = std::make_shared<vda5050pp::core::events::SendFactsheetMessageEvent>();
+    auto fs_evt = vda5050pp::misc::makePooled<vda5050pp::core::events::SendFactsheetMessageEvent>();
     fs_evt->factsheet = std::make_shared<vda5050::AgvFactsheet>(result.get());
     Instance::ref().getMessageEventManager().dispatch(fs_evt);
   });
 
-  auto set_finished = std::make_shared<vda5050pp::core::events::FunctionBlock>();
+  auto set_finished = vda5050pp::misc::makePooled<vda5050pp::core::events::FunctionBlock>();
   set_finished->setFunction([action]() {
-    auto finished_evt = std::make_shared<vda5050pp::core::events::OrderActionStatusChanged>();
+    auto finished_evt =
+        vda5050pp::misc::makePooled<vda5050pp::core::events::OrderActionStatusChanged>();
     finished_evt->action_id = action->actionId;
     finished_evt->action_status = vda5050::ActionStatus::FINISHED;
     vda5050pp::core::Instance::ref().getOrderEventManager().synchronousDispatch(finished_evt);
   });
 
-  auto chain = std::make_shared<vda5050pp::core::events::EventControlChain>();
+  auto chain = vda5050pp::misc::makePooled<vda5050pp::core::events::EventControlChain>();
   chain->add(send_fs);
   chain->add(set_finished);
 
@@ -294,9 +304,10 @@ std::shared_ptr<vda5050pp::core::events::EventControlBlock>
 vda5050pp::core::interpreter::makeStateRequestControlBlock(
     std::shared_ptr<const vda5050::Action> action) {
   // Just set the action to finished, since the state will be sent anyway
-  auto set_finished = std::make_shared<vda5050pp::core::events::FunctionBlock>();
+  auto set_finished = vda5050pp::misc::makePooled<vda5050pp::core::events::FunctionBlock>();
   set_finished->setFunction([action]() {
-    auto finished_evt = std::make_shared<vda5050pp::core::events::OrderActionStatusChanged>();
+    auto finished_evt =
+        vda5050pp::misc::makePooled<vda5050pp::core::events::OrderActionStatusChanged>();
     finished_evt->action_id = action->actionId;
     finished_evt->action_status = vda5050::ActionStatus::FINISHED;
     vda5050pp::core::Instance::ref().getOrderEventManager().synchronousDispatch(finished_evt);
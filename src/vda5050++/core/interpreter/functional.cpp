@@ -10,6 +10,7 @@
 
 #include "vda5050++/core/common/exception.h"
 #include "vda5050++/core/logger.h"
+#include "vda5050++/misc/pool_allocator.h"
 
 using namespace vda5050pp::core::interpreter;
 
@@ -175,7 +176,8 @@ handleEdgeAction(std::unique_ptr<EventIter> &&event_iter) noexcept(false) {
       // Add to current action group
       it->ceilCurrentActionGroupBlockingType(a_it->blockingType);
       auto current_action = std::make_shared<vda5050::Action>(*a_it);
-      auto new_action_event = std::make_shared<vda5050pp::core::events::YieldNewAction>();
+      auto new_action_event =
+          vda5050pp::misc::makePooled<vda5050pp::core::events::YieldNewAction>();
       it->getCurrentActionGroup().push_back(current_action);
       a_it++;
       new_action_event->action = current_action;
@@ -195,7 +197,7 @@ handleEdgeActionQueue(std::unique_ptr<EventIter> &&event_iter) noexcept(false) {
   if (!it->getCurrentActionGroup().empty()) {
     // Yield the action group
     auto yield_action_group_event =
-        std::make_shared<vda5050pp::core::events::YieldActionGroupEvent>();
+        vda5050pp::misc::makePooled<vda5050pp::core::events::YieldActionGroupEvent>();
     yield_action_group_event->actions = std::move(it->getCurrentActionGroup());
     yield_action_group_event->blocking_type_ceiling = it->getCurrentActionGroupBlockingType();
     it->getActionEventsAfterNavigation().push(std::move(yield_action_group_event));
@@ -273,7 +275,8 @@ handleNodeAction(std::unique_ptr<EventIter> &&event_iter) noexcept(false) {
       // Add to current action group
       it->ceilCurrentActionGroupBlockingType(a_it->blockingType);
       auto current_action = std::make_shared<vda5050::Action>(*a_it);
-      auto new_action_event = std::make_shared<vda5050pp::core::events::YieldNewAction>();
+      auto new_action_event =
+          vda5050pp::misc::makePooled<vda5050pp::core::events::YieldNewAction>();
       it->getCurrentActionGroup().push_back(current_action);
       a_it++;
       new_action_event->action = current_action;
@@ -302,7 +305,7 @@ handleNodeActionQueue(std::unique_ptr<EventIter> &&event_iter) noexcept(false) {
   if (!it->getCurrentActionGroup().empty()) {
     // queue the action group
     auto yield_action_group_event =
-        std::make_shared<vda5050pp::core::events::YieldActionGroupEvent>();
+        vda5050pp::misc::makePooled<vda5050pp::core::events::YieldActionGroupEvent>();
     yield_action_group_event->actions = std::move(it->getCurrentActionGroup());
     yield_action_group_event->blocking_type_ceiling = it->getCurrentActionGroupBlockingType();
     it->getActionEventsAfterNavigation().push(std::move(yield_action_group_event));
@@ -362,7 +365,8 @@ handleInitial(std::unique_ptr<EventIter> &&event_iter) noexcept(false) {
 
   if (it->getOrderUpdateId() == 0) {
     // Clear actions
-    return {std::make_shared<vda5050pp::core::events::YieldClearActions>(), std::move(it)};
+    return {vda5050pp::misc::makePooled<vda5050pp::core::events::YieldClearActions>(),
+            std::move(it)};
   } else {
     // Do not clear actions
     return nextEvent(std::move(it));
@@ -452,7 +456,8 @@ handleNavigation(std::unique_ptr<EventIter> &&event_iter) noexcept(false) {
     throw vda5050pp::VDA5050PPInvalidArgument(MK_FN_EX_CONTEXT("No GoalNode, but ViaEdge"));
   } else {
     // Setup event
-    auto yield_nav_step = std::make_shared<vda5050pp::core::events::YieldNavigationStepEvent>();
+    auto yield_nav_step =
+        vda5050pp::misc::makePooled<vda5050pp::core::events::YieldNavigationStepEvent>();
     yield_nav_step->goal_node = it->getCurrentGoalNode();
     yield_nav_step->via_edge = it->getCurrentViaEdge();
     yield_nav_step->has_stop_at_goal_hint = it->getStopAtGoal();
@@ -479,7 +484,8 @@ handlePreDone(std::unique_ptr<EventIter> &&event_iter) noexcept(false) {
 
   if (it->getCurrentGoalNode() != nullptr && it->getCurrentViaEdge() != nullptr) {
     // Yield the remaining navigation step
-    auto nav_yield_event = std::make_shared<vda5050pp::core::events::YieldNavigationStepEvent>();
+    auto nav_yield_event =
+        vda5050pp::misc::makePooled<vda5050pp::core::events::YieldNavigationStepEvent>();
     nav_yield_event->goal_node = it->getCurrentGoalNode();
     nav_yield_event->via_edge = it->getCurrentViaEdge();
     nav_yield_event->has_stop_at_goal_hint = it->getStopAtGoal();
@@ -494,7 +500,8 @@ handlePreDone(std::unique_ptr<EventIter> &&event_iter) noexcept(false) {
     it->getActionEventsAfterNavigation().pop();
   } else if (it->getOrderUpdateId() > 0) {
     // Yield extension event
-    auto graph_extension_event = std::make_shared<vda5050pp::core::events::YieldGraphExtension>();
+    auto graph_extension_event =
+        vda5050pp::misc::makePooled<vda5050pp::core::events::YieldGraphExtension>();
     graph_extension_event->graph = it->getCollectedGraph();
     graph_extension_event->order_update_id = it->getOrderUpdateId();
 
@@ -503,7 +510,7 @@ handlePreDone(std::unique_ptr<EventIter> &&event_iter) noexcept(false) {
   } else {
     // Yield replacement event
     auto graph_replacement_event =
-        std::make_shared<vda5050pp::core::events::YieldGraphReplacement>();
+        vda5050pp::misc::makePooled<vda5050pp::core::events::YieldGraphReplacement>();
     graph_replacement_event->graph = it->getCollectedGraph();
     graph_replacement_event->order_id = it->getOrderId();
 
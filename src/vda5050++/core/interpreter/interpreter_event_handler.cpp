@@ -12,6 +12,7 @@
 #include "vda5050++/core/interpreter/control_instant_actions.h"
 #include "vda5050++/core/interpreter/functional.h"
 #include "vda5050++/core/logger.h"
+#include "vda5050++/misc/pool_allocator.h"
 
 using namespace vda5050pp::core::interpreter;
 
@@ -21,13 +22,14 @@ void InterpreterEventHandler::handleValidInstantActions(
     throw vda5050pp::VDA5050PPInvalidEventData(MK_EX_CONTEXT("ValidInstantActionMessageEvent"));
   }
 
-  auto instant_action_evt = std::make_shared<vda5050pp::core::events::YieldInstantActionGroup>();
+  auto instant_action_evt =
+      vda5050pp::misc::makePooled<vda5050pp::core::events::YieldInstantActionGroup>();
 
   // Publish each actions as NewAction and then as InstantAction
   for (const auto &action : data->valid_instant_actions->actions) {
     getInterpreterLogger()->debug("Propagating new action(id={})", action.actionId);
 
-    auto new_action_evt = std::make_shared<vda5050pp::core::events::YieldNewAction>();
+    auto new_action_evt = vda5050pp::misc::makePooled<vda5050pp::core::events::YieldNewAction>();
     new_action_evt->action = std::make_shared<vda5050::Action>(action);
     vda5050pp::core::Instance::ref().getInterpreterEventManager().synchronousDispatch(
         new_action_evt);
@@ -82,11 +84,11 @@ void InterpreterEventHandler::handleValidOrder(
 
   // Done interpreting
   Instance::ref().getInterpreterEventManager().dispatch(
-      std::make_shared<vda5050pp::core::events::InterpreterDone>());
+      vda5050pp::misc::makePooled<vda5050pp::core::events::InterpreterDone>());
   getInterpreterLogger()->debug("Done Interpreting");
 
   // Request state update after order update
-  auto update = std::make_shared<vda5050pp::core::events::RequestStateUpdateEvent>();
+  auto update = vda5050pp::misc::makePooled<vda5050pp::core::events::RequestStateUpdateEvent>();
   update->urgency = state::StateUpdateUrgency::high();
   Instance::ref().getStateEventManager().dispatch(update);
 }
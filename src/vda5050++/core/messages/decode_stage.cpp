@@ -0,0 +1,88 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+
+#include "vda5050++/core/messages/decode_stage.h"
+
+#include <spdlog/fmt/fmt.h>
+
+#include "vda5050++/core/common/exception.h"
+#include "vda5050++/core/logger.h"
+
+using namespace vda5050pp::core::messages;
+
+DecodeStage::DecodeStage(std::size_t workers, std::size_t lanes) {
+  for (std::size_t i = 0; i < lanes; i++) {
+    this->lanes_.push_back(std::make_shared<Lane>());
+  }
+  if (workers > 0) {
+    this->pool_ = std::make_unique<vda5050pp::core::common::WorkerPool>(workers);
+  }
+}
+
+DecodeStage::~DecodeStage() noexcept(true) {
+  // Join the workers before the lanes are released
+  this->pool_.reset();
+}
+
+void DecodeStage::complete(Lane &lane, uint64_t ticket, Delivery &&delivery) noexcept(true) {
+  std::unique_lock lock(lane.mutex);
+  lane.done.emplace(ticket, std::move(delivery));
+
+  // Another thread is already delivering this lane and will pick up this result, too
+  if (lane.delivering) {
+    return;
+  }
+  lane.delivering = true;
+
+  while (!lane.done.empty() && lane.done.begin()->first == lane.next_delivery) {
+    auto next = std::move(lane.done.begin()->second);
+    lane.done.erase(lane.done.begin());
+    lane.next_delivery++;
+
+    if (next) {
+      lock.unlock();
+      try {
+        next();
+      } catch (const std::exception &e) {
+        getMqttLogger()->error("DecodeStage delivery threw an exception: {}", e.what());
+      }
+      lock.lock();
+    }
+  }
+
+  lane.delivering = false;
+}
+
+void DecodeStage::post(std::size_t lane_idx, Task &&task) {
+  if (lane_idx >= this->lanes_.size()) {
+    throw vda5050pp::VDA5050PPInvalidArgument(
+        MK_EX_CONTEXT(fmt::format("Lane {} does not exist", lane_idx)));
+  }
+
+  auto lane = this->lanes_[lane_idx];
+  uint64_t ticket;
+  {
+    std::unique_lock lock(lane->mutex);
+    ticket = lane->next_ticket++;
+  }
+
+  auto run = [lane, ticket, task = std::move(task)] {
+    Delivery delivery;
+    try {
+      delivery = task();
+    } catch (const std::exception &e) {
+      getMqttLogger()->error("DecodeStage task threw an exception: {}", e.what());
+    }
+    DecodeStage::complete(*lane, ticket, std::move(delivery));
+  };
+
+  if (this->pool_ == nullptr) {
+    run();
+  } else {
+    this->pool_->post(std::move(run));
+  }
+}
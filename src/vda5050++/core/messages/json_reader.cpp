@@ -0,0 +1,410 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+
+#include "vda5050++/core/messages/json_reader.h"
+
+#include <spdlog/fmt/fmt.h>
+
+#include "vda5050++/core/common/exception.h"
+
+using namespace vda5050pp::core::messages;
+
+static bool isDigit(char c) { return c >= '0' && c <= '9'; }
+
+static void appendUtf8(std::string &out, uint32_t codepoint) {
+  if (codepoint < 0x80) {
+    out.push_back(char(codepoint));
+  } else if (codepoint < 0x800) {
+    out.push_back(char(0xC0 | (codepoint >> 6)));
+    out.push_back(char(0x80 | (codepoint & 0x3F)));
+  } else if (codepoint < 0x10000) {
+    out.push_back(char(0xE0 | (codepoint >> 12)));
+    out.push_back(char(0x80 | ((codepoint >> 6) & 0x3F)));
+    out.push_back(char(0x80 | (codepoint & 0x3F)));
+  } else {
+    out.push_back(char(0xF0 | (codepoint >> 18)));
+    out.push_back(char(0x80 | ((codepoint >> 12) & 0x3F)));
+    out.push_back(char(0x80 | ((codepoint >> 6) & 0x3F)));
+    out.push_back(char(0x80 | (codepoint & 0x3F)));
+  }
+}
+
+JsonReader::JsonReader(std::string_view input) noexcept(true) : input_(input) {}
+
+void JsonReader::fail(std::string_view description) const noexcept(false) {
+  throw vda5050pp::VDA5050PPJsonError(
+      MK_EX_CONTEXT(fmt::format("{} at byte {}", description, this->pos_)));
+}
+
+char JsonReader::skipWhitespace() noexcept(true) {
+  while (this->pos_ < this->input_.size()) {
+    char c = this->input_[this->pos_];
+    if (c != ' ' && c != '\t' && c != '\n' && c != '\r') {
+      return c;
+    }
+    this->pos_++;
+  }
+  return '\0';
+}
+
+void JsonReader::expect(char c) noexcept(false) {
+  if (this->pos_ >= this->input_.size() || this->input_[this->pos_] != c) {
+    this->fail(fmt::format("expected '{}'", c));
+  }
+  this->pos_++;
+}
+
+void JsonReader::expectLiteral(std::string_view literal) noexcept(false) {
+  if (this->input_.substr(this->pos_, literal.size()) != literal) {
+    this->fail(fmt::format("expected '{}'", literal));
+  }
+  this->pos_ += literal.size();
+}
+
+JsonReader::ValueType JsonReader::peek() noexcept(false) {
+  char c = this->skipWhitespace();
+  if (this->pos_ >= this->input_.size()) {
+    this->fail("unexpected end of input");
+  }
+
+  switch (c) {
+    case '{':
+      return ValueType::k_object;
+    case '[':
+      return ValueType::k_array;
+    case '"':
+      return ValueType::k_string;
+    case 't':
+    case 'f':
+      return ValueType::k_boolean;
+    case 'n':
+      return ValueType::k_null;
+    default:
+      if (c == '-' || isDigit(c)) {
+        return ValueType::k_number;
+      }
+      this->fail("unexpected character");
+  }
+}
+
+bool JsonReader::nextMember(char close) noexcept(false) {
+  auto &level = this->levels_.back();
+  char c = this->skipWhitespace();
+
+  if (c == close && this->pos_ < this->input_.size()) {
+    this->pos_++;
+    this->levels_.pop_back();
+    return false;
+  }
+
+  if (level.first) {
+    level.first = false;
+  } else {
+    this->expect(',');
+  }
+  return true;
+}
+
+void JsonReader::beginObject() noexcept(false) {
+  if (this->peek() != ValueType::k_object) {
+    this->fail("expected an object");
+  }
+  this->pos_++;
+  this->levels_.push_back({'}', true});
+}
+
+bool JsonReader::nextKey(std::string_view &key) noexcept(false) {
+  if (!this->nextMember('}')) {
+    return false;
+  }
+
+  if (this->skipWhitespace() != '"' || this->pos_ >= this->input_.size()) {
+    this->fail("expected an object key");
+  }
+  this->key_buffer_.clear();
+  this->scanString(&this->key_buffer_);
+  key = this->key_buffer_;
+
+  this->skipWhitespace();
+  this->expect(':');
+  return true;
+}
+
+void JsonReader::beginArray() noexcept(false) {
+  if (this->peek() != ValueType::k_array) {
+    this->fail("expected an array");
+  }
+  this->pos_++;
+  this->levels_.push_back({']', true});
+}
+
+bool JsonReader::nextElement() noexcept(false) { return this->nextMember(']'); }
+
+uint32_t JsonReader::scanHex4() noexcept(false) {
+  if (this->pos_ + 4 > this->input_.size()) {
+    this->fail("unexpected end of input in \\u escape");
+  }
+
+  uint32_t value = 0;
+  for (int i = 0; i < 4; i++) {
+    char c = this->input_[this->pos_++];
+    value <<= 4;
+    if (isDigit(c)) {
+      value |= uint32_t(c - '0');
+    } else if (c >= 'a' && c <= 'f') {
+      value |= uint32_t(c - 'a' + 10);
+    } else if (c >= 'A' && c <= 'F') {
+      value |= uint32_t(c - 'A' + 10);
+    } else {
+      this->fail("invalid \\u escape");
+    }
+  }
+  return value;
+}
+
+void JsonReader::scanString(std::string *out) noexcept(false) {
+  const auto size = this->input_.size();
+  auto byte = [this](std::size_t i) { return static_cast<unsigned char>(this->input_[i]); };
+
+  this->pos_++;  // opening quote
+  auto run_begin = this->pos_;
+
+  while (true) {
+    // Plain ASCII runs are copied at once
+    while (this->pos_ < size) {
+      auto c = byte(this->pos_);
+      if (c == '"' || c == '\\' || c < 0x20 || c >= 0x80) {
+        break;
+      }
+      this->pos_++;
+    }
+    if (this->pos_ >= size) {
+      this->fail("unexpected end of input in string");
+    }
+
+    auto c = byte(this->pos_);
+    if (c >= 0x80) {
+      // Validate a multi byte UTF-8 sequence (RFC 3629)
+      std::size_t len = 0;
+      unsigned char lo = 0x80;
+      unsigned char hi = 0xBF;
+      if (c >= 0xC2 && c <= 0xDF) {
+        len = 2;
+      } else if (c >= 0xE0 && c <= 0xEF) {
+        len = 3;
+        lo = c == 0xE0 ? 0xA0 : 0x80;
+        hi = c == 0xED ? 0x9F : 0xBF;
+      } else if (c >= 0xF0 && c <= 0xF4) {
+        len = 4;
+        lo = c == 0xF0 ? 0x90 : 0x80;
+        hi = c == 0xF4 ? 0x8F : 0xBF;
+      } else {
+        this->fail("invalid UTF-8 byte in string");
+      }
+
+      if (this->pos_ + len > size) {
+        this->fail("unexpected end of input in string");
+      }
+      if (byte(this->pos_ + 1) < lo || byte(this->pos_ + 1) > hi) {
+        this->fail("invalid UTF-8 byte in string");
+      }
+      for (std::size_t i = 2; i < len; i++) {
+        if (byte(this->pos_ + i) < 0x80 || byte(this->pos_ + i) > 0xBF) {
+          this->fail("invalid UTF-8 byte in string");
+        }
+      }
+      this->pos_ += len;
+      continue;
+    }
+
+    if (out != nullptr) {
+      out->append(this->input_.data() + run_begin, this->pos_ - run_begin);
+    }
+
+    if (c == '"') {
+      this->pos_++;
+      return;
+    }
+    if (c < 0x20) {
+      this->fail("control character in string must be escaped");
+    }
+
+    // Escape sequence
+    this->pos_++;
+    if (this->pos_ >= size) {
+      this->fail("unexpected end of input in string");
+    }
+    char escaped = this->input_[this->pos_++];
+    char replacement = '\0';
+    switch (escaped) {
+      case '"':
+      case '\\':
+      case '/':
+        replacement = escaped;
+        break;
+      case 'b':
+        replacement = '\b';
+        break;
+      case 'f':
+        replacement = '\f';
+        break;
+      case 'n':
+        replacement = '\n';
+        break;
+      case 'r':
+        replacement = '\r';
+        break;
+      case 't':
+        replacement = '\t';
+        break;
+      case 'u': {
+        auto codepoint = this->scanHex4();
+        if (codepoint >= 0xDC00 && codepoint <= 0xDFFF) {
+          this->fail("invalid surrogate pair in \\u escape");
+        }
+        if (codepoint >= 0xD800 && codepoint <= 0xDBFF) {
+          if (this->input_.substr(this->pos_, 2) != "\\u") {
+            this->fail("invalid surrogate pair in \\u escape");
+          }
+          this->pos_ += 2;
+          auto low = this->scanHex4();
+          if (low < 0xDC00 || low > 0xDFFF) {
+            this->fail("invalid surrogate pair in \\u escape");
+          }
+          codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00);
+        }
+        if (out != nullptr) {
+          appendUtf8(*out, codepoint);
+        }
+        break;
+      }
+      default:
+        this->fail("invalid escape sequence");
+    }
+
+    if (replacement != '\0' && out != nullptr) {
+      out->push_back(replacement);
+    }
+    run_begin = this->pos_;
+  }
+}
+
+std::string_view JsonReader::scanNumber() noexcept(false) {
+  const auto size = this->input_.size();
+  auto begin = this->pos_;
+  auto digits = [this, size] {
+    auto digits_begin = this->pos_;
+    while (this->pos_ < size && isDigit(this->input_[this->pos_])) {
+      this->pos_++;
+    }
+    if (this->pos_ == digits_begin) {
+      this->fail("expected a digit");
+    }
+  };
+
+  if (this->input_[this->pos_] == '-') {
+    this->pos_++;
+  }
+  if (this->pos_ < size && this->input_[this->pos_] == '0') {
+    this->pos_++;
+  } else {
+    digits();
+  }
+  if (this->pos_ < size && this->input_[this->pos_] == '.') {
+    this->pos_++;
+    digits();
+  }
+  if (this->pos_ < size && (this->input_[this->pos_] == 'e' || this->input_[this->pos_] == 'E')) {
+    this->pos_++;
+    if (this->pos_ < size && (this->input_[this->pos_] == '+' || this->input_[this->pos_] == '-')) {
+      this->pos_++;
+    }
+    digits();
+  }
+
+  return this->input_.substr(begin, this->pos_ - begin);
+}
+
+void JsonReader::readString(std::string &out) noexcept(false) {
+  if (this->peek() != ValueType::k_string) {
+    this->fail("expected a string");
+  }
+  out.clear();
+  this->scanString(&out);
+}
+
+std::string_view JsonReader::readNumber() noexcept(false) {
+  if (this->peek() != ValueType::k_number) {
+    this->fail("expected a number");
+  }
+  return this->scanNumber();
+}
+
+bool JsonReader::readBoolean() noexcept(false) {
+  if (this->peek() != ValueType::k_boolean) {
+    this->fail("expected a boolean");
+  }
+  if (this->input_[this->pos_] == 't') {
+    this->expectLiteral("true");
+    return true;
+  }
+  this->expectLiteral("false");
+  return false;
+}
+
+void JsonReader::readNull() noexcept(false) {
+  if (this->peek() != ValueType::k_null) {
+    this->fail("expected null");
+  }
+  this->expectLiteral("null");
+}
+
+std::string_view JsonReader::skipValue() noexcept(false) {
+  const auto depth = this->levels_.size();
+  this->peek();
+  const auto begin = this->pos_;
+
+  do {
+    switch (this->peek()) {
+      case ValueType::k_object:
+        this->beginObject();
+        break;
+      case ValueType::k_array:
+        this->beginArray();
+        break;
+      case ValueType::k_string:
+        this->scanString(nullptr);
+        break;
+      case ValueType::k_number:
+        this->scanNumber();
+        break;
+      case ValueType::k_boolean:
+        this->readBoolean();
+        break;
+      case ValueType::k_null:
+        this->readNull();
+        break;
+    }
+
+    // Close all finished containers, stop at the next member of an open one
+    while (this->levels_.size() > depth) {
+      std::string_view key;
+      if (this->levels_.back().close == '}' ? this->nextKey(key) : this->nextElement()) {
+        break;
+      }
+    }
+  } while (this->levels_.size() > depth);
+
+  return this->input_.substr(begin, this->pos_ - begin);
+}
+
+void JsonReader::end() noexcept(false) {
+  this->skipWhitespace();
+  if (this->pos_ != this->input_.size()) {
+    this->fail("unexpected characters after the JSON value");
+  }
+}
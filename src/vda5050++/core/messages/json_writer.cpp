@@ -0,0 +1,161 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+
+#include "vda5050++/core/messages/json_writer.h"
+
+#include <nlohmann/json.hpp>
+#include <spdlog/fmt/fmt.h>
+
+#include <array>
+#include <charconv>
+#include <cmath>
+
+#include "vda5050++/core/common/exception.h"
+
+using namespace vda5050pp::core::messages;
+
+///
+///\brief Get the length of the UTF-8 sequence, which starts with a byte >= 0x80 (RFC 3629).
+///
+///\param c the first byte
+///\param lo the lower bound of the second byte
+///\param hi the upper bound of the second byte
+///\return std::size_t the length or 0, if c cannot start a sequence
+///
+static std::size_t utf8SequenceLength(unsigned char c, unsigned char &lo,
+                                      unsigned char &hi) noexcept(true) {
+  lo = 0x80;
+  hi = 0xBF;
+  if (c >= 0xC2 && c <= 0xDF) {
+    return 2;
+  }
+  if (c >= 0xE0 && c <= 0xEF) {
+    lo = c == 0xE0 ? 0xA0 : lo;
+    hi = c == 0xED ? 0x9F : hi;
+    return 3;
+  }
+  if (c >= 0xF0 && c <= 0xF4) {
+    lo = c == 0xF0 ? 0x90 : lo;
+    hi = c == 0xF4 ? 0x8F : hi;
+    return 4;
+  }
+  return 0;
+}
+
+void JsonWriter::writeEscaped(std::string_view str) {
+  static constexpr std::string_view k_hex = "0123456789abcdef";
+
+  this->buffer_.push_back('"');
+
+  // Append unescaped runs in one go
+  std::size_t run_begin = 0;
+  for (std::size_t i = 0; i < str.size(); i++) {
+    auto c = static_cast<unsigned char>(str[i]);
+    if (c >= 0x80) {
+      // Non-ASCII is copied as is, but it has to be valid UTF-8 (like nlohmann's type_error.316)
+      unsigned char lo;
+      unsigned char hi;
+      auto len = utf8SequenceLength(c, lo, hi);
+      if (len == 0) {
+        throw vda5050pp::VDA5050PPJsonError(
+            MK_EX_CONTEXT(fmt::format("invalid UTF-8 byte at index {}: 0x{:02X}", i, c)));
+      }
+      for (std::size_t j = 1; j < len; j++) {
+        if (i + j >= str.size()) {
+          throw vda5050pp::VDA5050PPJsonError(MK_EX_CONTEXT(fmt::format(
+              "incomplete UTF-8 string; last byte: 0x{:02X}",
+              static_cast<unsigned char>(str.back()))));
+        }
+        auto cont = static_cast<unsigned char>(str[i + j]);
+        if (cont < lo || cont > hi) {
+          throw vda5050pp::VDA5050PPJsonError(MK_EX_CONTEXT(
+              fmt::format("invalid UTF-8 byte at index {}: 0x{:02X}", i + j, cont)));
+        }
+        lo = 0x80;
+        hi = 0xBF;
+      }
+      i += len - 1;
+      continue;
+    }
+    if (c >= 0x20 && c != '"' && c != '\\') {
+      continue;
+    }
+
+    this->buffer_.append(str.data() + run_begin, i - run_begin);
+    run_begin = i + 1;
+
+    switch (c) {
+      case '"':
+        this->buffer_.append("\\\"");
+        break;
+      case '\\':
+        this->buffer_.append("\\\\");
+        break;
+      case '\b':
+        this->buffer_.append("\\b");
+        break;
+      case '\f':
+        this->buffer_.append("\\f");
+        break;
+      case '\n':
+        this->buffer_.append("\\n");
+        break;
+      case '\r':
+        this->buffer_.append("\\r");
+        break;
+      case '\t':
+        this->buffer_.append("\\t");
+        break;
+      default:
+        this->buffer_.append("\\u00");
+        this->buffer_.push_back(k_hex[c >> 4]);
+        this->buffer_.push_back(k_hex[c & 0xf]);
+        break;
+    }
+  }
+  this->buffer_.append(str.data() + run_begin, str.size() - run_begin);
+
+  this->buffer_.push_back('"');
+}
+
+void JsonWriter::writeInteger(int64_t value) {
+  std::array<char, 24> buf;
+  auto [end, ec] = std::to_chars(buf.data(), buf.data() + buf.size(), value);
+  this->buffer_.append(buf.data(), end);
+}
+
+void JsonWriter::writeUnsigned(uint64_t value) {
+  std::array<char, 24> buf;
+  auto [end, ec] = std::to_chars(buf.data(), buf.data() + buf.size(), value);
+  this->buffer_.append(buf.data(), end);
+}
+
+void JsonWriter::writeFloat(double value) {
+  if (!std::isfinite(value)) {
+    this->buffer_.append("null");
+    return;
+  }
+
+  // Same algorithm (and buffer size) as nlohmann's serializer
+  std::array<char, 64> buf;
+  auto end = nlohmann::detail::to_chars(buf.data(), buf.data() + buf.size(), value);
+  this->buffer_.append(buf.data(), end);
+}
+
+void JsonWriter::reset() {
+  this->buffer_.clear();
+  this->buffer_.reserve(this->capacity_hint_);
+  this->first_ = true;
+}
+
+std::string JsonWriter::take() noexcept(true) {
+  if (this->buffer_.size() > this->capacity_hint_) {
+    this->capacity_hint_ = this->buffer_.size();
+  }
+  this->first_ = true;
+  return std::move(this->buffer_);
+}
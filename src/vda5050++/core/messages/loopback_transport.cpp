@@ -0,0 +1,172 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+
+#include "vda5050++/core/messages/loopback_transport.h"
+
+#include <spdlog/fmt/fmt.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "vda5050++/core/common/exception.h"
+
+using namespace vda5050pp::core::messages;
+
+static bool isSubTopic(std::string_view topic, std::string_view sub_topic) {
+  return topic.size() > sub_topic.size() &&
+         topic.substr(topic.size() - sub_topic.size()) == sub_topic &&
+         topic[topic.size() - sub_topic.size() - 1] == '/';
+}
+
+// MQTT topic filter matching ("+" matches one level, "#" all remaining levels)
+static bool matchesFilter(std::string_view filter, std::string_view topic) {
+  while (true) {
+    auto filter_end = filter.find('/');
+    auto topic_end = topic.find('/');
+    auto filter_level = filter.substr(0, filter_end);
+    auto topic_level = topic.substr(0, topic_end);
+
+    if (filter_level == "#") {
+      return true;
+    }
+    if (filter_level != "+" && filter_level != topic_level) {
+      return false;
+    }
+    if (filter_end == std::string_view::npos || topic_end == std::string_view::npos) {
+      return filter_end == topic_end;
+    }
+    filter.remove_prefix(filter_end + 1);
+    topic.remove_prefix(topic_end + 1);
+  }
+}
+
+std::string LoopbackTransport::findSubscription(std::string_view sub_topic,
+                                                std::string_view serial_number) const {
+  std::unique_lock lock(this->mutex_);
+  for (const auto &topic : this->subscriptions_) {
+    if (isSubTopic(topic, sub_topic)) {
+      // A shared connection subscribes to all serial numbers
+      auto wildcard = topic.find("/+/");
+      if (wildcard == std::string::npos) {
+        return topic;
+      }
+      return fmt::format("{}/{}/{}", topic.substr(0, wildcard), serial_number,
+                         topic.substr(wildcard + 3));
+    }
+  }
+  throw vda5050pp::VDA5050PPMqttError(
+      MK_EX_CONTEXT(fmt::format("LoopbackTransport has no subscription for \"{}\"", sub_topic)));
+}
+
+void LoopbackTransport::setCallbacks(mqtt::callback &callback, mqtt::iaction_listener &,
+                                     PublishCompletion completion) {
+  std::unique_lock lock(this->mutex_);
+  this->callback_ = &callback;
+  this->completion_ = std::move(completion);
+}
+
+void LoopbackTransport::connect() {
+  mqtt::callback *callback = nullptr;
+  {
+    std::unique_lock lock(this->mutex_);
+    if (this->callback_ == nullptr) {
+      throw vda5050pp::VDA5050PPMqttError(MK_EX_CONTEXT("LoopbackTransport has no callbacks"));
+    }
+    this->connected_ = true;
+    callback = this->callback_;
+  }
+  // Never call back while holding the lock, the callback subscribes and publishes
+  callback->connected("loopback");
+}
+
+void LoopbackTransport::disconnect() {
+  std::unique_lock lock(this->mutex_);
+  this->connected_ = false;
+}
+
+void LoopbackTransport::subscribe(const std::string &topic, int) {
+  std::unique_lock lock(this->mutex_);
+  this->subscriptions_.insert(topic);
+}
+
+void LoopbackTransport::publish(mqtt::const_message_ptr msg, void *context) {
+  PublishCompletion completion;
+  {
+    std::unique_lock lock(this->mutex_);
+    if (!this->connected_) {
+      throw vda5050pp::VDA5050PPMqttError(MK_EX_CONTEXT("LoopbackTransport is not connected"));
+    }
+    this->captured_.push_back({msg->get_topic(), msg->get_payload_str(), Clock::now()});
+    completion = this->completion_;
+  }
+  this->captured_cv_.notify_all();
+
+  if (completion) {
+    completion(context, true);
+  }
+}
+
+void LoopbackTransport::dropConnection(const std::string &cause) {
+  mqtt::callback *callback = nullptr;
+  {
+    std::unique_lock lock(this->mutex_);
+    this->connected_ = false;
+    callback = this->callback_;
+  }
+  if (callback != nullptr) {
+    callback->connection_lost(cause);
+  }
+}
+
+LoopbackTransport::Clock::time_point LoopbackTransport::inject(const std::string &topic,
+                                                               std::string payload) {
+  mqtt::callback *callback = nullptr;
+  {
+    std::unique_lock lock(this->mutex_);
+    if (!this->connected_) {
+      throw vda5050pp::VDA5050PPMqttError(MK_EX_CONTEXT("LoopbackTransport is not connected"));
+    }
+    if (std::any_of(this->subscriptions_.begin(), this->subscriptions_.end(),
+                    [&topic](const std::string &filter) { return matchesFilter(filter, topic); })) {
+      callback = this->callback_;
+    }
+  }
+
+  auto msg = mqtt::make_message(topic, std::move(payload));
+  auto injected = Clock::now();
+  if (callback != nullptr) {
+    callback->message_arrived(msg);
+  }
+  return injected;
+}
+
+LoopbackTransport::Clock::time_point LoopbackTransport::injectOrder(const vda5050::Order &order) {
+  auto topic = this->findSubscription("order", order.header.serialNumber);
+  return this->inject(topic, vda5050::json(order).dump());
+}
+
+LoopbackTransport::Clock::time_point LoopbackTransport::injectInstantActions(
+    const vda5050::InstantActions &instant_actions) {
+  auto topic = this->findSubscription("instantActions", instant_actions.header.serialNumber);
+  return this->inject(topic, vda5050::json(instant_actions).dump());
+}
+
+std::vector<LoopbackTransport::Capture> LoopbackTransport::takeCaptured() {
+  std::unique_lock lock(this->mutex_);
+  return std::exchange(this->captured_, {});
+}
+
+bool LoopbackTransport::waitForCaptured(std::string_view sub_topic, std::size_t count,
+                                        std::chrono::milliseconds timeout) {
+  std::unique_lock lock(this->mutex_);
+  return this->captured_cv_.wait_for(lock, timeout, [this, sub_topic, count] {
+    auto n = std::count_if(
+        this->captured_.begin(), this->captured_.end(),
+        [sub_topic](const Capture &capture) { return isSubTopic(capture.topic, sub_topic); });
+    return static_cast<std::size_t>(n) >= count;
+  });
+}
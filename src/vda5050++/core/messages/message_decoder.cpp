@@ -0,0 +1,387 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+//
+// All decoders are table driven: each object type has a table of its known keys. Unknown keys
+// are skipped, missing required keys (all members, which are not std::optional) throw.
+// Keys with a protocol limit throw as soon as the limit is exceeded.
+// The header and ActionParameters are decoded by the message library from their (small) raw
+// JSON text, to keep its semantics (i.e. timestamp parsing and arbitrary parameter values).
+//
+
+#include "vda5050++/core/messages/message_decoder.h"
+
+#include <spdlog/fmt/fmt.h>
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "vda5050++/core/common/exception.h"
+#include "vda5050++/core/messages/json_reader.h"
+
+using namespace vda5050pp::core::messages;
+using vda5050pp::agv_description::SimpleProtocolLimits;
+
+namespace {
+
+template <typename T> struct IsOptional : std::false_type {};
+template <typename T> struct IsOptional<std::optional<T>> : std::true_type {};
+
+template <typename T> struct IsVector : std::false_type {};
+template <typename T, typename AllocT> struct IsVector<std::vector<T, AllocT>> : std::true_type {};
+
+///
+///\brief Strips std::optional and std::vector from a member type (used to name the element types
+/// of nested members, i.e. the trajectory of an Edge).
+///
+template <typename T> struct Element { using type = T; };
+template <typename T> struct Element<std::optional<T>> : Element<T> {};
+template <typename T, typename AllocT> struct Element<std::vector<T, AllocT>> : Element<T> {};
+template <typename T> using ElementT = typename Element<T>::type;
+
+using Trajectory = ElementT<decltype(vda5050::Edge::trajectory)>;
+using ControlPoint = ElementT<decltype(Trajectory::controlPoints)>;
+
+template <typename T> struct MemberPointer;
+template <typename ClassT, typename MemberT> struct MemberPointer<MemberT ClassT::*> {
+  using Class = ClassT;
+  using Member = MemberT;
+};
+
+using Limit = std::optional<uint32_t> SimpleProtocolLimits::*;
+
+///
+///\brief A JsonReader, which also knows the protocol limits to enforce.
+///
+class MessageReader : public JsonReader {
+private:
+  const SimpleProtocolLimits &limits_;
+
+public:
+  MessageReader(std::string_view input, const SimpleProtocolLimits &limits) noexcept(true)
+      : JsonReader(input), limits_(limits) {}
+
+  std::optional<uint32_t> get(Limit limit) const noexcept(true) {
+    return limit == nullptr ? std::nullopt : this->limits_.*limit;
+  }
+
+  [[noreturn]] void exceeded(std::string_view what, uint32_t limit) const noexcept(false) {
+    throw vda5050pp::VDA5050PPProtocolLimitExceeded(MK_EX_CONTEXT(
+        fmt::format("{} exceeds the limit of {} at byte {}", what, limit, this->position())));
+  }
+};
+
+///
+///\brief The decoder of a single key of an object.
+///
+template <typename ObjectT> struct FieldDecoder {
+  std::string_view key;
+  bool required;
+  Limit limit;
+  void (*decode)(MessageReader &, ObjectT &, std::string_view, Limit);
+};
+
+void decodeObject(MessageReader &reader, vda5050::Node &node) noexcept(false);
+void decodeObject(MessageReader &reader, vda5050::NodePosition &node_position) noexcept(false);
+void decodeObject(MessageReader &reader, vda5050::Edge &edge) noexcept(false);
+void decodeObject(MessageReader &reader, Trajectory &trajectory) noexcept(false);
+void decodeObject(MessageReader &reader, ControlPoint &control_point) noexcept(false);
+void decodeObject(MessageReader &reader, vda5050::Action &action) noexcept(false);
+void decodeObject(MessageReader &reader, vda5050::ActionParameter &parameter) noexcept(false);
+
+///
+///\brief Convert a number token like nlohmann::json does: integer tokens are converted exactly
+/// (if they fit into 64 bit), all other tokens via double.
+///
+template <typename T> T decodeNumber(MessageReader &reader) noexcept(false) {
+  auto text = reader.readNumber();
+  const auto *first = text.data();
+  const auto *last = text.data() + text.size();
+
+  if constexpr (std::is_integral_v<T>) {
+    if (text.find_first_of(".eE") == std::string_view::npos) {
+      if (text.front() == '-') {
+        int64_t value = 0;
+        if (std::from_chars(first, last, value).ec == std::errc()) {
+          return static_cast<T>(value);
+        }
+      } else {
+        uint64_t value = 0;
+        if (std::from_chars(first, last, value).ec == std::errc()) {
+          return static_cast<T>(value);
+        }
+      }
+    }
+  }
+
+  double value = 0;
+  if (std::from_chars(first, last, value).ec != std::errc()) {
+    reader.fail(fmt::format("number {} is out of range", text));
+  }
+  return static_cast<T>(value);
+}
+
+///
+///\brief Decode a value.
+///
+///\param reader the reader
+///\param value the value to fill
+///\param key the key of the value (only used for error messages)
+///\param limit the maximum length of a string or the maximum size of an array
+///
+template <typename T>
+void decodeValue(MessageReader &reader, T &value, std::string_view key = {},
+                 std::optional<uint32_t> limit = std::nullopt) noexcept(false) {
+  if constexpr (IsOptional<T>::value) {
+    decodeValue(reader, value.emplace(), key, limit);
+  } else if constexpr (IsVector<T>::value) {
+    value.clear();
+    reader.beginArray();
+    while (reader.nextElement()) {
+      if (limit.has_value() && value.size() >= *limit) {
+        reader.exceeded(fmt::format("Array '{}'", key), *limit);
+      }
+      decodeValue(reader, value.emplace_back());
+    }
+  } else if constexpr (std::is_same_v<T, std::string>) {
+    reader.readString(value);
+    if (limit.has_value() && value.size() > *limit) {
+      reader.exceeded(fmt::format("String '{}'", key), *limit);
+    }
+  } else if constexpr (std::is_same_v<T, bool>) {
+    value = reader.readBoolean();
+  } else if constexpr (std::is_arithmetic_v<T>) {
+    value = decodeNumber<T>(reader);
+  } else if constexpr (std::is_enum_v<T>) {
+    // The enum names are owned by the message library
+    thread_local std::string name;
+    reader.readString(name);
+    value = vda5050::json(name).get<T>();
+  } else {
+    decodeObject(reader, value);
+  }
+}
+
+template <auto member>
+constexpr FieldDecoder<typename MemberPointer<decltype(member)>::Class> field(
+    std::string_view key, Limit limit = nullptr) noexcept(true) {
+  using Traits = MemberPointer<decltype(member)>;
+  return {key, !IsOptional<typename Traits::Member>::value, limit,
+          [](MessageReader &reader, typename Traits::Class &object, std::string_view k, Limit l) {
+            decodeValue(reader, object.*member, k, reader.get(l));
+          }};
+}
+
+///
+///\brief Decode an object with the given field table.
+///
+///\param reader the reader
+///\param object the object to fill
+///\param fields the field table
+///\param other_key called with each unknown key, returns true if it consumed the value
+///
+template <typename ObjectT, std::size_t n, typename OtherKeyFn>
+void decodeFields(MessageReader &reader, ObjectT &object,
+                  const std::array<FieldDecoder<ObjectT>, n> &fields,
+                  OtherKeyFn &&other_key) noexcept(false) {
+  static_assert(n <= 32, "The seen keys are tracked in a 32 bit mask");
+
+  uint32_t seen = 0;
+  std::string_view key;
+  reader.beginObject();
+  while (reader.nextKey(key)) {
+    auto it = std::find_if(fields.begin(), fields.end(),
+                           [key](const auto &f) { return f.key == key; });
+    if (it != fields.end()) {
+      it->decode(reader, object, it->key, it->limit);
+      seen |= uint32_t(1) << std::distance(fields.begin(), it);
+    } else if (!other_key(key)) {
+      reader.skipValue();
+    }
+  }
+
+  for (std::size_t i = 0; i < n; i++) {
+    if (fields[i].required && (seen & (uint32_t(1) << i)) == 0) {
+      reader.fail(fmt::format("key '{}' not found", fields[i].key));
+    }
+  }
+}
+
+template <typename ObjectT, std::size_t n>
+void decodeFields(MessageReader &reader, ObjectT &object,
+                  const std::array<FieldDecoder<ObjectT>, n> &fields) noexcept(false) {
+  decodeFields(reader, object, fields, [](std::string_view) { return false; });
+}
+
+///
+///\brief Collects the raw JSON values of the top-level header keys of a message.
+///
+class HeaderCollector {
+private:
+  MessageReader &reader_;
+  std::string json_;
+
+public:
+  explicit HeaderCollector(MessageReader &reader) noexcept(true) : reader_(reader) {}
+
+  bool operator()(std::string_view key) noexcept(false) {
+    static constexpr std::array<std::string_view, 5> k_header_keys = {
+        "headerId", "manufacturer", "serialNumber", "timestamp", "version"};
+    if (std::find(k_header_keys.begin(), k_header_keys.end(), key) == k_header_keys.end()) {
+      return false;
+    }
+
+    this->json_.append(this->json_.empty() ? "{\"" : ",\"");
+    this->json_.append(key);
+    this->json_.append("\":");
+    this->json_.append(this->reader_.skipValue());
+    return true;
+  }
+
+  template <typename HeaderT> void decodeInto(HeaderT &header) noexcept(false) {
+    this->json_.append(this->json_.empty() ? "{}" : "}");
+    vda5050::json::parse(this->json_).get_to(header);
+  }
+};
+
+void decodeObject(MessageReader &reader, vda5050::Node &node) noexcept(false) {
+  static constexpr std::array fields = {
+      field<&vda5050::Node::nodeId>("nodeId", &SimpleProtocolLimits::max_id_len),
+      field<&vda5050::Node::sequenceId>("sequenceId"),
+      field<&vda5050::Node::nodeDescription>("nodeDescription"),
+      field<&vda5050::Node::released>("released"),
+      field<&vda5050::Node::nodePosition>("nodePosition"),
+      field<&vda5050::Node::actions>("actions", &SimpleProtocolLimits::max_node_actions),
+  };
+  decodeFields(reader, node, fields);
+}
+
+void decodeObject(MessageReader &reader, vda5050::NodePosition &node_position) noexcept(false) {
+  static constexpr std::array fields = {
+      field<&vda5050::NodePosition::x>("x"),
+      field<&vda5050::NodePosition::y>("y"),
+      field<&vda5050::NodePosition::theta>("theta"),
+      field<&vda5050::NodePosition::allowedDeviationXY>("allowedDeviationXY"),
+      field<&vda5050::NodePosition::allowedDeviationTheta>("allowedDeviationTheta"),
+      field<&vda5050::NodePosition::mapId>("mapId"),
+      field<&vda5050::NodePosition::mapDescription>("mapDescription"),
+  };
+  decodeFields(reader, node_position, fields);
+}
+
+void decodeObject(MessageReader &reader, vda5050::Edge &edge) noexcept(false) {
+  static constexpr std::array fields = {
+      field<&vda5050::Edge::edgeId>("edgeId", &SimpleProtocolLimits::max_id_len),
+      field<&vda5050::Edge::sequenceId>("sequenceId"),
+      field<&vda5050::Edge::edgeDescription>("edgeDescription"),
+      field<&vda5050::Edge::released>("released"),
+      field<&vda5050::Edge::startNodeId>("startNodeId", &SimpleProtocolLimits::max_id_len),
+      field<&vda5050::Edge::endNodeId>("endNodeId", &SimpleProtocolLimits::max_id_len),
+      field<&vda5050::Edge::maxSpeed>("maxSpeed"),
+      field<&vda5050::Edge::maxHeight>("maxHeight"),
+      field<&vda5050::Edge::minHeight>("minHeight"),
+      field<&vda5050::Edge::orientation>("orientation"),
+      field<&vda5050::Edge::orientationType>("orientationType"),
+      field<&vda5050::Edge::direction>("direction"),
+      field<&vda5050::Edge::rotationAllowed>("rotationAllowed"),
+      field<&vda5050::Edge::maxRotationSpeed>("maxRotationSpeed"),
+      field<&vda5050::Edge::trajectory>("trajectory"),
+      field<&vda5050::Edge::length>("length"),
+      field<&vda5050::Edge::actions>("actions", &SimpleProtocolLimits::max_edge_actions),
+  };
+  decodeFields(reader, edge, fields);
+}
+
+void decodeObject(MessageReader &reader, Trajectory &trajectory) noexcept(false) {
+  static constexpr std::array fields = {
+      field<&Trajectory::degree>("degree"),
+      field<&Trajectory::knotVector>("knotVector"),
+      field<&Trajectory::controlPoints>("controlPoints"),
+  };
+  decodeFields(reader, trajectory, fields);
+}
+
+void decodeObject(MessageReader &reader, ControlPoint &control_point) noexcept(false) {
+  static constexpr std::array fields = {
+      field<&ControlPoint::x>("x"),
+      field<&ControlPoint::y>("y"),
+      field<&ControlPoint::weight>("weight"),
+  };
+  decodeFields(reader, control_point, fields);
+}
+
+void decodeObject(MessageReader &reader, vda5050::Action &action) noexcept(false) {
+  static constexpr std::array fields = {
+      field<&vda5050::Action::actionType>("actionType"),
+      field<&vda5050::Action::actionId>("actionId", &SimpleProtocolLimits::max_id_len),
+      field<&vda5050::Action::actionDescription>("actionDescription"),
+      field<&vda5050::Action::blockingType>("blockingType"),
+      field<&vda5050::Action::actionParameters>("actionParameters",
+                                                 &SimpleProtocolLimits::max_action_parameters),
+  };
+  decodeFields(reader, action, fields);
+}
+
+void decodeObject(MessageReader &reader, vda5050::ActionParameter &parameter) noexcept(false) {
+  // The value of a parameter can be any JSON value, let the library decide how to store it
+  if (reader.peek() != JsonReader::ValueType::k_object) {
+    reader.fail("expected an object");
+  }
+  vda5050::json::parse(reader.skipValue()).get_to(parameter);
+}
+
+}  // namespace
+
+static void checkMessageLen(std::string_view payload,
+                            const SimpleProtocolLimits &limits) noexcept(false) {
+  if (limits.max_message_len.has_value() && payload.size() > *limits.max_message_len) {
+    throw vda5050pp::VDA5050PPProtocolLimitExceeded(
+        MK_FN_EX_CONTEXT(fmt::format("Message of {} bytes exceeds the limit of {} bytes",
+                                     payload.size(), *limits.max_message_len)));
+  }
+}
+
+void vda5050pp::core::messages::decode(std::string_view payload, vda5050::Order &order,
+                                       const SimpleProtocolLimits &limits) {
+  static constexpr std::array fields = {
+      field<&vda5050::Order::orderId>("orderId", &SimpleProtocolLimits::max_id_len),
+      field<&vda5050::Order::orderUpdateId>("orderUpdateId"),
+      field<&vda5050::Order::zoneSetId>("zoneSetId", &SimpleProtocolLimits::max_id_len),
+      field<&vda5050::Order::nodes>("nodes", &SimpleProtocolLimits::max_order_nodes),
+      field<&vda5050::Order::edges>("edges", &SimpleProtocolLimits::max_order_edges),
+  };
+
+  checkMessageLen(payload, limits);
+
+  MessageReader reader(payload, limits);
+  HeaderCollector header(reader);
+  decodeFields(reader, order, fields, header);
+  reader.end();
+  header.decodeInto(order.header);
+}
+
+void vda5050pp::core::messages::decode(std::string_view payload,
+                                       vda5050::InstantActions &instant_actions,
+                                       const SimpleProtocolLimits &limits) {
+  static constexpr std::array fields = {
+      field<&vda5050::InstantActions::actions>("actions",
+                                                &SimpleProtocolLimits::max_instant_actions),
+  };
+
+  checkMessageLen(payload, limits);
+
+  MessageReader reader(payload, limits);
+  HeaderCollector header(reader);
+  decodeFields(reader, instant_actions, fields, header);
+  reader.end();
+  header.decodeInto(instant_actions.header);
+}
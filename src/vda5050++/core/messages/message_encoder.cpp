@@ -0,0 +1,380 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+//
+// All encoders write the keys of an object in lexicographic order, because vda5050::json
+// (nlohmann::json) stores objects in a std::map. Optional fields are omitted, if they are empty.
+// Objects without any required field are written as null, if all fields are empty.
+//
+
+#include "vda5050++/core/messages/message_encoder.h"
+
+#include <array>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using namespace vda5050pp::core::messages;
+
+static_assert(std::is_same_v<vda5050::json, nlohmann::json>,
+              "The encoders mimic the object key order of nlohmann::json");
+
+namespace {
+
+template <typename T> struct IsOptional : std::false_type {};
+template <typename T> struct IsOptional<std::optional<T>> : std::true_type {};
+
+template <typename T> struct IsVector : std::false_type {};
+template <typename T, typename AllocT> struct IsVector<std::vector<T, AllocT>> : std::true_type {};
+
+///
+///\brief Strips std::optional and std::vector from a member type (used to name the element types
+/// of nested members, i.e. the trajectory of an EdgeState).
+///
+template <typename T> struct Element { using type = T; };
+template <typename T> struct Element<std::optional<T>> : Element<T> {};
+template <typename T, typename AllocT> struct Element<std::vector<T, AllocT>> : Element<T> {};
+template <typename T> using ElementT = typename Element<T>::type;
+
+using Trajectory = ElementT<decltype(vda5050::EdgeState::trajectory)>;
+using ControlPoint = ElementT<decltype(Trajectory::controlPoints)>;
+
+///
+///\brief Get the serialized JSON value of an enum value. The enum serialization is owned
+/// by the message library, so each value is converted once via vda5050::json and cached.
+///
+template <typename EnumT> std::string_view enumJson(EnumT value) noexcept(false) {
+  static constexpr std::size_t k_cached = 16;
+  static std::array<std::once_flag, k_cached> once;
+  static std::array<std::string, k_cached> cache;
+
+  auto idx = static_cast<std::size_t>(value);
+  if (idx >= k_cached) {
+    thread_local std::string uncached;
+    uncached = vda5050::json(value).dump();
+    return uncached;
+  }
+
+  std::call_once(once[idx], [idx, value] { cache[idx] = vda5050::json(value).dump(); });
+  return cache[idx];
+}
+
+void encodeObject(JsonWriter &writer, const vda5050::NodeState &node_state) noexcept(false);
+void encodeObject(JsonWriter &writer, const vda5050::NodePosition &node_position) noexcept(false);
+void encodeObject(JsonWriter &writer, const vda5050::EdgeState &edge_state) noexcept(false);
+void encodeObject(JsonWriter &writer, const Trajectory &trajectory) noexcept(false);
+void encodeObject(JsonWriter &writer, const ControlPoint &control_point) noexcept(false);
+void encodeObject(JsonWriter &writer, const vda5050::AGVPosition &agv_position) noexcept(false);
+void encodeObject(JsonWriter &writer, const vda5050::Velocity &velocity) noexcept(false);
+void encodeObject(JsonWriter &writer, const vda5050::Load &load) noexcept(false);
+void encodeObject(JsonWriter &writer, const vda5050::BoundingBoxReference &ref) noexcept(false);
+void encodeObject(JsonWriter &writer, const vda5050::LoadDimensions &dimensions) noexcept(false);
+void encodeObject(JsonWriter &writer, const vda5050::ActionState &action_state) noexcept(false);
+void encodeObject(JsonWriter &writer, const vda5050::BatteryState &battery_state) noexcept(false);
+void encodeObject(JsonWriter &writer, const vda5050::Error &error) noexcept(false);
+void encodeObject(JsonWriter &writer, const vda5050::Info &info) noexcept(false);
+void encodeObject(JsonWriter &writer, const vda5050::SafetyState &safety_state) noexcept(false);
+
+///
+///\brief Encode ErrorReferences and InfoReferences (both share the same layout).
+///
+template <typename ReferenceT>
+auto encodeObject(JsonWriter &writer, const ReferenceT &reference) noexcept(false)
+    -> decltype(reference.referenceKey, reference.referenceValue, void());
+
+template <typename T> void encodeValue(JsonWriter &writer, const T &value) noexcept(false) {
+  if constexpr (IsVector<T>::value) {
+    writer.beginArray();
+    for (const auto &element : value) {
+      encodeValue(writer, element);
+    }
+    writer.endArray();
+  } else if constexpr (std::is_enum_v<T>) {
+    writer.raw(enumJson(value));
+  } else if constexpr (std::is_same_v<T, std::string>) {
+    writer.value(std::string_view(value));
+  } else if constexpr (std::is_arithmetic_v<T>) {
+    writer.value(value);
+  } else {
+    encodeObject(writer, value);
+  }
+}
+
+template <typename T>
+void field(JsonWriter &writer, std::string_view key, const T &value) noexcept(false) {
+  if constexpr (IsOptional<T>::value) {
+    if (value.has_value()) {
+      field(writer, key, *value);
+    }
+  } else {
+    writer.key(key);
+    encodeValue(writer, value);
+  }
+}
+
+///
+///\brief Write a field, whose encoded value is reused from the fragment, if the revision matches.
+///
+template <typename T>
+void cachedField(JsonWriter &writer, std::string_view key, const T &value, uint64_t revision,
+                 StateFragmentCache::Fragment *fragment) noexcept(false) {
+  if (fragment == nullptr || revision == 0) {
+    field(writer, key, value);
+  } else if constexpr (IsOptional<T>::value) {
+    if (value.has_value()) {
+      cachedField(writer, key, *value, revision, fragment);
+    }
+  } else {
+    writer.key(key);
+    if (fragment->revision == revision) {
+      writer.raw(fragment->json);
+      return;
+    }
+
+    auto begin = writer.view().size();
+    encodeValue(writer, value);
+    fragment->json.assign(writer.view().substr(begin));
+    fragment->revision = revision;
+  }
+}
+
+void timestampField(JsonWriter &writer, const vda5050::HeaderVDA5050 &header) noexcept(false) {
+  // The timestamp format is owned by the message library
+  vda5050::json j = header;
+  writer.key("timestamp");
+  writer.raw(j.at("timestamp").dump());
+}
+
+void encodeObject(JsonWriter &writer, const vda5050::NodeState &node_state) {
+  writer.beginObject();
+  field(writer, "nodeDescription", node_state.nodeDescription);
+  field(writer, "nodeId", node_state.nodeId);
+  field(writer, "nodePosition", node_state.nodePosition);
+  field(writer, "released", node_state.released);
+  field(writer, "sequenceId", node_state.sequenceId);
+  writer.endObject();
+}
+
+void encodeObject(JsonWriter &writer, const vda5050::NodePosition &node_position) {
+  writer.beginObject();
+  field(writer, "allowedDeviationTheta", node_position.allowedDeviationTheta);
+  field(writer, "allowedDeviationXY", node_position.allowedDeviationXY);
+  field(writer, "mapDescription", node_position.mapDescription);
+  field(writer, "mapId", node_position.mapId);
+  field(writer, "theta", node_position.theta);
+  field(writer, "x", node_position.x);
+  field(writer, "y", node_position.y);
+  writer.endObject();
+}
+
+void encodeObject(JsonWriter &writer, const vda5050::EdgeState &edge_state) {
+  writer.beginObject();
+  field(writer, "edgeDescription", edge_state.edgeDescription);
+  field(writer, "edgeId", edge_state.edgeId);
+  field(writer, "released", edge_state.released);
+  field(writer, "sequenceId", edge_state.sequenceId);
+  field(writer, "trajectory", edge_state.trajectory);
+  writer.endObject();
+}
+
+void encodeObject(JsonWriter &writer, const Trajectory &trajectory) {
+  writer.beginObject();
+  field(writer, "controlPoints", trajectory.controlPoints);
+  field(writer, "degree", trajectory.degree);
+  field(writer, "knotVector", trajectory.knotVector);
+  writer.endObject();
+}
+
+void encodeObject(JsonWriter &writer, const ControlPoint &control_point) {
+  writer.beginObject();
+  field(writer, "weight", control_point.weight);
+  field(writer, "x", control_point.x);
+  field(writer, "y", control_point.y);
+  writer.endObject();
+}
+
+void encodeObject(JsonWriter &writer, const vda5050::AGVPosition &agv_position) {
+  writer.beginObject();
+  field(writer, "deviationRange", agv_position.deviationRange);
+  field(writer, "localizationScore", agv_position.localizationScore);
+  field(writer, "mapDescription", agv_position.mapDescription);
+  field(writer, "mapId", agv_position.mapId);
+  field(writer, "positionInitialized", agv_position.positionInitialized);
+  field(writer, "theta", agv_position.theta);
+  field(writer, "x", agv_position.x);
+  field(writer, "y", agv_position.y);
+  writer.endObject();
+}
+
+void encodeObject(JsonWriter &writer, const vda5050::Velocity &velocity) {
+  writer.beginObject();
+  field(writer, "omega", velocity.omega);
+  field(writer, "vx", velocity.vx);
+  field(writer, "vy", velocity.vy);
+  writer.endObjectOrNull();
+}
+
+void encodeObject(JsonWriter &writer, const vda5050::Load &load) {
+  writer.beginObject();
+  field(writer, "boundingBoxReference", load.boundingBoxReference);
+  field(writer, "loadDimensions", load.loadDimensions);
+  field(writer, "loadId", load.loadId);
+  field(writer, "loadPosition", load.loadPosition);
+  field(writer, "loadType", load.loadType);
+  field(writer, "weight", load.weight);
+  writer.endObjectOrNull();
+}
+
+void encodeObject(JsonWriter &writer, const vda5050::BoundingBoxReference &ref) {
+  writer.beginObject();
+  field(writer, "theta", ref.theta);
+  field(writer, "x", ref.x);
+  field(writer, "y", ref.y);
+  field(writer, "z", ref.z);
+  writer.endObject();
+}
+
+void encodeObject(JsonWriter &writer, const vda5050::LoadDimensions &dimensions) {
+  writer.beginObject();
+  field(writer, "height", dimensions.height);
+  field(writer, "length", dimensions.length);
+  field(writer, "width", dimensions.width);
+  writer.endObject();
+}
+
+void encodeObject(JsonWriter &writer, const vda5050::ActionState &action_state) {
+  writer.beginObject();
+  field(writer, "actionDescription", action_state.actionDescription);
+  field(writer, "actionId", action_state.actionId);
+  field(writer, "actionStatus", action_state.actionStatus);
+  field(writer, "actionType", action_state.actionType);
+  field(writer, "resultDescription", action_state.resultDescription);
+  writer.endObject();
+}
+
+void encodeObject(JsonWriter &writer, const vda5050::BatteryState &battery_state) {
+  writer.beginObject();
+  field(writer, "batteryCharge", battery_state.batteryCharge);
+  field(writer, "batteryHealth", battery_state.batteryHealth);
+  field(writer, "batteryVoltage", battery_state.batteryVoltage);
+  field(writer, "charging", battery_state.charging);
+  field(writer, "reach", battery_state.reach);
+  writer.endObject();
+}
+
+template <typename ReferenceT>
+auto encodeObject(JsonWriter &writer, const ReferenceT &reference)
+    -> decltype(reference.referenceKey, reference.referenceValue, void()) {
+  writer.beginObject();
+  field(writer, "referenceKey", reference.referenceKey);
+  field(writer, "referenceValue", reference.referenceValue);
+  writer.endObject();
+}
+
+void encodeObject(JsonWriter &writer, const vda5050::Error &error) {
+  writer.beginObject();
+  field(writer, "errorDescription", error.errorDescription);
+  field(writer, "errorLevel", error.errorLevel);
+  field(writer, "errorReferences", error.errorReferences);
+  field(writer, "errorType", error.errorType);
+  writer.endObject();
+}
+
+void encodeObject(JsonWriter &writer, const vda5050::Info &info) {
+  writer.beginObject();
+  field(writer, "infoDescription", info.infoDescription);
+  field(writer, "infoLevel", info.infoLevel);
+  field(writer, "infoReferences", info.infoReferences);
+  field(writer, "infoType", info.infoType);
+  writer.endObject();
+}
+
+void encodeObject(JsonWriter &writer, const vda5050::SafetyState &safety_state) {
+  writer.beginObject();
+  field(writer, "eStop", safety_state.eStop);
+  field(writer, "fieldViolation", safety_state.fieldViolation);
+  writer.endObject();
+}
+
+void encodeState(JsonWriter &writer, const vda5050::State &state,
+                 const vda5050pp::core::state::StateRevisions &revisions,
+                 StateFragmentCache *cache) noexcept(false) {
+  writer.beginObject();
+  cachedField(writer, "actionStates", state.actionStates, revisions.action_states,
+              cache != nullptr ? &cache->action_states : nullptr);
+  field(writer, "agvPosition", state.agvPosition);
+  field(writer, "batteryState", state.batteryState);
+  field(writer, "distanceSinceLastNode", state.distanceSinceLastNode);
+  field(writer, "driving", state.driving);
+  cachedField(writer, "edgeStates", state.edgeStates, revisions.graph,
+              cache != nullptr ? &cache->edge_states : nullptr);
+  cachedField(writer, "errors", state.errors, revisions.errors,
+              cache != nullptr ? &cache->errors : nullptr);
+  field(writer, "headerId", state.header.headerId);
+  cachedField(writer, "information", state.information, revisions.information,
+              cache != nullptr ? &cache->information : nullptr);
+  field(writer, "lastNodeId", state.lastNodeId);
+  field(writer, "lastNodeSequenceId", state.lastNodeSequenceId);
+  cachedField(writer, "loads", state.loads, revisions.loads,
+              cache != nullptr ? &cache->loads : nullptr);
+  field(writer, "manufacturer", state.header.manufacturer);
+  field(writer, "newBaseRequest", state.newBaseRequest);
+  cachedField(writer, "nodeStates", state.nodeStates, revisions.graph,
+              cache != nullptr ? &cache->node_states : nullptr);
+  field(writer, "operatingMode", state.operatingMode);
+  field(writer, "orderId", state.orderId);
+  field(writer, "orderUpdateId", state.orderUpdateId);
+  field(writer, "paused", state.paused);
+  field(writer, "safetyState", state.safetyState);
+  field(writer, "serialNumber", state.header.serialNumber);
+  timestampField(writer, state.header);
+  field(writer, "velocity", state.velocity);
+  field(writer, "version", state.header.version);
+  field(writer, "zoneSetId", state.zoneSetId);
+  writer.endObject();
+}
+
+}  // namespace
+
+void vda5050pp::core::messages::encode(JsonWriter &writer, const vda5050::State &state) {
+  encodeState(writer, state, {}, nullptr);
+}
+
+void vda5050pp::core::messages::encode(JsonWriter &writer, const vda5050::State &state,
+                                       const vda5050pp::core::state::StateRevisions &revisions,
+                                       StateFragmentCache &cache) {
+  encodeState(writer, state, revisions, &cache);
+}
+
+void vda5050pp::core::messages::encode(JsonWriter &writer,
+                                       const vda5050::Visualization &visualization) {
+  writer.beginObject();
+  field(writer, "agvPosition", visualization.agvPosition);
+  field(writer, "headerId", visualization.header.headerId);
+  field(writer, "manufacturer", visualization.header.manufacturer);
+  field(writer, "serialNumber", visualization.header.serialNumber);
+  timestampField(writer, visualization.header);
+  field(writer, "velocity", visualization.velocity);
+  field(writer, "version", visualization.header.version);
+  writer.endObject();
+}
+
+void vda5050pp::core::messages::encode(JsonWriter &writer, const vda5050::Connection &connection) {
+  writer.beginObject();
+  field(writer, "connectionState", connection.connectionState);
+  field(writer, "headerId", connection.header.headerId);
+  field(writer, "manufacturer", connection.header.manufacturer);
+  field(writer, "serialNumber", connection.header.serialNumber);
+  timestampField(writer, connection.header);
+  field(writer, "version", connection.header.version);
+  writer.endObject();
+}
+
+void vda5050pp::core::messages::encode(JsonWriter &writer, const vda5050::AgvFactsheet &factsheet) {
+  writer.raw(vda5050::json(factsheet).dump());
+}
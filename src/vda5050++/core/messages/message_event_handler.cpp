@@ -14,6 +14,7 @@
 #include "vda5050++/core/common/exception.h"
 #include "vda5050++/core/common/formatters.h"
 #include "vda5050++/core/logger.h"
+#include "vda5050++/misc/pool_allocator.h"
 
 using namespace vda5050pp::core::messages;
 using namespace std::chrono_literals;
@@ -37,8 +38,24 @@ void MessageEventHandler::handleOrderMessage(
 
   // Dispatch validate order event
   getMessagesLogger()->debug("Dispatching ValidateOrderEvent");
-  auto vo_evt = std::make_shared<vda5050pp::core::events::ValidateOrderEvent>();
-  auto vo_future = vo_evt->getFuture();
+  auto vo_evt = vda5050pp::misc::makePooled<vda5050pp::core::events::ValidateOrderEvent>();
+#ifdef LIBVDA5050PP_COROUTINES
+  auto vo_result = vda5050pp::core::common::awaitResult(
+      vo_evt->result(), Instance::ref().getCoroutineExecutor(), 1s);
+  vo_evt->order = evt->order;
+
+  std::list<PendingValidation>::iterator pending;
+  {
+    std::unique_lock lock(this->pending_validations_mutex_);
+    pending = this->pending_validations_.insert(
+        this->pending_validations_.end(), PendingValidation{evt, nullptr, std::nullopt, false});
+  }
+  vda5050pp::core::Instance::ref().getValidationEventManager().dispatch(vo_evt);
+
+  // Do not block this thread, while the order is validated
+  this->awaitOrderValidation(pending, std::move(vo_result));
+#else
+  auto vo_future = vo_evt->getSynchronizedFuture();
   vo_evt->order = evt->order;
   vda5050pp::core::Instance::ref().getValidationEventManager().dispatch(vo_evt);
 
@@ -46,25 +63,88 @@ void MessageEventHandler::handleOrderMessage(
     throw vda5050pp::VDA5050PPSynchronizedEventTimedOut(MK_EX_CONTEXT("ValidateOrder timed out"));
   }
 
-  // Evaluate validate order result
-  auto vo_res = vo_future.get();
+  this->evaluateOrderValidation(*evt, vo_future.get());
+#endif
+}
+
+#ifdef LIBVDA5050PP_COROUTINES
+vda5050pp::core::common::Task MessageEventHandler::awaitOrderValidation(
+    std::list<PendingValidation>::iterator pending,
+    vda5050pp::core::common::ScheduledResultAwaiter<vda5050pp::core::events::ValidationResult>
+        vo_result) const {
+  std::optional<vda5050pp::core::events::ValidationResult> vo_res;
+  try {
+    vo_res = co_await vo_result;
+  } catch (...) {
+    // Do not hold back the following messages, this order is discarded
+    this->completeValidation(pending, std::nullopt);
+    throw;
+  }
+  this->completeValidation(pending, std::move(vo_res));
+}
+
+void MessageEventHandler::completeValidation(
+    std::list<PendingValidation>::iterator pending,
+    std::optional<vda5050pp::core::events::ValidationResult> vo_res) const {
+  std::unique_lock lock(this->pending_validations_mutex_);
+  pending->result = std::move(vo_res);
+  pending->done = true;
+
+  // Another thread evaluates the front already, it also evaluates this one (if it is next)
+  if (this->evaluating_) {
+    return;
+  }
+
+  this->evaluating_ = true;
+  while (!this->pending_validations_.empty() && this->pending_validations_.front().done) {
+    auto front = std::move(this->pending_validations_.front());
+    this->pending_validations_.pop_front();
+
+    lock.unlock();
+    if (front.result.has_value() && front.order_evt != nullptr) {
+      try {
+        this->evaluateOrderValidation(*front.order_evt, std::move(*front.result));
+      } catch (const std::exception &e) {
+        getMessagesLogger()->error("Could not evaluate the validation of order {}@{}: {}",
+                                   front.order_evt->order->orderId,
+                                   front.order_evt->order->orderUpdateId, e.what());
+      }
+    } else if (front.result.has_value() && front.instant_actions_evt != nullptr) {
+      try {
+        this->evaluateInstantActionsValidation(*front.instant_actions_evt,
+                                               std::move(*front.result));
+      } catch (const std::exception &e) {
+        getMessagesLogger()->error("Could not evaluate the validation of instant actions {}: {}",
+                                   front.instant_actions_evt->instant_actions->header.headerId,
+                                   e.what());
+      }
+    }
+    lock.lock();
+  }
+  this->evaluating_ = false;
+}
+#endif
+
+void MessageEventHandler::evaluateOrderValidation(
+    const vda5050pp::core::events::ReceiveOrderMessageEvent &evt,
+    vda5050pp::core::events::ValidationResult vo_res) const {
   if (!vo_res.empty()) {
     getMessagesLogger()->info("Order (headerId={}) contains {} errors: {}",
-                              evt->order->header.headerId, vo_res.size(), vo_res);
+                              evt.order->header.headerId, vo_res.size(), vo_res);
     getMessagesLogger()->warn("Order {}@{} will be discarded, because it contains errors.",
-                              evt->order->orderId, evt->order->orderUpdateId);
+                              evt.order->orderId, evt.order->orderUpdateId);
 
     // Notify about new errors
     auto &mgr = vda5050pp::core::Instance::ref().getStatusEventManager();
     for (const auto &error : vo_res) {
-      auto e_evt = std::make_shared<vda5050pp::events::ErrorAdd>();
+      auto e_evt = vda5050pp::misc::makePooled<vda5050pp::events::ErrorAdd>();
       e_evt->error = error;
       mgr.dispatch(e_evt);
     }
   } else {
     // Notify about a new valid order
-    auto o_evt = std::make_shared<vda5050pp::core::events::ValidOrderMessageEvent>();
-    o_evt->valid_order = evt->order;
+    auto o_evt = vda5050pp::misc::makePooled<vda5050pp::core::events::ValidOrderMessageEvent>();
+    o_evt->valid_order = evt.order;
     vda5050pp::core::Instance::ref().getMessageEventManager().dispatch(o_evt);
   }
 }
@@ -76,9 +156,9 @@ void MessageEventHandler::handleInstantActionsMessage(
         MK_EX_CONTEXT("ReceiveInstantActionMessage is empty"));
   }
 
-  auto v_evt = std::make_shared<vda5050pp::core::events::ValidateInstantActionsEvent>();
+  auto v_evt = vda5050pp::misc::makePooled<vda5050pp::core::events::ValidateInstantActionsEvent>();
   v_evt->instant_actions = evt->instant_actions;
-  auto v_future = v_evt->getFuture();
+  auto v_future = v_evt->getSynchronizedFuture();
   Instance::ref().getValidationEventManager().synchronousDispatch(v_evt);
 
   if (v_future.wait_for(0s) == std::future_status::timeout) {
@@ -86,25 +166,44 @@ void MessageEventHandler::handleInstantActionsMessage(
         MK_EX_CONTEXT("ValidateInstantActions timed out"));
   }
 
-  auto v_res = v_future.get();
+#ifdef LIBVDA5050PP_COROUTINES
+  // Orders received before may still be validated. Release the instant actions after them, such
+  // that i.e. a cancelOrder does not overtake its order.
+  std::list<PendingValidation>::iterator pending;
+  {
+    std::unique_lock lock(this->pending_validations_mutex_);
+    pending = this->pending_validations_.insert(
+        this->pending_validations_.end(), PendingValidation{nullptr, evt, std::nullopt, false});
+  }
+  this->completeValidation(pending, v_future.get());
+#else
+  this->evaluateInstantActionsValidation(*evt, v_future.get());
+#endif
+}
+
+void MessageEventHandler::evaluateInstantActionsValidation(
+    const vda5050pp::core::events::ReceiveInstantActionMessageEvent &evt,
+    vda5050pp::core::events::ValidationResult v_res) const {
   if (!v_res.empty()) {
     getMessagesLogger()->info("InstantActions (headerId={}) contains {} errors: {}", v_res.size(),
                               v_res);
     getMessagesLogger()->warn(
         "InstantActions (headerId={}) will be discarded, because it contains errors.",
-        evt->instant_actions->header.headerId);
+        evt.instant_actions->header.headerId);
 
     // Notify about new errors
     auto &mgr = vda5050pp::core::Instance::ref().getStatusEventManager();
     for (const auto &error : v_res) {
-      auto e_evt = std::make_shared<vda5050pp::events::ErrorAdd>();
+      auto e_evt = vda5050pp::misc::makePooled<vda5050pp::events::ErrorAdd>();
       e_evt->error = error;
       mgr.dispatch(e_evt);
     }
   } else {
     // Notify about a new valid instant actions
-    auto i_evt = std::make_shared<vda5050pp::core::events::ValidInstantActionMessageEvent>();
-    i_evt->valid_instant_actions = evt->instant_actions;
+    auto i_evt =
+        vda5050pp::misc::makePooled<vda5050pp::core::events::ValidInstantActionMessageEvent>();
+    i_evt->valid_instant_actions = evt.instant_actions;
+    // Keep the order relative to queued orders, the control actions may refer to them
     vda5050pp::core::Instance::ref().getMessageEventManager().dispatch(i_evt);
   }
 }
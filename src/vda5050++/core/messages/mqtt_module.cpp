@@ -13,14 +13,54 @@
 #include <vda5050/State.h>
 #include <vda5050/Visualization.h>
 
+#include <algorithm>
+
 #include "vda5050++/core/common/exception.h"
 #include "vda5050++/core/events/message_event.h"
+#include "vda5050++/core/instance_scope.h"
 #include "vda5050++/core/logger.h"
+#include "vda5050++/core/messages/message_decoder.h"
+#include "vda5050++/core/messages/message_encoder.h"
+#include "vda5050++/core/messages/paho_transport.h"
+#include "vda5050++/core/messages/shared_connection.h"
+#include "vda5050++/misc/pool_allocator.h"
 #include "vda5050++/version.h"
 
 using namespace vda5050pp::core::messages;
 using namespace std::chrono_literals;
 
+template <typename MessageT> static std::string encodePayload(const MessageT &message) {
+  // Messages are sent from several threads, so each thread keeps its own writer. The encoded
+  // text is moved into the mqtt message, the writer only keeps the size for the next message.
+  thread_local JsonWriter writer;
+  writer.reset();
+  encode(writer, message);
+  return writer.take();
+}
+
+static std::shared_ptr<vda5050pp::core::events::MessageErrorEvent> mkJsonErrorEvent(
+    std::string_view topic, std::string_view what) {
+  auto error_event = vda5050pp::misc::makePooled<vda5050pp::core::events::MessageErrorEvent>();
+  error_event->error_type = vda5050pp::misc::MessageErrorType::k_json_deserialization;
+  error_event->description =
+      fmt::format("MqttModule could not parse message on topic \"{}\" ({})", topic, what);
+
+  vda5050pp::core::getMqttLogger()->warn(error_event->description);
+  return error_event;
+}
+
+static std::shared_ptr<vda5050pp::core::events::MessageErrorEvent> mkLimitErrorEvent(
+    std::string_view topic, std::string_view what) {
+  auto error_event = vda5050pp::misc::makePooled<vda5050pp::core::events::MessageErrorEvent>();
+  error_event->error_type = vda5050pp::misc::MessageErrorType::k_protocol_limits;
+  error_event->description = fmt::format(
+      "MqttModule rejected message on topic \"{}\", it exceeds the protocol limits ({})", topic,
+      what);
+
+  vda5050pp::core::getMqttLogger()->warn(error_event->description);
+  return error_event;
+}
+
 void MqttModule::fillHeaderConnection(vda5050::HeaderVDA5050 &header) {
   header.headerId = this->connection_seq_id_++;
   header.manufacturer = this->manufacturer_;
@@ -55,13 +95,11 @@ mqtt::will_options MqttModule::getWill() {
   connection.connectionState = vda5050::ConnectionState::CONNECTIONBROKEN;
   this->fillHeaderConnection(connection.header);
 
-  vda5050::json j = connection;
-
   mqtt::will_options will;
   will.set_topic(this->connection_topic_);
   will.set_retained(true);
-  will.set_qos(this->k_qos);
-  will.set_payload(j.dump());
+  will.set_qos(this->qos_.connection);
+  will.set_payload(encodePayload(connection));
 
   return will;
 }
@@ -69,9 +107,14 @@ mqtt::will_options MqttModule::getWill() {
 void MqttModule::useMqttOptions(const vda5050pp::config::MqttOptions &opts) {
   this->server_ = opts.server;
 
-  this->connect_opts_ = mqtt::connect_options();
-  this->connect_opts_.set_mqtt_version(4);
-  this->connect_opts_.set_clean_session(false);
+  if (opts.mqtt_version >= MQTTVERSION_5) {
+    this->connect_opts_ = mqtt::connect_options::v5();
+    this->connect_opts_.set_clean_start(false);
+  } else {
+    this->connect_opts_ = mqtt::connect_options();
+    this->connect_opts_.set_mqtt_version(opts.mqtt_version);
+    this->connect_opts_.set_clean_session(false);
+  }
   this->connect_opts_.set_user_name(opts.username.value_or(""));
   this->connect_opts_.set_password(opts.password.value_or(""));
   this->connect_opts_.set_automatic_reconnect(true);
@@ -84,6 +127,26 @@ void MqttModule::useMqttOptions(const vda5050pp::config::MqttOptions &opts) {
   if (opts.connect_timeout_) {
     this->connect_opts_.set_connect_timeout(*opts.connect_timeout_);
   }
+  if (opts.max_inflight) {
+    this->connect_opts_.set_max_inflight(*opts.max_inflight);
+  }
+
+  this->qos_ = opts.qos;
+  this->persistence_dir_ = opts.persistence_dir;
+  this->max_buffered_messages_ = opts.max_buffered_messages;
+  this->mqtt_version_ = opts.mqtt_version;
+  // Topic aliases belong to a connection, the instances on a shared one would use the same ones.
+  // Messages paho persists or buffers may be resent on a new connection, where the alias was not
+  // announced (the broker would reject them and disconnect).
+  this->use_topic_aliases_ = opts.mqtt_version >= MQTTVERSION_5 && opts.topic_aliases &&
+                             !opts.shared_connection && !opts.persistence_dir &&
+                             !opts.max_buffered_messages;
+  this->shared_connection_ = opts.shared_connection;
+  this->visualization_ttl_s_.reset();
+  if (opts.mqtt_version >= MQTTVERSION_5 && opts.visualization_ttl_) {
+    auto seconds = std::chrono::ceil<std::chrono::seconds>(*opts.visualization_ttl_).count();
+    this->visualization_ttl_s_ = static_cast<int>(std::max<decltype(seconds)>(1, seconds));
+  }
 
   if (opts.use_ssl) {
     mqtt::ssl_options ssl;
@@ -107,78 +170,147 @@ void MqttModule::useMqttOptions(const vda5050pp::config::MqttOptions &opts) {
   this->state_topic_ = prefix;
 }
 
+void MqttModule::useTransport(std::shared_ptr<Transport> transport) {
+  this->custom_transport_ = std::move(transport);
+
+  if (this->state_ == State::k_initialized && this->custom_transport_ != nullptr) {
+    this->attachTransport(this->custom_transport_);
+  }
+}
+
+void MqttModule::attachTransport(std::shared_ptr<Transport> transport) {
+  this->transport_ = std::move(transport);
+  this->transport_->setCallbacks(*this, *this, [this](void *context, bool delivered) {
+    this->publish_tracker_.endPublish(context, delivered);
+  });
+}
+
+void MqttModule::dispatchMessageEvent(
+    std::shared_ptr<vda5050pp::core::events::MessageEvent> event) const {
+  InstanceScope scope(this->instance_);
+  this->instance_->getMessageEventManager().dispatch(std::move(event));
+}
+
 void MqttModule::on_failure(const mqtt::token &tkn) {
-  auto evt = std::make_shared<vda5050pp::core::events::MessageErrorEvent>();
+  auto evt = vda5050pp::misc::makePooled<vda5050pp::core::events::MessageErrorEvent>();
   evt->error_type = vda5050pp::misc::MessageErrorType::k_delivery;
   evt->description = fmt::format("Could not deliver message (id={})", tkn.get_message_id());
 
   getMqttLogger()->warn(evt->description);
 
-  vda5050pp::core::Instance::ref().getMessageEventManager().dispatch(evt);
+  this->dispatchMessageEvent(evt);
 }
 
-void MqttModule::on_success(const mqtt::token &) {
-  // We do not care about successful deliveries
+void MqttModule::on_success(const mqtt::token &tkn) {
+  // We do not care about successful deliveries, but the broker reports the number of topic
+  // aliases it accepts with the connect response
+  if (tkn.get_type() == mqtt::token::Type::CONNECT && this->use_topic_aliases_) {
+    auto response = tkn.get_connect_response();
+    const auto &props = response.get_properties();
+
+    std::unique_lock lock(this->topic_alias_mutex_);
+    this->topic_alias_maximum_ = 0;
+    if (props.contains(mqtt::property::TOPIC_ALIAS_MAXIMUM)) {
+      this->topic_alias_maximum_ = mqtt::get<uint16_t>(props, mqtt::property::TOPIC_ALIAS_MAXIMUM);
+    }
+    getMqttLogger()->debug("MqttModule: broker accepts {} topic alias(es)",
+                           this->topic_alias_maximum_);
+  }
 }
 
 void MqttModule::connected(const std::string & /*cause*/) {
-  this->mqtt_client_->subscribe(this->order_topic_, this->k_qos);
-  this->mqtt_client_->subscribe(this->instant_actions_topic_, this->k_qos);
+  this->transport_->subscribe(this->order_topic_, this->qos_.order);
+  this->transport_->subscribe(this->instant_actions_topic_, this->qos_.instant_actions);
 
   getMqttLogger()->info("MqttModule: online");
   this->state_ = State::k_online;
-  auto evt = std::make_shared<vda5050pp::core::events::ConnectionChangedEvent>();
+  auto evt = vda5050pp::misc::makePooled<vda5050pp::core::events::ConnectionChangedEvent>();
   evt->status = vda5050pp::misc::ConnectionStatus::k_online;
-  vda5050pp::core::Instance::ref().getMessageEventManager().dispatch(evt);
+  this->dispatchMessageEvent(evt);
+
+  {
+    std::unique_lock lock(this->topic_alias_mutex_);
+    for (auto &entry : this->topic_aliases_) {
+      entry.announced = false;
+    }
+  }
 
   vda5050::Connection connection;
   connection.connectionState = vda5050::ConnectionState::ONLINE;
   this->fillHeaderConnection(connection.header);
+  // The connection message is buffered as well, so it is sent before all buffered messages
   this->sendConnection(connection);
+
+  auto flushed = this->outbound_buffer_.flush([this](OutboundMessage out) {
+    try {
+      this->publishNow(std::move(out));
+    } catch (const std::exception &e) {
+      getMqttLogger()->error("MqttModule: could not send a buffered message ({})", e.what());
+      throw;
+    }
+  });
+  getMqttLogger()->debug("MqttModule: sent {} buffered message(s)", flushed);
 }
 
 void MqttModule::connection_lost(const std::string &cause) {
   getMqttLogger()->warn("MqttModule: connection lost ({})", cause);
   if (this->state_ == State::k_online) {
-    auto evt = std::make_shared<vda5050pp::core::events::ConnectionChangedEvent>();
+    auto evt = vda5050pp::misc::makePooled<vda5050pp::core::events::ConnectionChangedEvent>();
     evt->status = vda5050pp::misc::ConnectionStatus::k_offline;
-    vda5050pp::core::Instance::ref().getMessageEventManager().dispatch(evt);
+    this->dispatchMessageEvent(evt);
   }
   this->state_ = State::k_offline;
+  this->outbound_buffer_.goOffline();
 }
 
 void MqttModule::message_arrived(mqtt::const_message_ptr msg) {
+  // Only sort the message into its lane here, so the callback thread is free for the next one
+  std::size_t lane = 0;
+  if (msg->get_topic() == this->order_topic_) {
+    lane = k_order_lane;
+  } else if (msg->get_topic() == this->instant_actions_topic_) {
+    lane = k_instant_actions_lane;
+  } else {
+    getMqttLogger()->warn("MqttModule received a message on an unknown topic \"{}\"",
+                          msg->get_topic());
+    return;
+  }
+
+  this->decode_stage_->post(lane, [this, msg] { return this->decodeMessage(*msg); });
+}
+
+DecodeStage::Delivery MqttModule::decodeMessage(const mqtt::message &msg) const {
+  // InstantActions stay in the normal lane, a cancelOrder must not overtake the order it cancels
   std::shared_ptr<vda5050pp::core::events::MessageEvent> event;
 
   try {
-    auto j = vda5050::json::parse(msg->get_payload());
+    const auto &payload = msg.get_payload();
 
-    if (msg->get_topic() == this->order_topic_) {
-      auto order_event = std::make_shared<vda5050pp::core::events::ReceiveOrderMessageEvent>();
-      order_event->order = std::make_shared<vda5050::Order>(j);
+    if (msg.get_topic() == this->order_topic_) {
+      auto order_event =
+          vda5050pp::misc::makePooled<vda5050pp::core::events::ReceiveOrderMessageEvent>();
+      order_event->order = std::make_shared<vda5050::Order>();
+      decode(payload, *order_event->order, this->protocol_limits_);
       getMqttLogger()->debug("Received Order (headerId={})", order_event->order->header.headerId);
       event = order_event;
-    } else if (msg->get_topic() == this->instant_actions_topic_) {
-      auto ia_event = std::make_shared<vda5050pp::core::events::ReceiveInstantActionMessageEvent>();
-      ia_event->instant_actions = std::make_shared<vda5050::InstantActions>(j);
+    } else {
+      auto ia_event =
+          vda5050pp::misc::makePooled<vda5050pp::core::events::ReceiveInstantActionMessageEvent>();
+      ia_event->instant_actions = std::make_shared<vda5050::InstantActions>();
+      decode(payload, *ia_event->instant_actions, this->protocol_limits_);
       getMqttLogger()->debug("Received InstantActions (headerId={})",
                              ia_event->instant_actions->header.headerId);
       event = ia_event;
-    } else {
-      getMqttLogger()->warn("MqttModule received a message on an unknown topic \"{}\"",
-                            msg->get_topic());
     }
   } catch (const vda5050::json::exception &e) {
-    auto error_event = std::make_shared<vda5050pp::core::events::MessageErrorEvent>();
-    error_event->error_type = vda5050pp::misc::MessageErrorType::k_json_deserialization;
-    error_event->description = fmt::format(
-        "MqttModule could not parse message on topic \"{}\" ({})", msg->get_topic(), e.what());
-
-    getMqttLogger()->warn(error_event->description);
-    event = error_event;
+    event = mkJsonErrorEvent(msg.get_topic(), e.what());
+  } catch (const vda5050pp::VDA5050PPJsonError &e) {
+    event = mkJsonErrorEvent(msg.get_topic(), e.what());
+  } catch (const vda5050pp::VDA5050PPProtocolLimitExceeded &e) {
+    event = mkLimitErrorEvent(msg.get_topic(), e.what());
   }
 
-  Instance::ref().getMessageEventManager().dispatch(event);
+  return [this, event] { this->dispatchMessageEvent(event); };
 }
 
 void MqttModule::delivery_complete(mqtt::delivery_token_ptr /*tok*/) {
@@ -197,7 +329,7 @@ void MqttModule::connect() {
       [[fallthrough]];
     case State::k_offline:
       getMqttLogger()->info("MqttModule: connecting");
-      this->mqtt_client_->connect(this->connect_opts_, nullptr, *this);
+      this->transport_->connect();
       break;
     default:
       throw VDA5050PPMqttError(MK_EX_CONTEXT("MqttModule is in an unknown state"));
@@ -220,83 +352,137 @@ void MqttModule::disconnect() {
       connection.connectionState = vda5050::ConnectionState::OFFLINE;
       this->fillHeaderConnection(connection.header);
       this->sendConnection(connection);
-      this->mqtt_client_->disconnect()->wait();
+      this->transport_->disconnect();
       this->state_ = State::k_offline;
-      auto evt = std::make_shared<vda5050pp::core::events::ConnectionChangedEvent>();
+      this->outbound_buffer_.goOffline();
+      auto evt = vda5050pp::misc::makePooled<vda5050pp::core::events::ConnectionChangedEvent>();
       evt->status = vda5050pp::misc::ConnectionStatus::k_offline;
-      vda5050pp::core::Instance::ref().getMessageEventManager().dispatch(evt);
+      this->dispatchMessageEvent(evt);
     } break;
     default:
       throw VDA5050PPMqttError(MK_EX_CONTEXT("MqttModule is in an unknown state"));
   }
 }
 
-void MqttModule::sendState(const vda5050::State &state) const {
+void MqttModule::publish(OutboundMessage &&out) const {
+  if (this->outbound_buffer_.offer(out.slot, out)) {
+    getMqttLogger()->debug("MqttModule: offline, buffered message on topic \"{}\"",
+                           out.message->get_topic());
+    return;
+  }
   if (this->state_ != State::k_online) {
     throw vda5050pp::VDA5050PPMqttError(MK_EX_CONTEXT("MqttModule is not online."));
   }
+  this->publishNow(std::move(out));
+}
+
+void MqttModule::publishNow(OutboundMessage &&out) const {
+  auto &msg = out.message;
+  auto *context =
+      this->publish_tracker_.beginPublish(out.slot, msg->get_payload().size(), out.created);
+
+  try {
+    // QoS 1/2 messages are resent after a reconnect (within the session), so only QoS 0 ones use
+    // an alias
+    if (this->topic_aliases_.empty() || msg->get_qos() > 0) {
+      this->transport_->publish(msg, context);
+      return;
+    }
+
+    // Publish while holding the lock, so the message announcing an alias is always queued first
+    std::unique_lock lock(this->topic_alias_mutex_);
+    TopicAlias *used = nullptr;
+    for (auto &entry : this->topic_aliases_) {
+      if (entry.topic == msg->get_topic() && entry.alias <= this->topic_alias_maximum_) {
+        used = &entry;
+        break;
+      }
+    }
+
+    if (used != nullptr) {
+      auto props = msg->get_properties();
+      props.add(mqtt::property(mqtt::property::TOPIC_ALIAS, used->alias));
+      msg->set_properties(props);
+      if (used->announced) {
+        msg->set_topic("");
+      }
+    }
+    this->transport_->publish(msg, context);
+    if (used != nullptr) {
+      used->announced = true;
+    }
+  } catch (...) {
+    this->publish_tracker_.endPublish(context, false);
+    throw;
+  }
+}
 
+void MqttModule::sendState(const vda5050::State &state) const {
+  this->sendState(state, vda5050pp::core::state::StateRevisions{});
+}
+
+void MqttModule::sendState(const vda5050::State &state,
+                           const vda5050pp::core::state::StateRevisions &revisions,
+                           std::chrono::steady_clock::time_point created) const {
   getMqttLogger()->debug("sendState(headerId={})", state.header.headerId);
 
-  vda5050::json j = state;
+  std::string payload;
+  {
+    // Reuse the encoding of all unchanged parts of the last state
+    thread_local JsonWriter writer;
+    std::unique_lock lock(this->state_cache_mutex_);
+    writer.reset();
+    encode(writer, state, revisions, this->state_cache_);
+    payload = writer.take();
+  }
 
   auto msg = std::make_shared<mqtt::message>();
   msg->set_topic(this->state_topic_);
-  msg->set_payload(j.dump());
-  msg->set_qos(this->k_qos);
-  this->mqtt_client_->publish(msg);
+  msg->set_payload(std::move(payload));
+  msg->set_qos(this->qos_.state);
+  this->publish({std::move(msg), k_state_slot, created});
 }
-void MqttModule::sendVisualization(const vda5050::Visualization &visualization) const {
-  if (this->state_ != State::k_online) {
-    throw vda5050pp::VDA5050PPMqttError(MK_EX_CONTEXT("MqttModule is not online."));
-  }
 
+void MqttModule::sendVisualization(const vda5050::Visualization &visualization,
+                                   std::chrono::steady_clock::time_point created) const {
   getMqttLogger()->debug("sendVisualization(headerId={})", visualization.header.headerId);
 
-  vda5050::json j = visualization;
-
   auto msg = std::make_shared<mqtt::message>();
   msg->set_topic(this->visualization_topic_);
-  msg->set_payload(j.dump());
-  msg->set_qos(this->k_qos);
-  this->mqtt_client_->publish(msg);
+  msg->set_payload(encodePayload(visualization));
+  msg->set_qos(this->qos_.visualization);
+  if (this->visualization_ttl_s_) {
+    msg->set_properties(
+        {mqtt::property(mqtt::property::MESSAGE_EXPIRY_INTERVAL, *this->visualization_ttl_s_)});
+  }
+  this->publish({std::move(msg), k_visualization_slot, created});
 }
 
 void MqttModule::sendConnection(const vda5050::Connection &connection) const {
-  if (this->state_ != State::k_online) {
-    throw vda5050pp::VDA5050PPMqttError(MK_EX_CONTEXT("MqttModule is not online."));
-  }
-
   getMqttLogger()->debug("sendConnection(headerId={})", connection.header.headerId);
 
-  vda5050::json j = connection;
-
   auto msg = std::make_shared<mqtt::message>();
   msg->set_topic(this->connection_topic_);
-  msg->set_payload(j.dump());
-  msg->set_qos(this->k_qos);
+  msg->set_payload(encodePayload(connection));
+  msg->set_qos(this->qos_.connection);
   msg->set_retained(true);
-  this->mqtt_client_->publish(msg);
+  this->publish({std::move(msg), k_connection_slot, std::chrono::steady_clock::now()});
 }
 
-void MqttModule::sendFactsheet(const vda5050::AgvFactsheet &factsheet) const {
-  if (this->state_ != State::k_online) {
-    throw vda5050pp::VDA5050PPMqttError(MK_EX_CONTEXT("MqttModule is not online."));
-  }
-
+void MqttModule::sendFactsheet(const vda5050::AgvFactsheet &factsheet,
+                               std::chrono::steady_clock::time_point created) const {
   getMqttLogger()->debug("sendFactsheet(headerId={})", factsheet.header.headerId);
 
-  vda5050::json j = factsheet;
-
   auto msg = std::make_shared<mqtt::message>();
   msg->set_topic(this->factsheet_topic_);
-  msg->set_payload(j.dump());
-  msg->set_qos(this->k_qos);
+  msg->set_payload(encodePayload(factsheet));
+  msg->set_qos(this->qos_.factsheet);
   msg->set_retained(true);
-  this->mqtt_client_->publish(msg);
+  this->publish({std::move(msg), k_factsheet_slot, created});
 }
 
 void MqttModule::initialize(vda5050pp::core::Instance &instance) {
+  this->instance_ = &instance;
   const auto &desc = instance.getConfig().getAgvDescription();
 
   this->connection_seq_id_ = 0;
@@ -304,9 +490,19 @@ void MqttModule::initialize(vda5050pp::core::Instance &instance) {
   this->state_seq_id_ = 0;
   this->visualization_seq_id_ = 0;
 
-  this->useMqttOptions(instance.getConfig().getMqttSubConfig().getOptions());
+  const auto &mqtt_opts = instance.getConfig().getMqttSubConfig().getOptions();
+  this->useMqttOptions(mqtt_opts);
+  this->decode_stage_ = std::make_unique<DecodeStage>(mqtt_opts.decode_workers, k_lanes);
+  std::optional<std::chrono::steady_clock::duration> offline_max_age;
+  if (mqtt_opts.offline_max_age_.has_value()) {
+    offline_max_age = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        *mqtt_opts.offline_max_age_);
+  }
+  this->outbound_buffer_.configure(mqtt_opts.offline_buffering, offline_max_age);
+  this->outbound_buffer_.goOffline();
   this->manufacturer_ = desc.manufacturer;
   this->serial_number_ = desc.serial_number;
+  this->protocol_limits_ = desc.simple_protocol_limits;
 
   auto fill_topic = [&desc](auto &str, auto &topic) {
     str = fmt::format("{}/{}/{}/{}", str, desc.manufacturer, desc.serial_number, topic);
@@ -319,11 +515,43 @@ void MqttModule::initialize(vda5050pp::core::Instance &instance) {
   fill_topic(this->state_topic_, "state");
   fill_topic(this->visualization_topic_, "visualization");
 
-  this->connect_opts_.set_will(this->getWill());
+  // A shared connection has only one last will, so there is none for a single AGV
+  if (!this->shared_connection_) {
+    this->connect_opts_.set_will(this->getWill());
+  }
+
+  this->topic_alias_maximum_ = 0;
+  this->topic_aliases_.clear();
+  if (this->use_topic_aliases_) {
+    this->topic_aliases_.push_back({this->state_topic_, k_state_topic_alias});
+    this->topic_aliases_.push_back({this->visualization_topic_, k_visualization_topic_alias});
+  }
+
+  mqtt::create_options create_opts(this->mqtt_version_);
+  if (this->max_buffered_messages_) {
+    // Never block or reject a publish, when the queue is full
+    create_opts.set_send_while_disconnected(true);
+    create_opts.set_max_buffered_messages(*this->max_buffered_messages_);
+    create_opts.set_delete_oldest_messages(true);
+  }
 
-  auto client_id = fmt::format("libvda5050++(agv_id={})", desc.agv_id);
-  this->mqtt_client_ = std::make_unique<mqtt::async_client>(this->server_, client_id);
-  this->mqtt_client_->set_callback(*this);
+  if (this->custom_transport_ != nullptr) {
+    this->attachTransport(this->custom_transport_);
+  } else if (this->shared_connection_) {
+    // The first instance creates the connection, all others only attach to it
+    auto key = fmt::format("{}|{}|{}", this->server_, mqtt_opts.username.value_or(""),
+                           this->mqtt_version_);
+    auto connection = SharedConnection::acquire(key, [this, &desc, &create_opts] {
+      auto client_id = fmt::format("libvda5050++(shared, agv_id={})", desc.agv_id);
+      return std::make_shared<PahoTransport>(this->server_, client_id, create_opts,
+                                             this->persistence_dir_, this->connect_opts_);
+    });
+    this->attachTransport(connection->attach());
+  } else {
+    auto client_id = fmt::format("libvda5050++(agv_id={})", desc.agv_id);
+    this->attachTransport(std::make_shared<PahoTransport>(
+        this->server_, client_id, create_opts, this->persistence_dir_, this->connect_opts_));
+  }
 
   this->m_subscriber_ = instance.getMessageEventManager().getScopedSubscriber();
   this->m_subscriber_->subscribe<vda5050pp::core::events::SendFactsheetMessageEvent>(
@@ -333,7 +561,7 @@ void MqttModule::initialize(vda5050pp::core::Instance &instance) {
         }
         this->fillHeaderFactsheet(evt_ptr->factsheet->header);
         try {
-          this->sendFactsheet(*evt_ptr->factsheet);
+          this->sendFactsheet(*evt_ptr->factsheet, evt_ptr->created);
         } catch (vda5050pp::VDA5050PPError &e) {
           getMessagesLogger()->warn("Could not send Factsheet: {}", e);
         }
@@ -345,7 +573,7 @@ void MqttModule::initialize(vda5050pp::core::Instance &instance) {
         }
         this->fillHeaderState(evt_ptr->state->header);
         try {
-          this->sendState(*evt_ptr->state);
+          this->sendState(*evt_ptr->state, evt_ptr->revisions, evt_ptr->created);
         } catch (vda5050pp::VDA5050PPError &e) {
           getMessagesLogger()->warn("Could not send State: {}", e);
         }
@@ -357,7 +585,7 @@ void MqttModule::initialize(vda5050pp::core::Instance &instance) {
         }
         this->fillHeaderVisualization(evt_ptr->visualization->header);
         try {
-          this->sendVisualization(*evt_ptr->visualization);
+          this->sendVisualization(*evt_ptr->visualization, evt_ptr->created);
         } catch (vda5050pp::VDA5050PPError &e) {
           getMessagesLogger()->warn("Could not send Visualization: {}", e);
         }
@@ -382,8 +610,21 @@ void MqttModule::initialize(vda5050pp::core::Instance &instance) {
 void MqttModule::deinitialize(vda5050pp::core::Instance &) {
   this->m_subscriber_.reset();
   this->c_subscriber_.reset();
-  this->mqtt_client_.reset();
+  this->transport_.reset();
+  this->publish_tracker_.clear();
+  this->decode_stage_.reset();
+  this->outbound_buffer_.clear();
   this->state_ = State::k_constructed;
+  this->instance_ = nullptr;
+}
+
+vda5050pp::misc::OutboundBufferStatistics MqttModule::getOutboundBufferStatistics() const noexcept(
+    true) {
+  return this->outbound_buffer_.statistics();
+}
+
+std::vector<vda5050pp::observer::PublishStatistics> MqttModule::getPublishStatistics() const {
+  return this->publish_tracker_.snapshot();
 }
 
 std::string_view MqttModule::describe() const { return "MqttModule"; }
@@ -0,0 +1,63 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+
+#include "vda5050++/core/messages/paho_transport.h"
+
+#include "vda5050++/core/common/exception.h"
+
+using namespace vda5050pp::core::messages;
+
+void PahoTransport::PublishListener::on_failure(const mqtt::token &tkn) {
+  if (this->completion) {
+    this->completion(tkn.get_user_context(), false);
+  }
+}
+
+void PahoTransport::PublishListener::on_success(const mqtt::token &tkn) {
+  if (this->completion) {
+    this->completion(tkn.get_user_context(), true);
+  }
+}
+
+PahoTransport::PahoTransport(const std::string &server, const std::string &client_id,
+                             const mqtt::create_options &create_opts,
+                             const std::optional<std::string> &persistence_dir,
+                             const mqtt::connect_options &connect_opts)
+    : connect_opts_(connect_opts) {
+  if (persistence_dir) {
+    this->client_ =
+        std::make_unique<mqtt::async_client>(server, client_id, create_opts, *persistence_dir);
+  } else {
+    // Without a persistence directory, paho keeps unacknowledged messages in memory
+    this->client_ = std::make_unique<mqtt::async_client>(server, client_id, create_opts);
+  }
+}
+
+void PahoTransport::setCallbacks(mqtt::callback &callback,
+                                 mqtt::iaction_listener &connect_listener,
+                                 PublishCompletion completion) {
+  this->client_->set_callback(callback);
+  this->connect_listener_ = &connect_listener;
+  this->publish_listener_.completion = std::move(completion);
+}
+
+void PahoTransport::connect() {
+  if (this->connect_listener_ == nullptr) {
+    throw vda5050pp::VDA5050PPMqttError(MK_EX_CONTEXT("PahoTransport has no callbacks"));
+  }
+  this->client_->connect(this->connect_opts_, nullptr, *this->connect_listener_);
+}
+
+void PahoTransport::disconnect() { this->client_->disconnect()->wait(); }
+
+void PahoTransport::subscribe(const std::string &topic, int qos) {
+  this->client_->subscribe(topic, qos);
+}
+
+void PahoTransport::publish(mqtt::const_message_ptr msg, void *context) {
+  this->client_->publish(std::move(msg), context, this->publish_listener_);
+}
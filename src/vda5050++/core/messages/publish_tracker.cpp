@@ -0,0 +1,100 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+
+#include "vda5050++/core/messages/publish_tracker.h"
+
+#include <spdlog/fmt/fmt.h>
+
+#include "vda5050++/core/common/exception.h"
+
+using namespace vda5050pp::core::messages;
+
+PublishTracker::PublishTracker(const std::vector<std::string> &topic_names) {
+  for (const auto &name : topic_names) {
+    auto topic = std::make_unique<Topic>();
+    topic->name = name;
+    this->topics_.push_back(std::move(topic));
+  }
+}
+
+void PublishTracker::finish(const Context &context, bool delivered) noexcept(true) {
+  auto &topic = *this->topics_[context.topic];
+  if (delivered) {
+    topic.delivered++;
+    topic.publish_to_delivery.record(Clock::now() - context.published);
+  } else {
+    topic.failed++;
+  }
+  topic.in_flight--;
+  topic.buffered_bytes -= context.bytes;
+}
+
+PublishTracker::Context *PublishTracker::beginPublish(std::size_t topic, std::size_t bytes,
+                                                      Clock::time_point created) {
+  if (topic >= this->topics_.size()) {
+    throw vda5050pp::VDA5050PPInvalidArgument(
+        MK_EX_CONTEXT(fmt::format("Topic {} is not tracked", topic)));
+  }
+
+  auto context = std::make_unique<Context>();
+  context->topic = topic;
+  context->bytes = bytes;
+  context->published = Clock::now();
+
+  auto &t = *this->topics_[topic];
+  t.published++;
+  t.in_flight++;
+  t.buffered_bytes += bytes;
+  t.event_to_publish.record(context->published - created);
+
+  std::unique_lock lock(this->pending_mutex_);
+  auto ptr = context.get();
+  this->pending_.emplace(ptr, std::move(context));
+  return ptr;
+}
+
+void PublishTracker::endPublish(const void *context, bool delivered) noexcept(true) {
+  std::unique_ptr<Context> finished;
+  {
+    std::unique_lock lock(this->pending_mutex_);
+    auto it = this->pending_.find(static_cast<const Context *>(context));
+    if (it == this->pending_.end()) {
+      return;
+    }
+    finished = std::move(it->second);
+    this->pending_.erase(it);
+  }
+  this->finish(*finished, delivered);
+}
+
+void PublishTracker::clear() noexcept(true) {
+  std::unique_lock lock(this->pending_mutex_);
+  for (const auto &[_, context] : this->pending_) {
+    this->finish(*context, false);
+  }
+  this->pending_.clear();
+}
+
+std::vector<vda5050pp::observer::PublishStatistics> PublishTracker::snapshot() const {
+  std::vector<vda5050pp::observer::PublishStatistics> ret;
+  ret.reserve(this->topics_.size());
+
+  for (const auto &topic : this->topics_) {
+    vda5050pp::observer::PublishStatistics stats;
+    stats.topic = topic->name;
+    stats.published = topic->published;
+    stats.delivered = topic->delivered;
+    stats.failed = topic->failed;
+    stats.in_flight = topic->in_flight;
+    stats.buffered_bytes = topic->buffered_bytes;
+    stats.event_to_publish = topic->event_to_publish.snapshot();
+    stats.publish_to_delivery = topic->publish_to_delivery.snapshot();
+    ret.push_back(std::move(stats));
+  }
+
+  return ret;
+}
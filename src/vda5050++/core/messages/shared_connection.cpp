@@ -0,0 +1,335 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+
+#include "vda5050++/core/messages/shared_connection.h"
+
+#include <spdlog/fmt/fmt.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "vda5050++/core/common/exception.h"
+#include "vda5050++/core/logger.h"
+
+using namespace vda5050pp::core::messages;
+
+std::mutex SharedConnection::registry_mutex_;
+std::map<std::string, std::weak_ptr<SharedConnection>, std::less<>> SharedConnection::registry_;
+
+SharedConnection::Endpoint::Endpoint(std::shared_ptr<SharedConnection> connection) noexcept(true)
+    : connection_(std::move(connection)) {}
+
+SharedConnection::Endpoint::~Endpoint() {
+  if (this->connection_ != nullptr) {
+    this->connection_->detach(*this);
+  }
+}
+
+void SharedConnection::Endpoint::setCallbacks(mqtt::callback &callback,
+                                              mqtt::iaction_listener &connect_listener,
+                                              PublishCompletion completion) {
+  this->callback_ = &callback;
+  this->connect_listener_ = &connect_listener;
+  this->completion_ = std::move(completion);
+}
+
+void SharedConnection::Endpoint::connect() {
+  if (this->callback_ == nullptr) {
+    throw vda5050pp::VDA5050PPMqttError(
+        MK_EX_CONTEXT("SharedConnection::Endpoint has no callbacks"));
+  }
+  this->connection_->connect(*this);
+}
+
+void SharedConnection::Endpoint::disconnect() { this->connection_->disconnect(*this); }
+
+void SharedConnection::Endpoint::subscribe(const std::string &topic, int qos) {
+  this->connection_->subscribe(*this, topic, qos);
+}
+
+void SharedConnection::Endpoint::publish(mqtt::const_message_ptr msg, void *context) {
+  this->connection_->publish(*this, std::move(msg), context);
+}
+
+SharedConnection::SharedConnection(std::shared_ptr<Transport> transport)
+    : transport_(std::move(transport)) {
+  if (this->transport_ == nullptr) {
+    throw vda5050pp::VDA5050PPNullPointer(MK_EX_CONTEXT("SharedConnection needs a transport"));
+  }
+  this->transport_->setCallbacks(*this, *this, [this](void *context, bool delivered) {
+    this->completePublish(context, delivered);
+  });
+}
+
+std::shared_ptr<SharedConnection> SharedConnection::acquire(std::string_view key,
+                                                            const TransportFactory &factory) {
+  std::unique_lock lock(SharedConnection::registry_mutex_);
+
+  if (auto it = SharedConnection::registry_.find(key); it != SharedConnection::registry_.end()) {
+    if (auto connection = it->second.lock(); connection != nullptr) {
+      return connection;
+    }
+  }
+
+  auto connection = std::make_shared<SharedConnection>(factory());
+  SharedConnection::registry_.insert_or_assign(std::string(key), connection);
+  return connection;
+}
+
+std::string SharedConnection::wildcardOf(std::string_view topic) {
+  auto last = topic.rfind('/');
+  auto serial = last == std::string_view::npos || last == 0 ? std::string_view::npos
+                                                             : topic.rfind('/', last - 1);
+  if (serial == std::string_view::npos) {
+    throw vda5050pp::VDA5050PPInvalidArgument(MK_FN_EX_CONTEXT(
+        fmt::format("Topic \"{}\" has no serial number level, it cannot be shared", topic)));
+  }
+
+  return fmt::format("{}+{}", topic.substr(0, serial + 1), topic.substr(last));
+}
+
+std::shared_ptr<Transport> SharedConnection::attach() {
+  return std::make_shared<Endpoint>(this->shared_from_this());
+}
+
+void SharedConnection::detach(Endpoint &endpoint) noexcept(true) {
+  bool last = false;
+  {
+    std::unique_lock lock(this->mutex_);
+    this->connected_.erase(&endpoint);
+    // The detached endpoint is expired already, drop all of its routes and publishes
+    auto expired = [](const auto &entry) { return entry.second.expired(); };
+    for (auto it = this->routes_.begin(); it != this->routes_.end();) {
+      it = expired(*it) ? this->routes_.erase(it) : std::next(it);
+    }
+    for (auto it = this->pending_publishes_.begin(); it != this->pending_publishes_.end();) {
+      it = expired(*it) ? this->pending_publishes_.erase(it) : std::next(it);
+    }
+    if (this->connected_.empty() && this->state_ != State::k_disconnected) {
+      this->state_ = State::k_disconnected;
+      last = true;
+    }
+  }
+
+  if (last) {
+    try {
+      this->transport_->disconnect();
+    } catch (const std::exception &e) {
+      getMqttLogger()->warn("SharedConnection: could not disconnect ({})", e.what());
+    }
+  }
+}
+
+void SharedConnection::connect(Endpoint &endpoint) {
+  bool start = false;
+  bool is_connected = false;
+  {
+    std::unique_lock lock(this->mutex_);
+    this->connected_.insert_or_assign(&endpoint, endpoint.weak_from_this());
+    if (this->state_ == State::k_disconnected) {
+      this->state_ = State::k_connecting;
+      start = true;
+    } else {
+      // Otherwise the endpoint is notified, once the (re)connect is done
+      is_connected = this->state_ == State::k_connected;
+    }
+  }
+
+  if (start) {
+    getMqttLogger()->info("SharedConnection: connecting");
+    try {
+      this->transport_->connect();
+    } catch (...) {
+      std::unique_lock lock(this->mutex_);
+      this->state_ = State::k_disconnected;
+      throw;
+    }
+  } else if (is_connected) {
+    // The others are online already, so the endpoint is connected immediately
+    endpoint.callback_->connected("shared connection");
+  }
+}
+
+void SharedConnection::disconnect(Endpoint &endpoint) {
+  bool last = false;
+  {
+    std::unique_lock lock(this->mutex_);
+    this->connected_.erase(&endpoint);
+    if (this->connected_.empty() && this->state_ != State::k_disconnected) {
+      this->state_ = State::k_disconnected;
+      last = true;
+    }
+  }
+
+  if (last) {
+    getMqttLogger()->info("SharedConnection: disconnecting, the last endpoint disconnected");
+    this->transport_->disconnect();
+  }
+}
+
+void SharedConnection::subscribe(Endpoint &endpoint, const std::string &topic, int qos) {
+  auto wildcard = SharedConnection::wildcardOf(topic);
+  bool subscribe_now = false;
+  {
+    std::unique_lock lock(this->mutex_);
+    this->routes_.insert_or_assign(topic, endpoint.weak_from_this());
+
+    auto [it, inserted] = this->subscriptions_.try_emplace(wildcard, qos);
+    if (!inserted && qos > it->second) {
+      // One subscription for all endpoints, it has the highest QoS of all of them
+      it->second = qos;
+      inserted = true;
+    }
+    subscribe_now = inserted && this->state_ == State::k_connected;
+  }
+
+  if (subscribe_now) {
+    this->transport_->subscribe(wildcard, qos);
+  }
+}
+
+void SharedConnection::publish(Endpoint &endpoint, mqtt::const_message_ptr msg, void *context) {
+  if (context != nullptr) {
+    std::unique_lock lock(this->mutex_);
+    this->pending_publishes_.insert_or_assign(context, endpoint.weak_from_this());
+  }
+
+  try {
+    this->transport_->publish(std::move(msg), context);
+  } catch (...) {
+    if (context != nullptr) {
+      std::unique_lock lock(this->mutex_);
+      this->pending_publishes_.erase(context);
+    }
+    throw;
+  }
+}
+
+void SharedConnection::completePublish(void *context, bool delivered) {
+  std::shared_ptr<Endpoint> endpoint;
+  {
+    std::unique_lock lock(this->mutex_);
+    auto it = this->pending_publishes_.find(context);
+    if (it == this->pending_publishes_.end()) {
+      return;
+    }
+    endpoint = it->second.lock();
+    this->pending_publishes_.erase(it);
+  }
+
+  if (endpoint != nullptr && endpoint->completion_) {
+    endpoint->completion_(context, delivered);
+  }
+}
+
+void SharedConnection::forEachConnected(const std::function<void(Endpoint &)> &fn) {
+  // Keep this connection alive, the endpoints might be released meanwhile
+  auto self = this->weak_from_this().lock();
+  if (self == nullptr) {
+    return;
+  }
+
+  std::vector<std::shared_ptr<Endpoint>> endpoints;
+  {
+    std::unique_lock lock(this->mutex_);
+    endpoints = this->connectedEndpoints();
+  }
+
+  // Never call back while holding the lock, the callbacks subscribe and publish
+  for (const auto &endpoint : endpoints) {
+    fn(*endpoint);
+  }
+}
+
+std::vector<std::shared_ptr<SharedConnection::Endpoint>> SharedConnection::connectedEndpoints()
+    const {
+  std::vector<std::shared_ptr<Endpoint>> endpoints;
+  endpoints.reserve(this->connected_.size());
+  for (const auto &[_, ref] : this->connected_) {
+    if (auto endpoint = ref.lock(); endpoint != nullptr) {
+      endpoints.push_back(std::move(endpoint));
+    }
+  }
+  return endpoints;
+}
+
+void SharedConnection::on_failure(const mqtt::token &tkn) {
+  this->forEachConnected(
+      [&tkn](Endpoint &endpoint) { endpoint.connect_listener_->on_failure(tkn); });
+}
+
+void SharedConnection::on_success(const mqtt::token &tkn) {
+  this->forEachConnected(
+      [&tkn](Endpoint &endpoint) { endpoint.connect_listener_->on_success(tkn); });
+}
+
+void SharedConnection::connected(const std::string &cause) {
+  // Keep this connection alive, the endpoints might be released meanwhile
+  auto self = this->weak_from_this().lock();
+  if (self == nullptr) {
+    return;
+  }
+
+  std::map<std::string, int, std::less<>> subscriptions;
+  std::vector<std::shared_ptr<Endpoint>> endpoints;
+  {
+    std::unique_lock lock(this->mutex_);
+    this->state_ = State::k_connected;
+    subscriptions = this->subscriptions_;
+    // Taken with the state change, endpoints connecting from now on are notified by connect()
+    endpoints = this->connectedEndpoints();
+  }
+
+  for (const auto &[wildcard, qos] : subscriptions) {
+    this->transport_->subscribe(wildcard, qos);
+  }
+  getMqttLogger()->info("SharedConnection: online");
+
+  for (const auto &endpoint : endpoints) {
+    endpoint->callback_->connected(cause);
+  }
+}
+
+void SharedConnection::connection_lost(const std::string &cause) {
+  {
+    std::unique_lock lock(this->mutex_);
+    // The transport is still open and reconnects, it must neither be connected again nor left
+    // open, when the last endpoint disconnects
+    if (this->state_ != State::k_disconnected) {
+      this->state_ = State::k_reconnecting;
+    }
+  }
+  getMqttLogger()->warn("SharedConnection: connection lost ({})", cause);
+
+  this->forEachConnected(
+      [&cause](Endpoint &endpoint) { endpoint.callback_->connection_lost(cause); });
+}
+
+void SharedConnection::message_arrived(mqtt::const_message_ptr msg) {
+  std::shared_ptr<Endpoint> endpoint;
+  {
+    std::unique_lock lock(this->mutex_);
+    if (auto it = this->routes_.find(msg->get_topic()); it != this->routes_.end()) {
+      endpoint = it->second.lock();
+    }
+    if (endpoint != nullptr && this->connected_.count(endpoint.get()) == 0) {
+      endpoint.reset();
+    }
+  }
+
+  if (endpoint == nullptr) {
+    // The wildcard subscription also covers AGVs, which are not running in this process
+    getMqttLogger()->trace("SharedConnection: no endpoint for topic \"{}\"", msg->get_topic());
+    return;
+  }
+  endpoint->callback_->message_arrived(std::move(msg));
+}
+
+void SharedConnection::delivery_complete(mqtt::delivery_token_ptr /*tok*/) {
+  // Completed publishes are reported to the PublishCompletion
+}
@@ -8,14 +8,12 @@
 
 #include <eventpp/utilities/argumentadapter.h>
 
-#include <chrono>
-
+#include "vda5050++/core/common/event_processing.h"
 #include "vda5050++/core/common/exception.h"
 #include "vda5050++/core/common/formatters.h"
 #include "vda5050++/core/logger.h"
 
 using namespace vda5050pp::core;
-using namespace std::chrono_literals;
 
 ScopedNavigationEventSubscriber::ScopedNavigationEventSubscriber(NavigationEventQueue &queue)
     : remover_(queue) {}
@@ -65,30 +63,22 @@ void ScopedNavigationEventSubscriber::subscribe(
           std::move(callback)));
 }
 
-NavigationEventManager::NavigationEventManager(const vda5050pp::config::EventManagerOptions &opts)
-    : opts_(opts),
-      thread_(std::bind(std::mem_fn(&NavigationEventManager::threadTask), this,
-                        std::placeholders::_1)) {}
-
-void NavigationEventManager::threadTask(vda5050pp::core::common::StopToken tkn) noexcept(true) {
-  if (this->opts_.synchronous_event_dispatch) {
-    // This event loop is not needed
-    return;
-  }
+NavigationEventManager::NavigationEventManager(
+    const vda5050pp::config::EventManagerOptions &opts,
+    std::shared_ptr<vda5050pp::core::common::WorkerPool> worker_pool, Instance *instance)
+    : statistics_recorder_("NavigationEventManager"),
+      opts_(opts),
+      processor_([this] { this->processQueue(); }, opts, worker_pool, instance) {
+  vda5050pp::core::common::setStatisticsRecorder(this->navigation_event_queue_,
+                                                 &this->statistics_recorder_);
+  vda5050pp::core::common::setQueueLimit(
+      this->navigation_event_queue_,
+      opts.getQueueLimit(this->statistics_recorder_.getManagerName()));
+}
 
-  try {
-    while (!tkn.stopRequested()) {
-      if (this->navigation_event_queue_.processUntil([&tkn] { return tkn.stopRequested(); })) {
-        // no pause
-      } else {
-        std::this_thread::sleep_for(10ms);
-      }
-    }
-  } catch (const vda5050pp::VDA5050PPError &err) {
-    getEventsLogger()->error(
-        "NavigationEventManager caught an exception, while processing events:\n {}", err);
-    // TODO: Handle critical exceptions
-  }
+void NavigationEventManager::processQueue() noexcept(true) {
+  vda5050pp::core::common::processEvents(
+      [this] { return this->navigation_event_queue_.processOne(); }, "NavigationEventManager");
 }
 
 void NavigationEventManager::dispatch(
@@ -99,6 +89,7 @@ void NavigationEventManager::dispatch(
   } else {
     this->navigation_event_queue_.enqueue(vda5050pp::events::NavigationEventType::k_horizon_update,
                                           data);
+    this->processor_.notify();
   }
 }
 
@@ -110,6 +101,7 @@ void NavigationEventManager::dispatch(
   } else {
     this->navigation_event_queue_.enqueue(vda5050pp::events::NavigationEventType::k_base_increased,
                                           data);
+    this->processor_.notify();
   }
 }
 
@@ -121,6 +113,7 @@ void NavigationEventManager::dispatch(
   } else {
     this->navigation_event_queue_.enqueue(vda5050pp::events::NavigationEventType::k_next_node,
                                           data);
+    this->processor_.notify();
   }
 }
 
@@ -132,6 +125,7 @@ void NavigationEventManager::dispatch(
   } else {
     this->navigation_event_queue_.enqueue(
         vda5050pp::events::NavigationEventType::k_upcoming_segment, data);
+    this->processor_.notify();
   }
 }
 
@@ -141,10 +135,16 @@ void NavigationEventManager::dispatch(
     this->navigation_event_queue_.dispatch(vda5050pp::events::NavigationEventType::k_control, data);
   } else {
     this->navigation_event_queue_.enqueue(vda5050pp::events::NavigationEventType::k_control, data);
+    this->processor_.notify();
   }
 }
 
 ScopedNavigationEventSubscriber
 NavigationEventManager::getScopedNavigationEventSubscriber() noexcept(true) {
   return ScopedNavigationEventSubscriber(this->navigation_event_queue_);
-}
\ No newline at end of file
+}
+
+const vda5050pp::core::common::EventStatisticsRecorder &
+NavigationEventManager::getStatisticsRecorder() const noexcept(true) {
+  return this->statistics_recorder_;
+}
@@ -8,22 +8,23 @@
 
 #include <eventpp/utilities/argumentadapter.h>
 
-#include <chrono>
+#include <utility>
 
+#include "vda5050++/core/common/event_processing.h"
 #include "vda5050++/core/common/exception.h"
 #include "vda5050++/core/common/formatters.h"
 #include "vda5050++/core/logger.h"
 
 using namespace vda5050pp::core;
-using namespace std::chrono_literals;
 
-ScopedNavigationStatusSubscriber::ScopedNavigationStatusSubscriber(NavigationStatusQueue &queue)
-    : remover_(queue) {}
+ScopedNavigationStatusSubscriber::ScopedNavigationStatusSubscriber(
+    NavigationStatusQueue &queue, NavigationStatusLatestValueDispatcher &latest_value_dispatcher)
+    : remover_(queue), latest_value_remover_(latest_value_dispatcher) {}
 
 void ScopedNavigationStatusSubscriber::subscribe(
     std::function<void(std::shared_ptr<vda5050pp::events::NavigationStatusPosition>)>
         &&callback) noexcept(true) {
-  this->remover_.appendListener(
+  this->latest_value_remover_.appendListener(
       vda5050pp::events::NavigationStatusType::k_position,
       eventpp::argumentAdapter<void(std::shared_ptr<vda5050pp::events::NavigationStatusPosition>)>(
           std::move(callback)));
@@ -32,7 +33,7 @@ void ScopedNavigationStatusSubscriber::subscribe(
 void ScopedNavigationStatusSubscriber::subscribe(
     std::function<void(std::shared_ptr<vda5050pp::events::NavigationStatusVelocity>)>
         &&callback) noexcept(true) {
-  this->remover_.appendListener(
+  this->latest_value_remover_.appendListener(
       vda5050pp::events::NavigationStatusType::k_velocity,
       eventpp::argumentAdapter<void(std::shared_ptr<vda5050pp::events::NavigationStatusVelocity>)>(
           std::move(callback)));
@@ -75,40 +76,116 @@ void ScopedNavigationStatusSubscriber::subscribe(
           std::move(callback)));
 }
 
-NavigationStatusManager::NavigationStatusManager(const vda5050pp::config::EventManagerOptions &opts)
-    : opts_(opts),
-      thread_(std::bind(std::mem_fn(&NavigationStatusManager::threadTask), this,
-                        std::placeholders::_1)) {}
+NavigationStatusManager::NavigationStatusManager(
+    const vda5050pp::config::EventManagerOptions &opts,
+    std::shared_ptr<vda5050pp::core::common::WorkerPool> worker_pool, Instance *instance)
+    : statistics_recorder_("NavigationStatusManager"),
+      opts_(opts),
+      processor_([this] { this->processQueue(); }, opts, worker_pool, instance) {
+  vda5050pp::core::common::setStatisticsRecorder(this->navigation_status_queue_,
+                                                 &this->statistics_recorder_);
+  vda5050pp::core::common::setQueueLimit(
+      this->navigation_status_queue_,
+      opts.getQueueLimit(this->statistics_recorder_.getManagerName()));
+  vda5050pp::core::common::setDropHandler(
+      this->navigation_status_queue_,
+      std::function<void(vda5050pp::events::NavigationStatusType,
+                         std::shared_ptr<vda5050pp::events::NavigationStatus> &)>(
+          [this](auto type, auto &) { this->onDropped(type); }));
 
-void NavigationStatusManager::threadTask(vda5050pp::core::common::StopToken tkn) noexcept(true) {
-  if (this->opts_.synchronous_event_dispatch) {
-    // This event loop is not needed
+  // Position and velocity subscribers are served by the latest_value_dispatcher_. When coalescing,
+  // the queue only carries a wakeup and the latest value is taken from the pending slot.
+  this->navigation_status_queue_.appendListener(
+      vda5050pp::events::NavigationStatusType::k_position,
+      [this](std::shared_ptr<vda5050pp::events::NavigationStatus> data) {
+        if (this->coalescing()) {
+          std::unique_lock lock(this->latest_value_mutex_);
+          data = std::exchange(this->pending_position_, nullptr);
+        }
+        if (data != nullptr) {
+          this->latest_value_dispatcher_.dispatch(
+              vda5050pp::events::NavigationStatusType::k_position, data);
+        }
+      });
+  this->navigation_status_queue_.appendListener(
+      vda5050pp::events::NavigationStatusType::k_velocity,
+      [this](std::shared_ptr<vda5050pp::events::NavigationStatus> data) {
+        if (this->coalescing()) {
+          std::unique_lock lock(this->latest_value_mutex_);
+          data = std::exchange(this->pending_velocity_, nullptr);
+        }
+        if (data != nullptr) {
+          this->latest_value_dispatcher_.dispatch(
+              vda5050pp::events::NavigationStatusType::k_velocity, data);
+        }
+      });
+}
+
+bool NavigationStatusManager::coalescing() const noexcept(true) {
+  return this->opts_.coalesce_navigation_status && !this->opts_.synchronous_event_dispatch;
+}
+
+void NavigationStatusManager::onDropped(vda5050pp::events::NavigationStatusType type) noexcept(
+    true) {
+  if (!this->coalescing()) {
     return;
   }
 
-  try {
-    while (!tkn.stopRequested()) {
-      if (this->navigation_status_queue_.processUntil([&tkn] { return tkn.stopRequested(); })) {
-        // no pause
-      } else {
-        std::this_thread::sleep_for(10ms);
-      }
+  // The wakeup of a pending slot was dropped by the queue limit. Drop the pending sample as well,
+  // otherwise the slot never gets a new wakeup.
+  std::shared_ptr<vda5050pp::events::NavigationStatusPosition> position;
+  {
+    std::unique_lock lock(this->latest_value_mutex_);
+    if (type == vda5050pp::events::NavigationStatusType::k_position) {
+      position = std::exchange(this->pending_position_, nullptr);
+    } else if (type == vda5050pp::events::NavigationStatusType::k_velocity) {
+      this->pending_velocity_ = nullptr;
+    }
+  }
+
+  if (position != nullptr && position->auto_check_node_reached) {
+    if (auto token = position->acquireResultToken(); token) {
+      token.setValue(false);
     }
-  } catch (const vda5050pp::VDA5050PPError &err) {
-    getEventsLogger()->error(
-        "NavigationStatusManager caught an exception, while processing events:\n {}", err);
-    // TODO: Handle critical exceptions
   }
 }
 
+void NavigationStatusManager::processQueue() noexcept(true) {
+  vda5050pp::core::common::processEvents(
+      [this] { return this->navigation_status_queue_.processOne(); }, "NavigationStatusManager");
+}
+
 void NavigationStatusManager::dispatch(
     std::shared_ptr<vda5050pp::events::NavigationStatusPosition> data) noexcept(true) {
   if (this->opts_.synchronous_event_dispatch) {
     this->navigation_status_queue_.dispatch(vda5050pp::events::NavigationStatusType::k_position,
                                             data);
+  } else if (this->coalescing()) {
+    std::shared_ptr<vda5050pp::events::NavigationStatusPosition> superseded;
+    {
+      std::unique_lock lock(this->latest_value_mutex_);
+      if (this->pending_position_ != nullptr) {
+        // The newest sample checks for a reached node on behalf of the superseded one
+        data->auto_check_node_reached =
+            data->auto_check_node_reached || this->pending_position_->auto_check_node_reached;
+      }
+      superseded = std::exchange(this->pending_position_, data);
+    }
+
+    if (superseded == nullptr) {
+      this->navigation_status_queue_.enqueue(vda5050pp::events::NavigationStatusType::k_position,
+                                             data);
+      this->processor_.notify();
+    } else if (superseded->auto_check_node_reached) {
+      // The superseded sample was never checked, release its waiter
+      if (auto token = superseded->acquireResultToken(); token) {
+        token.setValue(false);
+      }
+    }
   } else {
     this->navigation_status_queue_.enqueue(vda5050pp::events::NavigationStatusType::k_position,
                                            data);
+    this->processor_.notify();
   }
 }
 
@@ -117,9 +194,22 @@ void NavigationStatusManager::dispatch(
   if (this->opts_.synchronous_event_dispatch) {
     this->navigation_status_queue_.dispatch(vda5050pp::events::NavigationStatusType::k_velocity,
                                             data);
+  } else if (this->coalescing()) {
+    bool wakeup;
+    {
+      std::unique_lock lock(this->latest_value_mutex_);
+      wakeup = std::exchange(this->pending_velocity_, data) == nullptr;
+    }
+
+    if (wakeup) {
+      this->navigation_status_queue_.enqueue(vda5050pp::events::NavigationStatusType::k_velocity,
+                                             data);
+      this->processor_.notify();
+    }
   } else {
     this->navigation_status_queue_.enqueue(vda5050pp::events::NavigationStatusType::k_velocity,
                                            data);
+    this->processor_.notify();
   }
 }
 
@@ -131,6 +221,7 @@ void NavigationStatusManager::dispatch(
   } else {
     this->navigation_status_queue_.enqueue(vda5050pp::events::NavigationStatusType::k_node_reached,
                                            data);
+    this->processor_.notify();
   }
 }
 
@@ -142,6 +233,7 @@ void NavigationStatusManager::dispatch(
   } else {
     this->navigation_status_queue_.enqueue(
         vda5050pp::events::NavigationStatusType::k_distance_since_last_node, data);
+    this->processor_.notify();
   }
 }
 
@@ -153,6 +245,7 @@ void NavigationStatusManager::dispatch(
   } else {
     this->navigation_status_queue_.enqueue(vda5050pp::events::NavigationStatusType::k_driving,
                                            data);
+    this->processor_.notify();
   }
 }
 
@@ -164,10 +257,17 @@ void NavigationStatusManager::dispatch(
   } else {
     this->navigation_status_queue_.enqueue(
         vda5050pp::events::NavigationStatusType::k_navigation_control_status, data);
+    this->processor_.notify();
   }
 }
 
 ScopedNavigationStatusSubscriber
 NavigationStatusManager::getScopedNavigationStatusSubscriber() noexcept(true) {
-  return ScopedNavigationStatusSubscriber(this->navigation_status_queue_);
+  return ScopedNavigationStatusSubscriber(this->navigation_status_queue_,
+                                          this->latest_value_dispatcher_);
+}
+
+const vda5050pp::core::common::EventStatisticsRecorder &
+NavigationStatusManager::getStatisticsRecorder() const noexcept(true) {
+  return this->statistics_recorder_;
 }
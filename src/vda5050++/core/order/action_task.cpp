@@ -9,6 +9,7 @@
 #include "spdlog/fmt/fmt.h"
 #include "vda5050++/core/common/exception.h"
 #include "vda5050++/core/logger.h"
+#include "vda5050++/misc/pool_allocator.h"
 
 using namespace vda5050pp::core::order;
 
@@ -89,10 +90,10 @@ std::unique_ptr<ActionState> ActionInitializing::transition(const ActionTransiti
   }
 }
 void ActionInitializing::effect() {
-  auto evt_a = std::make_shared<vda5050pp::events::ActionStart>();
+  auto evt_a = vda5050pp::misc::makePooled<vda5050pp::events::ActionStart>();
   evt_a->action_id = this->task().getAction().actionId;
 
-  auto evt_s = std::make_shared<vda5050pp::core::events::OrderActionStatusChanged>();
+  auto evt_s = vda5050pp::misc::makePooled<vda5050pp::core::events::OrderActionStatusChanged>();
   evt_s->action_id = this->task().getAction().actionId;
   evt_s->action_status = vda5050::ActionStatus::INITIALIZING;
 
@@ -148,7 +149,7 @@ std::unique_ptr<ActionState> ActionRunning::transition(const ActionTransition &t
   }
 }
 void ActionRunning::effect() {
-  auto evt = std::make_shared<vda5050pp::core::events::OrderActionStatusChanged>();
+  auto evt = vda5050pp::misc::makePooled<vda5050pp::core::events::OrderActionStatusChanged>();
   evt->action_id = this->task().getAction().actionId;
   evt->action_status = vda5050::ActionStatus::RUNNING;
 
@@ -172,7 +173,7 @@ std::unique_ptr<ActionState> ActionPausing::transition(const ActionTransition &t
   }
 }
 void ActionPausing::effect() {
-  auto evt_a = std::make_shared<vda5050pp::events::ActionPause>();
+  auto evt_a = vda5050pp::misc::makePooled<vda5050pp::events::ActionPause>();
   evt_a->action_id = this->task().getAction().actionId;
 
   Instance::ref().getActionEventManager().dispatch(evt_a);
@@ -197,7 +198,7 @@ std::unique_ptr<ActionState> ActionResuming::transition(const ActionTransition &
   }
 }
 void ActionResuming::effect() {
-  auto evt_a = std::make_shared<vda5050pp::events::ActionResume>();
+  auto evt_a = vda5050pp::misc::makePooled<vda5050pp::events::ActionResume>();
   evt_a->action_id = this->task().getAction().actionId;
 
   Instance::ref().getActionEventManager().dispatch(evt_a);
@@ -224,7 +225,7 @@ std::unique_ptr<ActionState> ActionPaused::transition(const ActionTransition &tr
   }
 }
 void ActionPaused::effect() {
-  auto evt = std::make_shared<vda5050pp::core::events::OrderActionStatusChanged>();
+  auto evt = vda5050pp::misc::makePooled<vda5050pp::core::events::OrderActionStatusChanged>();
   evt->action_id = this->task().getAction().actionId;
   evt->action_status = vda5050::ActionStatus::PAUSED;
 
@@ -246,7 +247,7 @@ std::unique_ptr<ActionState> ActionCanceling::transition(const ActionTransition
   }
 }
 void ActionCanceling::effect() {
-  auto evt_a = std::make_shared<vda5050pp::events::ActionCancel>();
+  auto evt_a = vda5050pp::misc::makePooled<vda5050pp::events::ActionCancel>();
   evt_a->action_id = this->task().getAction().actionId;
 
   Instance::ref().getActionEventManager().dispatch(evt_a);
@@ -260,11 +261,11 @@ std::unique_ptr<ActionState> ActionFailed::transition(const ActionTransition &tr
       MK_EX_CONTEXT(fmt::format("Cannot {} during FAILED", transition)));
 }
 void ActionFailed::effect() {
-  auto s_evt = std::make_shared<vda5050pp::core::events::OrderActionStatusChanged>();
+  auto s_evt = vda5050pp::misc::makePooled<vda5050pp::core::events::OrderActionStatusChanged>();
   s_evt->action_id = this->task().getAction().actionId;
   s_evt->action_status = vda5050::ActionStatus::FAILED;
 
-  auto f_evt = std::make_shared<vda5050pp::events::ActionForget>();
+  auto f_evt = vda5050pp::misc::makePooled<vda5050pp::events::ActionForget>();
   f_evt->action_id = this->task().getAction().actionId;
 
   Instance::ref().getOrderEventManager().dispatch(s_evt);
@@ -280,12 +281,12 @@ std::unique_ptr<ActionState> ActionFinished::transition(const ActionTransition &
       MK_EX_CONTEXT(fmt::format("Cannot {} during FINISHED", transition)));
 }
 void ActionFinished::effect() {
-  auto s_evt = std::make_shared<vda5050pp::core::events::OrderActionStatusChanged>();
+  auto s_evt = vda5050pp::misc::makePooled<vda5050pp::core::events::OrderActionStatusChanged>();
   s_evt->action_id = this->task().getAction().actionId;
   s_evt->action_status = vda5050::ActionStatus::FINISHED;
   s_evt->result = this->result_;
 
-  auto f_evt = std::make_shared<vda5050pp::events::ActionForget>();
+  auto f_evt = vda5050pp::misc::makePooled<vda5050pp::events::ActionForget>();
   f_evt->action_id = this->task().getAction().actionId;
 
   Instance::ref().getOrderEventManager().dispatch(s_evt);
@@ -11,6 +11,7 @@
 #include "vda5050++/core/common/exception.h"
 #include "vda5050++/core/instance.h"
 #include "vda5050++/core/logger.h"
+#include "vda5050++/misc/pool_allocator.h"
 
 using namespace vda5050pp::core::order;
 
@@ -118,14 +119,15 @@ std::unique_ptr<NavigationState> NavigationFirstInProgress::transfer(
   }
 }
 void NavigationFirstInProgress::effect() {
-  auto next_node_evt = std::make_shared<vda5050pp::events::NavigationNextNode>();
+  auto next_node_evt = vda5050pp::misc::makePooled<vda5050pp::events::NavigationNextNode>();
   next_node_evt->next_node = this->task().getGoal();
   next_node_evt->via_edge = this->task().getViaEdge();
 
   Instance::ref().getNavigationEventManager().dispatch(next_node_evt);
 
   if (auto maybe_seg = this->task().getSegment(); maybe_seg.has_value()) {
-    auto upcoming_segment_evt = std::make_shared<vda5050pp::events::NavigationUpcomingSegment>();
+    auto upcoming_segment_evt =
+        vda5050pp::misc::makePooled<vda5050pp::events::NavigationUpcomingSegment>();
     upcoming_segment_evt->begin_seq = maybe_seg->first;
     upcoming_segment_evt->end_seq = maybe_seg->second;
     Instance::ref().getNavigationEventManager().dispatch(upcoming_segment_evt);
@@ -183,7 +185,7 @@ std::unique_ptr<NavigationState> NavigationPausing::transfer(NavigationTransitio
   }
 }
 void NavigationPausing::effect() {
-  auto a_evt = std::make_shared<vda5050pp::events::NavigationControl>();
+  auto a_evt = vda5050pp::misc::makePooled<vda5050pp::events::NavigationControl>();
   a_evt->type = vda5050pp::events::NavigationControlType::k_pause;
 
   Instance::ref().getNavigationEventManager().dispatch(a_evt);
@@ -230,7 +232,7 @@ std::unique_ptr<NavigationState> NavigationResuming::transfer(NavigationTransiti
   }
 }
 void NavigationResuming::effect() {
-  auto a_evt = std::make_shared<vda5050pp::events::NavigationControl>();
+  auto a_evt = vda5050pp::misc::makePooled<vda5050pp::events::NavigationControl>();
   a_evt->type = vda5050pp::events::NavigationControlType::k_resume;
 
   Instance::ref().getNavigationEventManager().dispatch(a_evt);
@@ -256,7 +258,7 @@ std::unique_ptr<NavigationState> NavigationCanceling::transfer(NavigationTransit
   }
 }
 void NavigationCanceling::effect() {
-  auto a_evt = std::make_shared<vda5050pp::events::NavigationControl>();
+  auto a_evt = vda5050pp::misc::makePooled<vda5050pp::events::NavigationControl>();
   a_evt->type = vda5050pp::events::NavigationControlType::k_cancel;
 
   Instance::ref().getNavigationEventManager().dispatch(a_evt);
@@ -281,7 +283,7 @@ std::unique_ptr<NavigationState> NavigationDone::transfer(NavigationTransition t
       MK_EX_CONTEXT(fmt::format("Cannot {} during DONE", transition)));
 }
 void NavigationDone::effect() {
-  auto evt = std::make_shared<vda5050pp::core::events::OrderNewLastNodeId>();
+  auto evt = vda5050pp::misc::makePooled<vda5050pp::core::events::OrderNewLastNodeId>();
   evt->last_node_id = this->task().getGoal()->nodeId;
   evt->seq_id = this->task().getGoal()->sequenceId;
 
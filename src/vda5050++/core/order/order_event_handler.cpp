@@ -7,6 +7,7 @@
 #include "vda5050++/core/order/order_event_handler.h"
 
 #include "vda5050++/core/common/exception.h"
+#include "vda5050++/misc/pool_allocator.h"
 
 using namespace vda5050pp::core::order;
 
@@ -45,7 +46,7 @@ void OrderEventHandler::handleYieldNewAction(
   }
 
   // Prepare the action
-  auto prepare_evt = std::make_shared<vda5050pp::events::ActionPrepare>();
+  auto prepare_evt = vda5050pp::misc::makePooled<vda5050pp::events::ActionPrepare>();
   prepare_evt->action = evt->action;
   Instance::ref().getActionEventManager().dispatch(prepare_evt);
 }
@@ -182,8 +183,8 @@ void OrderEventHandler::handleNavigationNode(
 template <typename QueryType> inline vda5050pp::events::QueryPauseResumeResult queryPauseResume() {
   using namespace std::chrono_literals;
 
-  auto evt = std::make_shared<QueryType>();
-  auto future = evt->getFuture();
+  auto evt = vda5050pp::misc::makePooled<QueryType>();
+  auto future = evt->getSynchronizedFuture();
 
   vda5050pp::core::Instance::ref().getQueryEventManager().dispatch(evt, true);
 
@@ -196,14 +197,14 @@ template <typename QueryType> inline vda5050pp::events::QueryPauseResumeResult q
 
 inline void dispatchErrors(const std::list<vda5050::Error> &errors) {
   for (const auto &e : errors) {
-    auto evt = std::make_shared<vda5050pp::events::ErrorAdd>();
+    auto evt = vda5050pp::misc::makePooled<vda5050pp::events::ErrorAdd>();
     evt->error = e;
     vda5050pp::core::Instance::ref().getStatusEventManager().dispatch(evt, true);
   }
 }
 
 inline void setFailed(std::string_view action_id) {
-  auto evt = std::make_shared<vda5050pp::core::events::OrderActionStatusChanged>();
+  auto evt = vda5050pp::misc::makePooled<vda5050pp::core::events::OrderActionStatusChanged>();
   evt->action_id = action_id;
   evt->action_status = vda5050::ActionStatus::FAILED;
   vda5050pp::core::Instance::ref().getOrderEventManager().synchronousDispatch(evt);
@@ -11,6 +11,7 @@
 #include "vda5050++/core/common/exception.h"
 #include "vda5050++/core/instance.h"
 #include "vda5050++/core/logger.h"
+#include "vda5050++/misc/pool_allocator.h"
 
 using namespace vda5050pp::core::order;
 
@@ -20,7 +21,7 @@ Scheduler &SchedulerState::scheduler() { return this->scheduler_; }
 // Scheduler Idle State ////////////////////////////////////////////////////////////////////////////
 SchedulerIdle::SchedulerIdle(Scheduler &scheduler, bool notify) : SchedulerStateID(scheduler) {
   if (notify) {
-    auto evt = std::make_shared<vda5050pp::core::events::OrderStatus>();
+    auto evt = vda5050pp::misc::makePooled<vda5050pp::core::events::OrderStatus>();
     evt->status = vda5050pp::misc::OrderStatus::k_order_idle;
     Instance::ref().getOrderEventManager().dispatch(evt);
   }
@@ -57,7 +58,7 @@ std::string SchedulerIdle::describe() { return "SchedulerIdle"; }
 SchedulerIdlePaused::SchedulerIdlePaused(Scheduler &scheduler, bool notify)
     : SchedulerStateID(scheduler) {
   if (notify) {
-    auto evt = std::make_shared<vda5050pp::core::events::OrderStatus>();
+    auto evt = vda5050pp::misc::makePooled<vda5050pp::core::events::OrderStatus>();
     evt->status = vda5050pp::misc::OrderStatus::k_order_idle_paused;
     Instance::ref().getOrderEventManager().dispatch(evt);
   }
@@ -87,7 +88,7 @@ std::string SchedulerIdlePaused::describe() { return "SchedulerIdlePaused"; }
 // Scheduler Active State //////////////////////////////////////////////////////////////////////////
 SchedulerActive::SchedulerActive(Scheduler &scheduler, bool notify) : SchedulerStateID(scheduler) {
   if (notify) {
-    auto evt = std::make_shared<vda5050pp::core::events::OrderStatus>();
+    auto evt = vda5050pp::misc::makePooled<vda5050pp::core::events::OrderStatus>();
     evt->status = vda5050pp::misc::OrderStatus::k_order_active;
     Instance::ref().getOrderEventManager().dispatch(evt);
   }
@@ -145,7 +146,7 @@ std::string SchedulerActive::describe() { return "SchedulerActive"; }
 SchedulerCanceling::SchedulerCanceling(Scheduler &scheduler, bool notify)
     : SchedulerStateID(scheduler) {
   if (notify) {
-    auto evt = std::make_shared<vda5050pp::core::events::OrderStatus>();
+    auto evt = vda5050pp::misc::makePooled<vda5050pp::core::events::OrderStatus>();
     evt->status = vda5050pp::misc::OrderStatus::k_order_canceling;
     Instance::ref().getOrderEventManager().dispatch(evt);
   }
@@ -182,7 +183,7 @@ std::string SchedulerCanceling::describe() { return "SchedulerCanceling"; }
 SchedulerResuming::SchedulerResuming(Scheduler &scheduler, bool notify)
     : SchedulerStateID(scheduler) {
   if (notify) {
-    auto evt = std::make_shared<vda5050pp::core::events::OrderStatus>();
+    auto evt = vda5050pp::misc::makePooled<vda5050pp::core::events::OrderStatus>();
     evt->status = vda5050pp::misc::OrderStatus::k_order_resuming;
     Instance::ref().getOrderEventManager().dispatch(evt);
   }
@@ -221,7 +222,7 @@ std::string SchedulerResuming::describe() { return "SchedulerResuming"; }
 SchedulerPausing::SchedulerPausing(Scheduler &scheduler, bool notify)
     : SchedulerStateID(scheduler) {
   if (notify) {
-    auto evt = std::make_shared<vda5050pp::core::events::OrderStatus>();
+    auto evt = vda5050pp::misc::makePooled<vda5050pp::core::events::OrderStatus>();
     evt->status = vda5050pp::misc::OrderStatus::k_order_pausing;
     Instance::ref().getOrderEventManager().dispatch(evt);
   }
@@ -261,7 +262,7 @@ std::string SchedulerPausing::describe() { return "SchedulerPausing"; }
 // //////////////////////////////////////////////////////////////////////////
 SchedulerPaused::SchedulerPaused(Scheduler &scheduler, bool notify) : SchedulerStateID(scheduler) {
   if (notify) {
-    auto evt = std::make_shared<vda5050pp::core::events::OrderStatus>();
+    auto evt = vda5050pp::misc::makePooled<vda5050pp::core::events::OrderStatus>();
     evt->status = vda5050pp::misc::OrderStatus::k_order_paused;
     Instance::ref().getOrderEventManager().dispatch(evt);
   }
@@ -298,7 +299,7 @@ std::string SchedulerPaused::describe() { return "SchedulerPaused"; }
 // //////////////////////////////////////////////////////////////////////////
 SchedulerFailed::SchedulerFailed(Scheduler &scheduler, bool notify) : SchedulerStateID(scheduler) {
   if (notify) {
-    auto evt = std::make_shared<vda5050pp::core::events::OrderStatus>();
+    auto evt = vda5050pp::misc::makePooled<vda5050pp::core::events::OrderStatus>();
     evt->status = vda5050pp::misc::OrderStatus::k_order_failed;
     Instance::ref().getOrderEventManager().dispatch(evt);
   }
@@ -326,7 +327,7 @@ std::string SchedulerFailed::describe() { return "SchedulerFailed"; }
 SchedulerInterrupting::SchedulerInterrupting(Scheduler &scheduler, bool notify)
     : SchedulerStateID(scheduler) {
   if (notify) {
-    auto evt = std::make_shared<vda5050pp::core::events::OrderStatus>();
+    auto evt = vda5050pp::misc::makePooled<vda5050pp::core::events::OrderStatus>();
     evt->status = vda5050pp::misc::OrderStatus::k_order_interrupting;
 
     Instance::ref().getOrderEventManager().dispatch(evt);
@@ -420,7 +421,7 @@ void Scheduler::clearQueues(bool keep_nav) {
   }
 
   for (const auto &action_id : forget_ids) {
-    auto evt = std::make_shared<vda5050pp::events::ActionForget>();
+    auto evt = vda5050pp::misc::makePooled<vda5050pp::events::ActionForget>();
     evt->action_id = action_id;
     Instance::ref().getActionEventManager().dispatch(evt);
   }
@@ -612,7 +613,7 @@ void Scheduler::doPatchSegment() {
     return;  // Nothing to do
   }
 
-  auto evt = std::make_shared<vda5050pp::events::NavigationUpcomingSegment>();
+  auto evt = vda5050pp::misc::makePooled<vda5050pp::events::NavigationUpcomingSegment>();
   evt->begin_seq = old_segment_last + 1;
   evt->end_seq = this->current_segment_->second;
   Instance::ref().getNavigationEventManager().dispatch(evt);
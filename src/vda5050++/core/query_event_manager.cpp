@@ -8,14 +8,12 @@
 
 #include <eventpp/utilities/argumentadapter.h>
 
-#include <chrono>
-
+#include "vda5050++/core/common/event_processing.h"
 #include "vda5050++/core/common/exception.h"
 #include "vda5050++/core/common/formatters.h"
 #include "vda5050++/core/logger.h"
 
 using namespace vda5050pp::core;
-using namespace std::chrono_literals;
 
 ScopedQueryEventSubscriber::ScopedQueryEventSubscriber(QueryEventQueue &queue) : remover_(queue) {}
 
@@ -46,30 +44,21 @@ void ScopedQueryEventSubscriber::subscribe(
           std::move(callback)));
 }
 
-QueryEventManager::QueryEventManager(const vda5050pp::config::EventManagerOptions &opts)
-    : opts_(opts),
-      thread_(std::bind(std::mem_fn(&QueryEventManager::threadTask), this, std::placeholders::_1)) {
+QueryEventManager::QueryEventManager(
+    const vda5050pp::config::EventManagerOptions &opts,
+    std::shared_ptr<vda5050pp::core::common::WorkerPool> worker_pool, Instance *instance)
+    : statistics_recorder_("QueryEventManager"),
+      opts_(opts),
+      processor_([this] { this->processQueue(); }, opts, worker_pool, instance) {
+  vda5050pp::core::common::setStatisticsRecorder(this->query_event_queue_,
+                                                 &this->statistics_recorder_);
+  vda5050pp::core::common::setQueueLimit(
+      this->query_event_queue_, opts.getQueueLimit(this->statistics_recorder_.getManagerName()));
 }
 
-void QueryEventManager::threadTask(vda5050pp::core::common::StopToken tkn) noexcept(true) {
-  if (this->opts_.synchronous_event_dispatch) {
-    // This event loop is not needed
-    return;
-  }
-
-  try {
-    while (!tkn.stopRequested()) {
-      if (this->query_event_queue_.processUntil([&tkn] { return tkn.stopRequested(); })) {
-        // no pause
-      } else {
-        std::this_thread::sleep_for(10ms);
-      }
-    }
-  } catch (const vda5050pp::VDA5050PPError &err) {
-    getEventsLogger()->error("QueryEventManager caught an exception, while processing events:\n {}",
-                             err);
-    // TODO: Handle critical exceptions
-  }
+void QueryEventManager::processQueue() noexcept(true) {
+  vda5050pp::core::common::processEvents([this] { return this->query_event_queue_.processOne(); },
+                                         "QueryEventManager");
 }
 
 void QueryEventManager::dispatch(std::shared_ptr<vda5050pp::events::QueryPauseable> data,
@@ -78,6 +67,7 @@ void QueryEventManager::dispatch(std::shared_ptr<vda5050pp::events::QueryPauseab
     this->query_event_queue_.dispatch(vda5050pp::events::QueryEventType::k_pauseable, data);
   } else {
     this->query_event_queue_.enqueue(vda5050pp::events::QueryEventType::k_pauseable, data);
+    this->processor_.notify();
   }
 }
 
@@ -87,6 +77,7 @@ void QueryEventManager::dispatch(std::shared_ptr<vda5050pp::events::QueryResumab
     this->query_event_queue_.dispatch(vda5050pp::events::QueryEventType::k_resumable, data);
   } else {
     this->query_event_queue_.enqueue(vda5050pp::events::QueryEventType::k_resumable, data);
+    this->processor_.notify();
   }
 }
 
@@ -96,9 +87,15 @@ void QueryEventManager::dispatch(std::shared_ptr<vda5050pp::events::QueryAcceptZ
     this->query_event_queue_.dispatch(vda5050pp::events::QueryEventType::k_accept_zone_set, data);
   } else {
     this->query_event_queue_.enqueue(vda5050pp::events::QueryEventType::k_accept_zone_set, data);
+    this->processor_.notify();
   }
 }
 
 ScopedQueryEventSubscriber QueryEventManager::getScopedQueryEventSubscriber() noexcept(true) {
   return ScopedQueryEventSubscriber(this->query_event_queue_);
-}
\ No newline at end of file
+}
+
+const vda5050pp::core::common::EventStatisticsRecorder &
+QueryEventManager::getStatisticsRecorder() const noexcept(true) {
+  return this->statistics_recorder_;
+}
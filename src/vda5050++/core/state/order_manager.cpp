@@ -43,6 +43,8 @@ void OrderManager::addNewAction(std::shared_ptr<vda5050::Action> action,
     throw vda5050pp::VDA5050PPInvalidArgument(
         MK_EX_CONTEXT(fmt::format("ActionState with id={} already exists.", action->actionId)));
   }
+
+  this->action_states_revision_ = nextStateRevision();
 }
 
 std::shared_ptr<vda5050::Action> OrderManager::getAction(std::string_view action_id) noexcept(
@@ -81,6 +83,17 @@ std::shared_ptr<vda5050::ActionState> OrderManager::tryGetActionState(std::strin
   return ret->second;
 }
 
+void OrderManager::setActionStatus(std::string_view action_id,
+                                   vda5050::ActionStatus action_status,
+                                   const std::optional<std::string> &result) noexcept(false) {
+  std::unique_lock lock(this->mutex_);
+
+  auto action_state = this->getActionState(action_id);
+  action_state->actionStatus = action_status;
+  action_state->resultDescription = result;
+  this->action_states_revision_ = nextStateRevision();
+}
+
 std::pair<std::string, uint32_t> OrderManager::getOrderId() const {
   std::unique_lock lock(this->mutex_);
   return {this->order_id_, this->order_update_id_};
@@ -120,6 +133,7 @@ std::pair<GraphElement::SequenceId, GraphElement::SequenceId> OrderManager::exte
   }
 
   if (graph_.has_value()) {
+    this->graph_revision_ = nextStateRevision();
     return this->graph_->extend(std::move(extension));
   } else {
     throw vda5050pp::VDA5050PPInvalidArgument(MK_EX_CONTEXT("State has no current graph"));
@@ -165,6 +179,7 @@ void OrderManager::replaceGraph(Graph &&new_graph, std::string_view order_id,
   this->order_id_ = order_id;
   this->order_update_id_ = 0;
   this->graph_->setAgvLastNodeSequenceId(0);  // Order is only accepted, if the AGV is on node 0
+  this->graph_revision_ = nextStateRevision();
 }
 
 void OrderManager::replaceGraph(Graph &&new_graph, std::string_view order_id) noexcept(false) {
@@ -197,6 +212,7 @@ void OrderManager::setAGVLastNode(uint32_t agv_seq_id) noexcept(false) {
 
   this->graph_->setAgvLastNodeSequenceId(agv_seq_id);
   this->graph_->trim();
+  this->graph_revision_ = nextStateRevision();
 
   // Persistently store last_node information (available without graph)
   this->last_node_sequence_id_ = this->graph_->agvPosition();
@@ -211,8 +227,16 @@ bool OrderManager::setAGVLastNodeId(std::string_view last_node_id) noexcept(fals
 }
 
 void OrderManager::dumpTo(vda5050::State &state) const {
+  StateRevisions revisions;
+  this->dumpTo(state, revisions);
+}
+
+void OrderManager::dumpTo(vda5050::State &state, StateRevisions &revisions) const {
   std::unique_lock lock(this->mutex_);
 
+  revisions.graph = this->graph_revision_;
+  revisions.action_states = this->action_states_revision_;
+
   // basic fields
   state.orderId = this->order_id_;
   state.orderUpdateId = this->order_update_id_;
@@ -236,6 +260,7 @@ void OrderManager::clearGraph() {
   std::unique_lock lock(this->mutex_);
   getStateLogger()->debug("clearing graph");
   this->graph_.reset();
+  this->graph_revision_ = nextStateRevision();
 }
 
 void OrderManager::cancelWaitingActions() {
@@ -253,6 +278,7 @@ void OrderManager::cancelWaitingActions() {
       state->actionStatus = vda5050::ActionStatus::FAILED;
     }
   }
+  this->action_states_revision_ = nextStateRevision();
 }
 
 void OrderManager::clearActions() {
@@ -262,4 +288,5 @@ void OrderManager::clearActions() {
 
   this->action_state_by_id_.clear();
   this->action_by_id_.clear();
+  this->action_states_revision_ = nextStateRevision();
 }
\ No newline at end of file
@@ -10,6 +10,7 @@
 
 #include "vda5050++/config/state_subconfig.h"
 #include "vda5050++/core/common/exception.h"
+#include "vda5050++/misc/pool_allocator.h"
 using namespace vda5050pp::core::state;
 
 void StateEventHandler::handleGraphExtensionEvent(
@@ -31,7 +32,7 @@ void StateEventHandler::handleGraphExtensionEvent(
 
   // Extract delta nodes/edges
   graph = graph.subgraph({delta_first, delta_last});
-  auto base_increased = std::make_shared<vda5050pp::events::NavigationBaseIncreased>();
+  auto base_increased = vda5050pp::misc::makePooled<vda5050pp::events::NavigationBaseIncreased>();
   base_increased->base_expand_nodes = graph.getNodes();
   base_increased->base_expand_edges = graph.getEdges();
   Instance::ref().getNavigationEventManager().dispatch(base_increased);
@@ -47,7 +48,7 @@ void StateEventHandler::handleGraphReplacementEvent(
   // Create graph and extract base node/edges
   vda5050pp::core::state::Graph graph(*data->graph);
   auto base = graph.subgraph(graph.baseBounds());
-  auto base_increased = std::make_shared<vda5050pp::events::NavigationBaseIncreased>();
+  auto base_increased = vda5050pp::misc::makePooled<vda5050pp::events::NavigationBaseIncreased>();
   base_increased->base_expand_nodes = base.getNodes();
   base_increased->base_expand_edges = base.getEdges();
 
@@ -84,7 +85,7 @@ void StateEventHandler::handleOrderNewLastNodeId(
   auto &status_manager = Instance::ref().getStatusManager();
   status_manager.resetDistanceSinceLastNode();
 
-  auto update = std::make_shared<vda5050pp::core::events::RequestStateUpdateEvent>();
+  auto update = vda5050pp::misc::makePooled<vda5050pp::core::events::RequestStateUpdateEvent>();
   update->urgency = StateUpdateUrgency::high();
   Instance::ref().getStateEventManager().dispatch(update);
 }
@@ -95,11 +96,10 @@ void StateEventHandler::handleOrderActionStatusChanged(
     throw vda5050pp::VDA5050PPInvalidEventData(MK_EX_CONTEXT("OrderNewLastNodeId Event is empty"));
   }
 
-  auto status = vda5050pp::core::Instance::ref().getOrderManager().getActionState(data->action_id);
-  status->actionStatus = data->action_status;
-  status->resultDescription = data->result;
+  vda5050pp::core::Instance::ref().getOrderManager().setActionStatus(
+      data->action_id, data->action_status, data->result);
 
-  auto update = std::make_shared<vda5050pp::core::events::RequestStateUpdateEvent>();
+  auto update = vda5050pp::misc::makePooled<vda5050pp::core::events::RequestStateUpdateEvent>();
   update->urgency = StateUpdateUrgency::high();
   Instance::ref().getStateEventManager().dispatch(update);
 }
@@ -123,7 +123,7 @@ void StateEventHandler::handleOrderStatus(
 
   // Update if paused state changed
   if (is_pause(pre) != is_pause(data->status)) {
-    auto update = std::make_shared<vda5050pp::core::events::RequestStateUpdateEvent>();
+    auto update = vda5050pp::misc::makePooled<vda5050pp::core::events::RequestStateUpdateEvent>();
     update->urgency = StateUpdateUrgency::high();
     Instance::ref().getStateEventManager().dispatch(update);
   }
@@ -191,7 +191,7 @@ void StateEventHandler::handleNavigationStatusDriving(
   }
 
   if (Instance::ref().getStatusManager().setDriving(data->is_driving)) {
-    auto update = std::make_shared<vda5050pp::core::events::RequestStateUpdateEvent>();
+    auto update = vda5050pp::misc::makePooled<vda5050pp::core::events::RequestStateUpdateEvent>();
     update->urgency = StateUpdateUrgency::high();
     Instance::ref().getStateEventManager().dispatch(update);
   }
@@ -209,7 +209,7 @@ void StateEventHandler::handleNavigationStatusNodeReached(
   }
 
   if (Instance::ref().getOrderManager().setAGVLastNodeId(*data->last_node_id)) {
-    auto update = std::make_shared<vda5050pp::core::events::RequestStateUpdateEvent>();
+    auto update = vda5050pp::misc::makePooled<vda5050pp::core::events::RequestStateUpdateEvent>();
     update->urgency = StateUpdateUrgency::high();
     Instance::ref().getStateEventManager().dispatch(update);
   }
@@ -222,7 +222,7 @@ void StateEventHandler::handleLoadAdd(std::shared_ptr<vda5050pp::events::LoadAdd
   }
 
   if (vda5050pp::core::Instance::ref().getStatusManager().addLoad(data->load)) {
-    auto update = std::make_shared<vda5050pp::core::events::RequestStateUpdateEvent>();
+    auto update = vda5050pp::misc::makePooled<vda5050pp::core::events::RequestStateUpdateEvent>();
     update->urgency = StateUpdateUrgency::high();
     Instance::ref().getStateEventManager().dispatch(update);
   }
@@ -235,7 +235,7 @@ void StateEventHandler::handleLoadRemove(std::shared_ptr<vda5050pp::events::Load
   }
 
   if (vda5050pp::core::Instance::ref().getStatusManager().removeLoad(data->load_id)) {
-    auto update = std::make_shared<vda5050pp::core::events::RequestStateUpdateEvent>();
+    auto update = vda5050pp::misc::makePooled<vda5050pp::core::events::RequestStateUpdateEvent>();
     update->urgency = StateUpdateUrgency::high();
     Instance::ref().getStateEventManager().dispatch(update);
   }
@@ -262,7 +262,7 @@ void StateEventHandler::handleLoadsAlter(std::shared_ptr<vda5050pp::events::Load
   }
 
   if (vda5050pp::core::Instance::ref().getStatusManager().loadsAlter(data->alter_function)) {
-    auto update = std::make_shared<vda5050pp::core::events::RequestStateUpdateEvent>();
+    auto update = vda5050pp::misc::makePooled<vda5050pp::core::events::RequestStateUpdateEvent>();
     update->urgency = StateUpdateUrgency::high();
     Instance::ref().getStateEventManager().dispatch(update);
   }
@@ -275,7 +275,7 @@ void StateEventHandler::handleOperatingModeSet(
   }
 
   if (vda5050pp::core::Instance::ref().getStatusManager().setOperatingMode(data->operating_mode)) {
-    auto update = std::make_shared<vda5050pp::core::events::RequestStateUpdateEvent>();
+    auto update = vda5050pp::misc::makePooled<vda5050pp::core::events::RequestStateUpdateEvent>();
     update->urgency = StateUpdateUrgency::high();
     Instance::ref().getStateEventManager().dispatch(update);
   }
@@ -303,7 +303,7 @@ void StateEventHandler::handleOperatingModeAlter(
 
   if (vda5050pp::core::Instance::ref().getStatusManager().operatingModeAlter(
           data->alter_function)) {
-    auto update = std::make_shared<vda5050pp::core::events::RequestStateUpdateEvent>();
+    auto update = vda5050pp::misc::makePooled<vda5050pp::core::events::RequestStateUpdateEvent>();
     update->urgency = StateUpdateUrgency::high();
     Instance::ref().getStateEventManager().dispatch(update);
   }
@@ -349,7 +349,7 @@ void StateEventHandler::handleRequestNewBase(
 
   vda5050pp::core::Instance::ref().getStatusManager().requestNewBase();
 
-  auto update = std::make_shared<vda5050pp::core::events::RequestStateUpdateEvent>();
+  auto update = vda5050pp::misc::makePooled<vda5050pp::core::events::RequestStateUpdateEvent>();
   update->urgency = StateUpdateUrgency::high();
   Instance::ref().getStateEventManager().dispatch(update);
 }
@@ -361,7 +361,7 @@ void StateEventHandler::handleErrorAdd(std::shared_ptr<vda5050pp::events::ErrorA
   }
 
   if (vda5050pp::core::Instance::ref().getStatusManager().addError(data->error)) {
-    auto update = std::make_shared<vda5050pp::core::events::RequestStateUpdateEvent>();
+    auto update = vda5050pp::misc::makePooled<vda5050pp::core::events::RequestStateUpdateEvent>();
     update->urgency = StateUpdateUrgency::high();
     Instance::ref().getStateEventManager().dispatch(update);
   }
@@ -374,7 +374,7 @@ void StateEventHandler::handleErrorsAlter(
   }
 
   if (vda5050pp::core::Instance::ref().getStatusManager().alterErrors(data->alter_function)) {
-    auto update = std::make_shared<vda5050pp::core::events::RequestStateUpdateEvent>();
+    auto update = vda5050pp::misc::makePooled<vda5050pp::core::events::RequestStateUpdateEvent>();
     update->urgency = StateUpdateUrgency::high();
     Instance::ref().getStateEventManager().dispatch(update);
   }
@@ -388,7 +388,7 @@ void StateEventHandler::handleInfoAdd(std::shared_ptr<vda5050pp::events::InfoAdd
 
   vda5050pp::core::Instance::ref().getStatusManager().addInfo(data->info);
 
-  auto update = std::make_shared<vda5050pp::core::events::RequestStateUpdateEvent>();
+  auto update = vda5050pp::misc::makePooled<vda5050pp::core::events::RequestStateUpdateEvent>();
   update->urgency = StateUpdateUrgency::high();
   Instance::ref().getStateEventManager().dispatch(update);
 }
@@ -401,7 +401,7 @@ void StateEventHandler::handleInfosAlter(std::shared_ptr<vda5050pp::events::Info
 
   vda5050pp::core::Instance::ref().getStatusManager().alterInfos(data->alter_function);
 
-  auto update = std::make_shared<vda5050pp::core::events::RequestStateUpdateEvent>();
+  auto update = vda5050pp::misc::makePooled<vda5050pp::core::events::RequestStateUpdateEvent>();
   update->urgency = StateUpdateUrgency::high();
   Instance::ref().getStateEventManager().dispatch(update);
 }
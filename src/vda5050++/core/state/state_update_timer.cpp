@@ -10,6 +10,8 @@
 
 #include "vda5050++/config/state_update_timer_subconfig.h"
 #include "vda5050++/core/common/exception.h"
+#include "vda5050++/core/instance_scope.h"
+#include "vda5050++/misc/pool_allocator.h"
 
 using namespace vda5050pp::core::state;
 using namespace std::chrono_literals;
@@ -27,6 +29,7 @@ static std::shared_ptr<spdlog::logger> getStateUpdateTimerLogger() {
 
 void StateUpdateTimer::timerRoutine(vda5050pp::core::common::StopToken stop_token) {
   getStateUpdateTimerLogger()->debug("entering timerRoutine()");
+  InstanceScope scope(this->instance_);
 
   DurationT max_update_period = Instance::ref()
                                     .getConfig()
@@ -34,27 +37,42 @@ void StateUpdateTimer::timerRoutine(vda5050pp::core::common::StopToken stop_toke
                                     ->as<vda5050pp::config::StateUpdateTimerSubConfig>()
                                     .getMaxUpdatePeriod();
 
-  stop_token.onStopRequested([this] { this->timer_.disable(); });
+  stop_token.onStopRequested([this] {
+    { std::unique_lock lock(this->wakeup_mutex_); }
+    this->wakeup_cv_.notify_all();
+  });
 
+  std::unique_lock lock(this->wakeup_mutex_);
   while (!stop_token.stopRequested()) {
     TimePointT wakeup_time_point = this->last_sent_ + max_update_period;
 
+    // Arm with the periodic time point first, such that requests racing with the lookup of the
+    // deadline below always see an armed time point, which is not earlier than the final one.
+    this->armed_wakeup_ = wakeup_time_point.time_since_epoch().count();
+
     // If there was any request for an earlier update, use it.
-    if (this->next_scheduled_update_.has_value()) {
-      wakeup_time_point = std::min(wakeup_time_point, *this->next_scheduled_update_);
+    if (auto deadline = this->next_deadline_.load(); deadline != k_no_deadline) {
+      wakeup_time_point = std::min(wakeup_time_point, TimePointT(DurationT(deadline)));
     }
 
-    auto status = this->timer_.sleepUntil(wakeup_time_point);
+    auto armed = wakeup_time_point.time_since_epoch().count();
+    this->armed_wakeup_ = armed;
 
-    if (status == vda5050pp::core::common::InterruptableTimerStatus::k_ok) {
-      // Timer was not interrupted, so there is no new update time point
-      this->doStateUpdate();
+    auto last_sent = this->last_sent_;
+    bool woken = this->wakeup_cv_.wait_until(lock, wakeup_time_point, [&] {
+      return stop_token.stopRequested() || this->next_deadline_.load() < armed ||
+             this->last_sent_ != last_sent;
+    });
 
+    if (!woken) {
+      // The wakeup time point was reached
+      lock.unlock();
+      this->publishState();
+      lock.lock();
       this->last_sent_ = std::chrono::system_clock::now();
-      this->next_scheduled_update_.reset();
     } else {
-      // Timer was interrupted, so there is a new update time point,
-      // update the wakeup time point (in the next iteration) and go to sleep again.
+      // Stop requested, there is a new (earlier) update time point or a state was sent
+      // immediately, update the wakeup time point (in the next iteration) and go to sleep again.
     }
   }
 
@@ -74,17 +92,28 @@ void StateUpdateTimer::handleRequestStateUpdateEvent(
   }
 }
 
-void StateUpdateTimer::doStateUpdate() const {
+void StateUpdateTimer::publishState() {
+  // Requests arriving from now on are not merged into this state and schedule a new update
+  this->next_deadline_ = k_no_deadline;
+  auto merged_requests = this->pending_requests_.exchange(0);
+  this->last_merged_requests_ = merged_requests;
+
+  this->doStateUpdate(merged_requests);
+}
+
+void StateUpdateTimer::doStateUpdate(uint32_t merged_requests) const {
   auto &instance = vda5050pp::core::Instance::ref();
 
-  auto event = std::make_shared<vda5050pp::core::events::SendStateMessageEvent>();
+  auto event = vda5050pp::misc::makePooled<vda5050pp::core::events::SendStateMessageEvent>();
   event->state = std::make_shared<vda5050::State>();
+  event->merged_update_requests = merged_requests;
 
-  instance.getOrderManager().dumpTo(*event->state);
-  instance.getStatusManager().dumpTo(*event->state);
+  instance.getOrderManager().dumpTo(*event->state, event->revisions);
+  instance.getStatusManager().dumpTo(*event->state, event->revisions);
 
-  getStateUpdateTimerLogger()->debug("Dispatching SendStateMessageEvent");
-  instance.getMessageEventManager().dispatch(event);
+  getStateUpdateTimerLogger()->debug("Dispatching SendStateMessageEvent ({} merged requests)",
+                                     merged_requests);
+  instance.getMessageEventManager().dispatch(event, EventPriority::k_bulk);
 }
 
 StateUpdateTimer::StateUpdateTimer()
@@ -92,20 +121,22 @@ StateUpdateTimer::StateUpdateTimer()
               false) {}
 
 void StateUpdateTimer::initialize(vda5050pp::core::Instance &instance) {
+  this->instance_ = &instance;
   getStateUpdateTimerLogger()->flush_on(spdlog::level::debug);
   auto cfg = instance.getConfig().lookupModuleConfig(module_keys::k_state_update_timer_key);
   this->state_subscriber_ = instance.getStateEventManager().getScopedSubscriber();
   this->state_subscriber_->subscribe<vda5050pp::core::events::RequestStateUpdateEvent>(std::bind(
       std::mem_fn(&StateUpdateTimer::handleRequestStateUpdateEvent), this, std::placeholders::_1));
 
-  this->last_sent_ = std::chrono::system_clock::now();
+  {
+    std::unique_lock lock(this->wakeup_mutex_);
+    this->last_sent_ = std::chrono::system_clock::now();
+  }
   getStateUpdateTimerLogger()->debug("thread_.start()");
   this->thread_.start();
 }
 
 void StateUpdateTimer::deinitialize(vda5050pp::core::Instance &) {
-  this->last_sent_ = TimePointT();
-  this->next_scheduled_update_ = TimePointT();
   this->state_subscriber_.reset();
   getStateUpdateTimerLogger()->debug("thread_.stop()");
   this->thread_.stop();
@@ -113,9 +144,15 @@ void StateUpdateTimer::deinitialize(vda5050pp::core::Instance &) {
     getStateUpdateTimerLogger()->debug("thread_.join()");
     this->thread_.join();
   }
+  this->instance_ = nullptr;
   getStateUpdateTimerLogger()->debug("thread_.reset()");
   this->thread_.reset(
       std::bind(std::mem_fn(&StateUpdateTimer::timerRoutine), this, std::placeholders::_1));
+
+  this->last_sent_ = TimePointT();
+  this->next_deadline_ = k_no_deadline;
+  this->armed_wakeup_ = k_no_deadline;
+  this->pending_requests_ = 0;
 }
 
 std::string_view StateUpdateTimer::describe() const { return "StateUpdateTimer"; }
@@ -125,25 +162,38 @@ std::shared_ptr<vda5050pp::config::ModuleSubConfig> StateUpdateTimer::generateSu
 }
 
 void StateUpdateTimer::requestUpdate(StateUpdateUrgency urgency) noexcept(true) {
-  auto update_time_point = std::chrono::system_clock::now() + urgency.getMaxDelay();
-
-  if (this->next_scheduled_update_.has_value()) {
-    update_time_point = std::min(update_time_point, *this->next_scheduled_update_);
-  }
-
-  getStateUpdateTimerLogger()->debug("Requesting Update");
+  this->pending_requests_++;
 
   if (urgency.isImmediate()) {
     // Immediate requires blocking until the state is actually sent
     // -> Send it synchronously
-    this->doStateUpdate();
-    this->last_sent_ = std::chrono::system_clock::now();
-    this->next_scheduled_update_.reset();
-    this->timer_.interruptAll();  // cancel current sleep
+    getStateUpdateTimerLogger()->debug("Requesting immediate Update");
+    this->publishState();
+    {
+      std::unique_lock lock(this->wakeup_mutex_);
+      this->last_sent_ = std::chrono::system_clock::now();
+    }
+    this->wakeup_cv_.notify_all();  // re-arm with the new periodic time point
+    return;
+  }
 
-  } else {
-    // Set new update timepoint and interrupt
-    this->next_scheduled_update_ = update_time_point;
-    this->timer_.interruptAll();
+  auto deadline =
+      (std::chrono::system_clock::now() + urgency.getMaxDelay()).time_since_epoch().count();
+
+  // Merge into the earliest deadline slot
+  auto current = this->next_deadline_.load();
+  while (deadline < current && !this->next_deadline_.compare_exchange_weak(current, deadline)) {
+    // current was updated, retry
+  }
+
+  // Only wake up the timer, if it currently sleeps past the new deadline
+  if (deadline < this->armed_wakeup_.load()) {
+    getStateUpdateTimerLogger()->debug("Requesting Update (earlier wakeup)");
+    { std::unique_lock lock(this->wakeup_mutex_); }
+    this->wakeup_cv_.notify_all();
   }
 }
+
+uint32_t StateUpdateTimer::getLastMergedRequests() const noexcept(true) {
+  return this->last_merged_requests_;
+}
@@ -63,6 +63,7 @@ bool StatusManager::addLoad(const vda5050::Load &load) {
   } else {
     this->loads_->push_back(load);
   }
+  this->loads_revision_ = nextStateRevision();
 
   return true;
 }
@@ -80,6 +81,7 @@ bool StatusManager::removeLoad(std::string_view load_id) {
 
   this->loads_->erase(std::remove_if(this->loads_->begin(), this->loads_->end(), match_id),
                       this->loads_->end());
+  this->loads_revision_ = nextStateRevision();
 
   return this->loads_->size() != before_size;
 }
@@ -127,16 +129,26 @@ void StatusManager::requestNewBase() {
 bool StatusManager::addError(const vda5050::Error &error) {
   std::unique_lock lock(this->mutex_);
   this->errors_.push_back(error);
+  this->errors_revision_ = nextStateRevision();
   return true;
 }
 
 void StatusManager::addInfo(const vda5050::Info &info) {
   std::unique_lock lock(this->mutex_);
   this->information_.push_back(info);
+  this->information_revision_ = nextStateRevision();
 }
 
 void StatusManager::dumpTo(vda5050::State &state) {
+  StateRevisions revisions;
+  this->dumpTo(state, revisions);
+}
+
+void StatusManager::dumpTo(vda5050::State &state, StateRevisions &revisions) {
   std::shared_lock lock(this->mutex_);
+  revisions.loads = this->loads_revision_;
+  revisions.errors = this->errors_revision_;
+  revisions.information = this->information_revision_;
   state.agvPosition = this->agv_position_;
   state.batteryState = this->battery_state_;
   state.distanceSinceLastNode = this->distance_since_last_node_;
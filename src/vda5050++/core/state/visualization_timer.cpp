@@ -11,7 +11,9 @@
 #include "vda5050++/core/state/visualization_timer.h"
 
 #include "vda5050++/config/visualization_timer_subconfig.h"
+#include "vda5050++/core/instance_scope.h"
 #include "vda5050++/core/logger.h"
+#include "vda5050++/misc/pool_allocator.h"
 
 using namespace vda5050pp::core::state;
 using namespace std::chrono_literals;
@@ -23,6 +25,7 @@ inline std::shared_ptr<spdlog::logger> getVisualizationTimerLogger() {
 
 void VisualizationTimer::timerRoutine(vda5050pp::core::common::StopToken stop_token) const {
   getVisualizationTimerLogger()->debug("timerRoutine(): enter");
+  InstanceScope scope(this->instance_);
 
   while (!stop_token.stopRequested()) {
     switch (this->timer_.sleepFor(this->update_period_)) {
@@ -48,7 +51,7 @@ void VisualizationTimer::timerRoutine(vda5050pp::core::common::StopToken stop_to
 }
 
 void VisualizationTimer::sendVisualization() const {
-  auto evt = std::make_shared<vda5050pp::core::events::SendVisualizationMessageEvent>();
+  auto evt = vda5050pp::misc::makePooled<vda5050pp::core::events::SendVisualizationMessageEvent>();
   evt->visualization = std::make_shared<vda5050::Visualization>();
   evt->visualization->agvPosition = Instance::ref().getStatusManager().getAGVPosition();
   if (auto maybe_vel = Instance::ref().getStatusManager().getVelocity(); maybe_vel) {
@@ -56,7 +59,7 @@ void VisualizationTimer::sendVisualization() const {
     Instance::ref().getStatusManager().resetVelocity();
   }
 
-  Instance::ref().getMessageEventManager().dispatch(evt);
+  Instance::ref().getMessageEventManager().dispatch(evt, EventPriority::k_bulk);
 }
 
 VisualizationTimer::VisualizationTimer()
@@ -65,6 +68,7 @@ VisualizationTimer::VisualizationTimer()
           false) {}
 
 void VisualizationTimer::initialize(vda5050pp::core::Instance &instance) {
+  this->instance_ = &instance;
   this->update_period_ = instance.getConfig()
                              .lookupModuleConfigAs<vda5050pp::config::VisualizationTimerSubConfig>(
                                  module_keys::k_visualization_timer_key)
@@ -79,6 +83,7 @@ void VisualizationTimer::deinitialize(vda5050pp::core::Instance &) {
   if (this->thread_.joinable()) {
     this->thread_.join();
   }
+  this->instance_ = nullptr;
   this->thread_.reset(
       std::bind(std::mem_fn(&VisualizationTimer::timerRoutine), this, std::placeholders::_1));
 }
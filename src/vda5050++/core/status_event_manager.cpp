@@ -8,15 +8,14 @@
 
 #include <eventpp/utilities/argumentadapter.h>
 
-#include <chrono>
 #include <functional>
 
+#include "vda5050++/core/common/event_processing.h"
 #include "vda5050++/core/common/exception.h"
 #include "vda5050++/core/common/formatters.h"
 #include "vda5050++/core/logger.h"
 
 using namespace vda5050pp::core;
-using namespace std::chrono_literals;
 
 ScopedStatusEventSubscriber::ScopedStatusEventSubscriber(StatusEventQueue &queue)
     : remover_(queue) {}
@@ -135,31 +134,22 @@ void ScopedStatusEventSubscriber::subscribe(
           std::move(callback)));
 }
 
-void StatusEventManager::threadTask(vda5050pp::core::common::StopToken tkn) noexcept(true) {
-  if (this->opts_.synchronous_event_dispatch) {
-    // This processing loop is not needed
-    return;
-  }
-
-  try {
-    while (!tkn.stopRequested()) {
-      if (this->status_event_queue_.processUntil([&tkn] { return tkn.stopRequested(); })) {
-        // no pause
-      } else {
-        std::this_thread::sleep_for(10ms);
-      }
-    }
-  } catch (const vda5050pp::VDA5050PPError &err) {
-    getEventsLogger()->error(
-        "StatusEventManager caught an exception, while processing events:\n {}", err);
-    // TODO: Handle critical exceptions
-  }
+void StatusEventManager::processQueue() noexcept(true) {
+  vda5050pp::core::common::processEvents([this] { return this->status_event_queue_.processOne(); },
+                                         "StatusEventManager");
 }
 
-StatusEventManager::StatusEventManager(const vda5050pp::config::EventManagerOptions &opts)
-    : opts_(opts),
-      thread_(
-          std::bind(std::mem_fn(&StatusEventManager::threadTask), this, std::placeholders::_1)) {}
+StatusEventManager::StatusEventManager(
+    const vda5050pp::config::EventManagerOptions &opts,
+    std::shared_ptr<vda5050pp::core::common::WorkerPool> worker_pool, Instance *instance)
+    : statistics_recorder_("StatusEventManager"),
+      opts_(opts),
+      processor_([this] { this->processQueue(); }, opts, worker_pool, instance) {
+  vda5050pp::core::common::setStatisticsRecorder(this->status_event_queue_,
+                                                 &this->statistics_recorder_);
+  vda5050pp::core::common::setQueueLimit(
+      this->status_event_queue_, opts.getQueueLimit(this->statistics_recorder_.getManagerName()));
+}
 
 void StatusEventManager::dispatch(std::shared_ptr<vda5050pp::events::StatusEvent> data,
                                   bool synchronous) noexcept(false) {
@@ -174,9 +164,15 @@ void StatusEventManager::dispatch(std::shared_ptr<vda5050pp::events::StatusEvent
     this->status_event_queue_.dispatch(data->type, data);
   } else {
     this->status_event_queue_.enqueue(data->type, data);
+    this->processor_.notify();
   }
 }
 
 ScopedStatusEventSubscriber StatusEventManager::getScopedStatusEventSubscriber() noexcept(true) {
   return ScopedStatusEventSubscriber(this->status_event_queue_);
-}
\ No newline at end of file
+}
+
+const vda5050pp::core::common::EventStatisticsRecorder &
+StatusEventManager::getStatisticsRecorder() const noexcept(true) {
+  return this->statistics_recorder_;
+}
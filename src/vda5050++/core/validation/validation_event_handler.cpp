@@ -10,15 +10,18 @@
 #include "vda5050++/core/checks/header.h"
 #include "vda5050++/core/checks/order.h"
 #include "vda5050++/core/common/exception.h"
+#include "vda5050++/core/common/worker_pool.h"
+#include "vda5050++/core/instance_scope.h"
 #include "vda5050++/core/logger.h"
+#include "vda5050++/misc/pool_allocator.h"
 
 using namespace vda5050pp::core::validation;
 using namespace std::chrono_literals;
 
 inline std::list<vda5050::Error> queryAcceptZoneSet(std::string_view zone_set_id) {
-  auto evt = std::make_shared<vda5050pp::events::QueryAcceptZoneSet>();
+  auto evt = vda5050pp::misc::makePooled<vda5050pp::events::QueryAcceptZoneSet>();
   evt->zone_set_id = zone_set_id;
-  auto future = evt->getFuture();
+  auto future = evt->getSynchronizedFuture();
 
   vda5050pp::core::Instance::ref().getQueryEventManager().dispatch(evt, false);
 
@@ -30,6 +33,19 @@ inline std::list<vda5050::Error> queryAcceptZoneSet(std::string_view zone_set_id
   return future.get();
 }
 
+#ifdef LIBVDA5050PP_COROUTINES
+inline auto queryAcceptZoneSetAsync(std::string_view zone_set_id) {
+  auto evt = vda5050pp::misc::makePooled<vda5050pp::events::QueryAcceptZoneSet>();
+  evt->zone_set_id = zone_set_id;
+  auto result = vda5050pp::core::common::awaitResult(
+      evt->result(), vda5050pp::core::Instance::ref().getCoroutineExecutor(), 1s);
+
+  vda5050pp::core::Instance::ref().getQueryEventManager().dispatch(evt, false);
+
+  return result;
+}
+#endif
+
 void ValidationEventHandler::handleValidateOrder(
     std::shared_ptr<vda5050pp::core::events::ValidateOrderEvent> evt) const {
   if (evt == nullptr || evt->order == nullptr) {
@@ -43,47 +59,89 @@ void ValidationEventHandler::handleValidateOrder(
     return;
   }
 
+#ifdef LIBVDA5050PP_COROUTINES
+  // Do not block this thread, while the zone set is queried
+  this->validateOrder(std::move(evt), std::move(result_token));
+#else
   // Run all checks
-  std::list<vda5050::Error> errors;
-  errors.splice(errors.end(), checks::checkHeader(evt->order->header));
-  errors.splice(errors.end(), checks::checkOrderId(*evt->order));
-  errors.splice(errors.end(), checks::checkOrderGraphConsistency(*evt->order));
-  errors.splice(errors.end(), checks::checkOrderAppend(*evt->order));
-  errors.splice(errors.end(), checks::checkOrderActionIds(*evt->order));
+  std::list<vda5050::Error> errors = this->checkOrder(*evt->order);
   if (evt->order->zoneSetId.has_value()) {
     errors.splice(errors.end(), queryAcceptZoneSet(*evt->order->zoneSetId));
   }
+  errors.splice(errors.end(), this->validateOrderActions(*evt->order));
+
+  getValidationLogger()->debug("Validation yield {} error for order(headerId={})", errors.size(),
+                               evt->order->header.headerId);
+  result_token.setValue(std::move(errors));
+#endif
+}
+
+#ifdef LIBVDA5050PP_COROUTINES
+vda5050pp::core::common::Task ValidationEventHandler::validateOrder(
+    std::shared_ptr<vda5050pp::core::events::ValidateOrderEvent> evt,
+    vda5050pp::events::SynchronizedEventToken<vda5050pp::core::events::ValidationResult>
+        result_token) const {
+  // Run all other checks before suspending. Afterwards this coroutine is resumed by the query
+  // result (not in order with the following validations), so it must not read any state anymore.
+  std::list<vda5050::Error> errors = this->checkOrder(*evt->order);
+  auto action_errors = this->validateOrderActions(*evt->order);
+  if (evt->order->zoneSetId.has_value()) {
+    errors.splice(errors.end(), co_await queryAcceptZoneSetAsync(*evt->order->zoneSetId));
+  }
+  errors.splice(errors.end(), std::move(action_errors));
+
+  getValidationLogger()->debug("Validation yield {} error for order(headerId={})", errors.size(),
+                               evt->order->header.headerId);
+  result_token.setValue(std::move(errors));
+}
+#endif
 
+std::list<vda5050::Error> ValidationEventHandler::checkOrder(const vda5050::Order &order) const {
+  std::list<vda5050::Error> errors;
+  errors.splice(errors.end(), checks::checkHeader(order.header));
+  errors.splice(errors.end(), checks::checkOrderId(order));
+  errors.splice(errors.end(), checks::checkOrderGraphConsistency(order));
+  errors.splice(errors.end(), checks::checkOrderAppend(order));
+  errors.splice(errors.end(), checks::checkOrderActionIds(order));
+  return errors;
+}
+
+std::list<vda5050::Error> ValidationEventHandler::validateOrderActions(
+    const vda5050::Order &order) const {
+  std::list<vda5050::Error> errors;
   std::vector<std::tuple<std::shared_ptr<const vda5050pp::events::ActionValidate>,
                          std::shared_ptr<const vda5050::Action>,
-                         std::future<vda5050pp::core::events::ValidationResult>>>
+                         vda5050pp::events::SynchronizedEventFuture<
+                             vda5050pp::core::events::ValidationResult>>>
       results;
+  std::vector<std::shared_ptr<vda5050pp::events::ActionValidate>> events;
 
   // Synchronously send validate for each action to the user interface
-  for (const auto &node : evt->order->nodes) {
+  for (const auto &node : order.nodes) {
     for (const auto &action : node.actions) {
       getValidationLogger()->debug("Sending ActionValidate(action={}, node) to AGV interface",
                                    action.actionId);
-      auto v_evt = std::make_shared<vda5050pp::events::ActionValidate>();
+      auto v_evt = vda5050pp::misc::makePooled<vda5050pp::events::ActionValidate>();
       v_evt->action = std::make_shared<vda5050::Action>(action);
       v_evt->context = vda5050pp::misc::ActionContext::k_node;
       v_evt->keep = node.released;
-      results.emplace_back(v_evt, v_evt->action, v_evt->getFuture());
-      vda5050pp::core::Instance::ref().getActionEventManager().dispatch(v_evt, true);
+      results.emplace_back(v_evt, v_evt->action, v_evt->getSynchronizedFuture());
+      events.push_back(std::move(v_evt));
     }
   }
-  for (const auto &edge : evt->order->edges) {
+  for (const auto &edge : order.edges) {
     for (const auto &action : edge.actions) {
       getValidationLogger()->debug("Sending ActionValidate(action={}, edge) to AGV interface",
                                    action.actionId);
-      auto v_evt = std::make_shared<vda5050pp::events::ActionValidate>();
+      auto v_evt = vda5050pp::misc::makePooled<vda5050pp::events::ActionValidate>();
       v_evt->action = std::make_shared<vda5050::Action>(action);
       v_evt->context = vda5050pp::misc::ActionContext::k_edge;
       v_evt->keep = edge.released;
-      results.emplace_back(v_evt, v_evt->action, v_evt->getFuture());
-      vda5050pp::core::Instance::ref().getActionEventManager().dispatch(v_evt, true);
+      results.emplace_back(v_evt, v_evt->action, v_evt->getSynchronizedFuture());
+      events.push_back(std::move(v_evt));
     }
   }
+  this->dispatchActionValidates(events);
 
   // Gather results (if no result is available, the action is considered unknown)
   for (auto &[_, action, future] : results) {
@@ -104,9 +162,29 @@ void ValidationEventHandler::handleValidateOrder(
     }
   }
 
-  getValidationLogger()->debug("Validation yield {} error for order(headerId={})", errors.size(),
-                               evt->order->header.headerId);
-  result_token.setValue(std::move(errors));
+  return errors;
+}
+
+void ValidationEventHandler::dispatchActionValidates(
+    const std::vector<std::shared_ptr<vda5050pp::events::ActionValidate>> &events) const {
+  auto &instance = vda5050pp::core::Instance::ref();
+  auto pool = instance.getWorkerPool();
+  const auto &opts = instance.getConfig().getGlobalConfig().getEventManagerOptions();
+
+  if (!opts.parallel_action_validation || pool == nullptr || events.size() < 2) {
+    for (const auto &v_evt : events) {
+      instance.getActionEventManager().dispatch(v_evt, true);
+    }
+    return;
+  }
+
+  // The workers of the pool are not bound to this instance
+  getValidationLogger()->debug("Validating {} actions in parallel", events.size());
+  vda5050pp::core::common::parallelFor(
+      *pool, events.size(), pool->size(), [&instance, &events](std::size_t i) {
+        InstanceScope scope(&instance);
+        instance.getActionEventManager().dispatch(events[i], true);
+      });
 }
 
 void ValidationEventHandler::handleValidateInstantActions(
@@ -127,8 +205,10 @@ void ValidationEventHandler::handleValidateInstantActions(
   std::set<std::string_view, std::less<>> seen_ids;
   std::vector<std::tuple<std::shared_ptr<const vda5050pp::events::ActionValidate>,
                          std::shared_ptr<const vda5050::Action>,
-                         std::future<vda5050pp::core::events::ValidationResult>>>
+                         vda5050pp::events::SynchronizedEventFuture<
+                             vda5050pp::core::events::ValidationResult>>>
       results;
+  std::vector<std::shared_ptr<vda5050pp::events::ActionValidate>> events;
 
   // Synchronously send validate for each action to the user interface
   for (const auto &action : evt->instant_actions->actions) {
@@ -137,13 +217,14 @@ void ValidationEventHandler::handleValidateInstantActions(
 
     getValidationLogger()->debug("Sending ActionValidate(action={}, instant) to AGV interface",
                                  action.actionId);
-    auto v_evt = std::make_shared<vda5050pp::events::ActionValidate>();
+    auto v_evt = vda5050pp::misc::makePooled<vda5050pp::events::ActionValidate>();
     v_evt->action = std::make_shared<vda5050::Action>(action);
     v_evt->context = vda5050pp::misc::ActionContext::k_instant;
     v_evt->keep = false;
-    results.emplace_back(v_evt, v_evt->action, v_evt->getFuture());
-    vda5050pp::core::Instance::ref().getActionEventManager().dispatch(v_evt, true);
+    results.emplace_back(v_evt, v_evt->action, v_evt->getSynchronizedFuture());
+    events.push_back(std::move(v_evt));
   }
+  this->dispatchActionValidates(events);
 
   // Gather results (if no result is available, the action is considered unknown)
   for (auto &[_, action, future] : results) {
@@ -11,17 +11,21 @@
 
 using namespace vda5050pp::events;
 
+EventHandle::EventHandle() noexcept(true)
+    : instance_(vda5050pp::core::Instance::threadBinding()) {}
+
 bool EventHandle::isValid() const noexcept(true) {
-  return !vda5050pp::core::Instance::get().expired();
+  try {
+    vda5050pp::core::Instance::resolve(this->instance_);
+    return true;
+  } catch (const vda5050pp::VDA5050PPNotInitialized &) {
+    return false;
+  }
 }
 
 std::shared_ptr<ScopedActionEventSubscriber> EventHandle::getScopedActionEventSubscriber() const
     noexcept(false) {
-  auto ptr = vda5050pp::core::Instance::get().lock();
-
-  if (ptr == nullptr) {
-    throw vda5050pp::VDA5050PPNotInitialized(MK_EX_CONTEXT(""));
-  }
+  auto ptr = vda5050pp::core::Instance::resolve(this->instance_);
 
   return std::make_shared<vda5050pp::core::ScopedActionEventSubscriber>(
       ptr->getActionEventManager().getScopedActionEventSubscriber());
@@ -29,11 +33,7 @@ std::shared_ptr<ScopedActionEventSubscriber> EventHandle::getScopedActionEventSu
 
 std::shared_ptr<ScopedNavigationEventSubscriber> EventHandle::getScopedNavigationEventSubscriber()
     const noexcept(false) {
-  auto ptr = vda5050pp::core::Instance::get().lock();
-
-  if (ptr == nullptr) {
-    throw vda5050pp::VDA5050PPNotInitialized(MK_EX_CONTEXT(""));
-  }
+  auto ptr = vda5050pp::core::Instance::resolve(this->instance_);
 
   return std::make_shared<vda5050pp::core::ScopedNavigationEventSubscriber>(
       ptr->getNavigationEventManager().getScopedNavigationEventSubscriber());
@@ -41,62 +41,58 @@ std::shared_ptr<ScopedNavigationEventSubscriber> EventHandle::getScopedNavigatio
 
 std::shared_ptr<ScopedQueryEventSubscriber> EventHandle::getScopedQueryEventSubscriber() const
     noexcept(false) {
-  auto ptr = vda5050pp::core::Instance::get().lock();
-
-  if (ptr == nullptr) {
-    throw vda5050pp::VDA5050PPNotInitialized(MK_EX_CONTEXT(""));
-  }
+  auto ptr = vda5050pp::core::Instance::resolve(this->instance_);
 
   return std::make_shared<vda5050pp::core::ScopedQueryEventSubscriber>(
       ptr->getQueryEventManager().getScopedQueryEventSubscriber());
 }
 
 void EventHandle::dispatch(std::shared_ptr<vda5050pp::events::ActionStatusWaiting> data) const {
-  vda5050pp::core::Instance::ref().getActionStatusManager().dispatch(data);
+  vda5050pp::core::Instance::resolve(this->instance_)->getActionStatusManager().dispatch(data);
 }
 void EventHandle::dispatch(
     std::shared_ptr<vda5050pp::events::ActionStatusInitializing> data) const {
-  vda5050pp::core::Instance::ref().getActionStatusManager().dispatch(data);
+  vda5050pp::core::Instance::resolve(this->instance_)->getActionStatusManager().dispatch(data);
 }
 void EventHandle::dispatch(std::shared_ptr<vda5050pp::events::ActionStatusRunning> data) const {
-  vda5050pp::core::Instance::ref().getActionStatusManager().dispatch(data);
+  vda5050pp::core::Instance::resolve(this->instance_)->getActionStatusManager().dispatch(data);
 }
 void EventHandle::dispatch(std::shared_ptr<vda5050pp::events::ActionStatusPaused> data) const {
-  vda5050pp::core::Instance::ref().getActionStatusManager().dispatch(data);
+  vda5050pp::core::Instance::resolve(this->instance_)->getActionStatusManager().dispatch(data);
 }
 void EventHandle::dispatch(std::shared_ptr<vda5050pp::events::ActionStatusFinished> data) const {
-  vda5050pp::core::Instance::ref().getActionStatusManager().dispatch(data);
+  vda5050pp::core::Instance::resolve(this->instance_)->getActionStatusManager().dispatch(data);
 }
 void EventHandle::dispatch(std::shared_ptr<vda5050pp::events::ActionStatusFailed> data) const {
-  vda5050pp::core::Instance::ref().getActionStatusManager().dispatch(data);
+  vda5050pp::core::Instance::resolve(this->instance_)->getActionStatusManager().dispatch(data);
 }
 
 void EventHandle::dispatch(
     std::shared_ptr<vda5050pp::events::NavigationStatusPosition> data) const {
-  vda5050pp::core::Instance::ref().getNavigationStatusManager().dispatch(data);
+  vda5050pp::core::Instance::resolve(this->instance_)->getNavigationStatusManager().dispatch(data);
 }
 void EventHandle::dispatch(
     std::shared_ptr<vda5050pp::events::NavigationStatusVelocity> data) const {
-  vda5050pp::core::Instance::ref().getNavigationStatusManager().dispatch(data);
+  vda5050pp::core::Instance::resolve(this->instance_)->getNavigationStatusManager().dispatch(data);
 }
 void EventHandle::dispatch(std::shared_ptr<vda5050pp::events::NavigationStatusDriving> data) const {
-  vda5050pp::core::Instance::ref().getNavigationStatusManager().dispatch(data);
+  vda5050pp::core::Instance::resolve(this->instance_)->getNavigationStatusManager().dispatch(data);
 }
 void EventHandle::dispatch(
     std::shared_ptr<vda5050pp::events::NavigationStatusNodeReached> data) const {
-  vda5050pp::core::Instance::ref().getNavigationStatusManager().dispatch(data);
+  vda5050pp::core::Instance::resolve(this->instance_)->getNavigationStatusManager().dispatch(data);
 }
 void EventHandle::dispatch(
     std::shared_ptr<vda5050pp::events::NavigationStatusDistanceSinceLastNode> data) const {
-  vda5050pp::core::Instance::ref().getNavigationStatusManager().dispatch(data);
+  vda5050pp::core::Instance::resolve(this->instance_)->getNavigationStatusManager().dispatch(data);
 }
 
 void EventHandle::dispatch(std::shared_ptr<vda5050pp::events::NavigationStatusControl> data) const
     noexcept(false) {
-  vda5050pp::core::Instance::ref().getNavigationStatusManager().dispatch(data);
+  vda5050pp::core::Instance::resolve(this->instance_)->getNavigationStatusManager().dispatch(data);
 }
 
 void EventHandle::dispatch(std::shared_ptr<vda5050pp::events::StatusEvent> data) const
     noexcept(false) {
-  vda5050pp::core::Instance::ref().getStatusEventManager().dispatch(data);
+  vda5050pp::core::Instance::resolve(this->instance_)->getStatusEventManager().dispatch(data);
 }
\ No newline at end of file
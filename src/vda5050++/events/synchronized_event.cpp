@@ -9,9 +9,102 @@
 
 #include "vda5050++/events/synchronized_event.h"
 
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <ctime>
+#else
+#include <array>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#endif
+
 #include "vda5050++/core/common/exception.h"
 
+using namespace vda5050pp::events;
+
 vda5050pp::VDA5050PPSynchronizedEventNotAcquired
 vda5050pp::events::_SynchronizedEventTokenStatic::notAcquiredException() {
   throw VDA5050PPSynchronizedEventNotAcquired(MK_FN_EX_CONTEXT(""));
-}
\ No newline at end of file
+}
+
+#ifdef __linux__
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t) &&
+                  std::atomic<uint32_t>::is_always_lock_free,
+              "futex waiting requires a plain 32 bit atomic word");
+
+void _SharedResultStateBase::waitOnWord(
+    std::atomic<uint32_t> &word, uint32_t expected,
+    const std::chrono::steady_clock::time_point *deadline) noexcept(true) {
+  timespec timeout{};
+  timespec *timeout_ptr = nullptr;
+
+  if (deadline != nullptr) {
+    auto remaining = *deadline - std::chrono::steady_clock::now();
+    if (remaining <= std::chrono::steady_clock::duration::zero()) {
+      return;
+    }
+    auto secs = std::chrono::duration_cast<std::chrono::seconds>(remaining);
+    timeout.tv_sec = static_cast<time_t>(secs.count());
+    timeout.tv_nsec = static_cast<long>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(remaining - secs).count());
+    timeout_ptr = &timeout;
+  }
+
+  // Returns on wake up, timeout, interrupt or if the word does not contain expected (anymore).
+  // The caller re-checks the word in any case.
+  syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAIT_PRIVATE, expected,
+          timeout_ptr, nullptr, 0);
+}
+
+void _SharedResultStateBase::wakeWord(std::atomic<uint32_t> &word) noexcept(true) {
+  syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAKE_PRIVATE, INT32_MAX, nullptr,
+          nullptr, 0);
+}
+
+#else
+
+namespace {
+
+///
+///\brief A (mutex, condition variable) pair, which is shared by all words hashing to it.
+///
+struct ParkingBucket {
+  std::mutex mutex;
+  std::condition_variable cv;
+};
+
+ParkingBucket &bucketOf(const std::atomic<uint32_t> &word) {
+  static std::array<ParkingBucket, 64> buckets;
+  return buckets[std::hash<const void *>()(&word) % buckets.size()];
+}
+
+}  // namespace
+
+void _SharedResultStateBase::waitOnWord(
+    std::atomic<uint32_t> &word, uint32_t expected,
+    const std::chrono::steady_clock::time_point *deadline) noexcept(true) {
+  auto &bucket = bucketOf(word);
+  std::unique_lock lock(bucket.mutex);
+  if (word.load(std::memory_order_acquire) != expected) {
+    return;
+  }
+  if (deadline != nullptr) {
+    bucket.cv.wait_until(lock, *deadline);
+  } else {
+    bucket.cv.wait(lock);
+  }
+}
+
+void _SharedResultStateBase::wakeWord(std::atomic<uint32_t> &word) noexcept(true) {
+  auto &bucket = bucketOf(word);
+  // Synchronize with waiters, which checked the word, but did not start waiting yet
+  { std::scoped_lock lock(bucket.mutex); }
+  bucket.cv.notify_all();
+}
+
+#endif
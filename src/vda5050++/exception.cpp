@@ -252,4 +252,19 @@ VDA5050PPBadCast::VDA5050PPBadCast(VDA5050PPErrorContext &&context) noexcept(tru
 
 std::string VDA5050PPBadCast::format() const noexcept(true) {
   return this->VDA5050PPError::formatDefault("VDA5050PPBadCast");
+}
+
+VDA5050PPJsonError::VDA5050PPJsonError(VDA5050PPErrorContext &&context) noexcept(true)
+    : VDA5050PPError(std::move(context)) {}
+
+std::string VDA5050PPJsonError::format() const noexcept(true) {
+  return this->VDA5050PPError::formatDefault("VDA5050PPJsonError");
+}
+
+VDA5050PPProtocolLimitExceeded::VDA5050PPProtocolLimitExceeded(
+    VDA5050PPErrorContext &&context) noexcept(true)
+    : VDA5050PPError(std::move(context)) {}
+
+std::string VDA5050PPProtocolLimitExceeded::format() const noexcept(true) {
+  return this->VDA5050PPError::formatDefault("VDA5050PPProtocolLimitExceeded");
 }
\ No newline at end of file
@@ -8,9 +8,48 @@
 
 #include "vda5050++/core/common/exception.h"
 #include "vda5050++/core/instance.h"
+#include "vda5050++/core/instance_scope.h"
 #include "vda5050++/core/logger.h"
 
+vda5050pp::Handle::Binding::Binding(std::shared_ptr<vda5050pp::core::Instance> instance) noexcept(
+    true)
+    : instance_(std::move(instance)),
+      scope_(std::make_unique<vda5050pp::core::InstanceScope>(this->instance_.get())) {}
+
+vda5050pp::Handle::Binding::~Binding() noexcept(true) = default;
+
+std::shared_ptr<vda5050pp::core::Instance> vda5050pp::Handle::getInstance() const noexcept(false) {
+  if (this->instance_ != nullptr) {
+    return this->instance_;
+  }
+
+  auto instance = vda5050pp::core::Instance::get().lock();
+
+  if (instance == nullptr) {
+    throw vda5050pp::VDA5050PPNotInitialized(MK_EX_CONTEXT(""));
+  }
+
+  return instance;
+}
+
+vda5050pp::Handle vda5050pp::Handle::createInstance(const vda5050pp::Config &config) noexcept(
+    false) {
+  Handle handle;
+  handle.instance_ = vda5050pp::core::Instance::create(config);
+  handle.instance_->start();
+  return handle;
+}
+
+vda5050pp::Handle::Binding vda5050pp::Handle::bind() const noexcept(true) {
+  return Binding(this->instance_);
+}
+
 void vda5050pp::Handle::initialize(const vda5050pp::Config &config) const noexcept(true) {
+  if (this->instance_ != nullptr) {
+    core::getInstanceLogger()->error("initialize() called on the Handle of a created instance.");
+    return;
+  }
+
   if (auto ptr = vda5050pp::core::Instance::init(config).lock(); ptr) {
     ptr->start();
   } else {
@@ -20,43 +59,27 @@ void vda5050pp::Handle::initialize(const vda5050pp::Config &config) const noexce
 
 void vda5050pp::Handle::registerActionHandler(
     std::shared_ptr<vda5050pp::handler::BaseActionHandler> action_handler) const noexcept(false) {
-  auto instance = vda5050pp::core::Instance::get().lock();
-
-  if (instance == nullptr) {
-    throw vda5050pp::VDA5050PPNotInitialized(MK_EX_CONTEXT(""));
-  }
-
-  instance->addActionHandler(action_handler);
+  this->getInstance()->addActionHandler(action_handler);
 }
 
 void vda5050pp::Handle::registerNavigationHandler(
     std::shared_ptr<vda5050pp::handler::BaseNavigationHandler> navigation_handler) const
     noexcept(false) {
-  auto instance = vda5050pp::core::Instance::get().lock();
-
-  if (instance == nullptr) {
-    throw vda5050pp::VDA5050PPNotInitialized(MK_EX_CONTEXT(""));
-  }
-
-  instance->setNavigationHandler(navigation_handler);
+  this->getInstance()->setNavigationHandler(navigation_handler);
 }
 
 void vda5050pp::Handle::registerQueryHandler(
     std::shared_ptr<vda5050pp::handler::BaseQueryHandler> query_handler) const noexcept(false) {
-  auto instance = vda5050pp::core::Instance::get().lock();
-
-  if (instance == nullptr) {
-    throw vda5050pp::VDA5050PPNotInitialized(MK_EX_CONTEXT(""));
-  }
-
-  instance->setQueryHandler(query_handler);
+  this->getInstance()->setQueryHandler(query_handler);
 }
 
 vda5050pp::sinks::StatusSink vda5050pp::Handle::getStatusSink() const {
+  vda5050pp::core::InstanceScope scope(this->instance_.get());
   return vda5050pp::sinks::StatusSink();
 }
 
 vda5050pp::sinks::NavigationSink vda5050pp::Handle::getNavigationSink() const {
+  vda5050pp::core::InstanceScope scope(this->instance_.get());
   return vda5050pp::sinks::NavigationSink();
 }
 
@@ -67,6 +90,12 @@ std::shared_ptr<spdlog::logger> vda5050pp::Handle::getLogger(std::string_view ke
 #endif
 
 void vda5050pp::Handle::shutdown() const noexcept(false) {
+  if (this->instance_ != nullptr) {
+    this->instance_->stop();
+    this->instance_->deinitialize();
+    return;
+  }
+
   if (auto ptr = vda5050pp::core::Instance::get().lock(); ptr) {
     ptr->stop();
   } else {
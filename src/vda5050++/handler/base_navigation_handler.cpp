@@ -11,16 +11,18 @@
 
 #include "vda5050++/core/instance.h"
 #include "vda5050++/core/logger.h"
+#include "vda5050++/misc/pool_allocator.h"
 
 using namespace std::chrono_literals;
 
 using namespace vda5050pp::handler;
 
 static void dispatchStatusControl(vda5050pp::events::NavigationStatusControlType type) {
-  auto event = std::make_shared<vda5050pp::events::NavigationStatusControl>();
+  auto event = vda5050pp::misc::makePooled<vda5050pp::events::NavigationStatusControl>();
   event->type = type;
 
-  vda5050pp::core::Instance::ref().getNavigationStatusManager().dispatch(event);
+  vda5050pp::core::Instance::resolve(this->instance_)->getNavigationStatusManager().dispatch(
+      event);
 }
 
 void BaseNavigationHandler::setPaused() const {
@@ -40,20 +42,22 @@ void BaseNavigationHandler::setNodeReached(const vda5050::Node &node) const noex
 }
 
 void BaseNavigationHandler::setNodeReached(uint32_t node_seq) const noexcept(false) {
-  auto event = std::make_shared<vda5050pp::events::NavigationStatusNodeReached>();
+  auto event = vda5050pp::misc::makePooled<vda5050pp::events::NavigationStatusNodeReached>();
   event->node_seq_id = node_seq;
 
-  vda5050pp::core::Instance::ref().getNavigationStatusManager().dispatch(event);
+  vda5050pp::core::Instance::resolve(this->instance_)->getNavigationStatusManager().dispatch(
+      event);
 }
 
 bool BaseNavigationHandler::evalPosition(const vda5050::AGVPosition &position) const
     noexcept(false) {
-  auto event = std::make_shared<vda5050pp::events::NavigationStatusPosition>();
+  auto event = vda5050pp::misc::makePooled<vda5050pp::events::NavigationStatusPosition>();
   event->position = position;
   event->auto_check_node_reached = true;
-  auto has_reached_node = event->getFuture();
+  auto has_reached_node = event->getSynchronizedFuture();
 
-  vda5050pp::core::Instance::ref().getNavigationStatusManager().dispatch(event);
+  vda5050pp::core::Instance::resolve(this->instance_)->getNavigationStatusManager().dispatch(
+      event);
 
   if (has_reached_node.wait_for(1s) == std::future_status::timeout) {
     core::getAGVHandlerLogger()->error(
@@ -92,11 +96,12 @@ bool BaseNavigationHandler::evalPosition(double x, double y, double theta, std::
 
 void BaseNavigationHandler::setPosition(const vda5050::AGVPosition &position) const
     noexcept(false) {
-  auto event = std::make_shared<vda5050pp::events::NavigationStatusPosition>();
+  auto event = vda5050pp::misc::makePooled<vda5050pp::events::NavigationStatusPosition>();
   event->position = position;
   event->auto_check_node_reached = false;
 
-  vda5050pp::core::Instance::ref().getNavigationStatusManager().dispatch(event);
+  vda5050pp::core::Instance::resolve(this->instance_)->getNavigationStatusManager().dispatch(
+      event);
 }
 
 void BaseNavigationHandler::setPosition(double x, double y, double theta,
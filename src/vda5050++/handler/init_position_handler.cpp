@@ -8,11 +8,12 @@
 
 #include "vda5050++/core/instance.h"
 #include "vda5050++/misc/action_declarations.h"
+#include "vda5050++/misc/pool_allocator.h"
 
 using namespace vda5050pp::handler;
 
 void InitPositionHandler::setLastNodeId(std::string_view last_node_id) const {
-  auto evt = std::make_shared<vda5050pp::events::NavigationStatusNodeReached>();
+  auto evt = vda5050pp::misc::makePooled<vda5050pp::events::NavigationStatusNodeReached>();
   evt->last_node_id = last_node_id;
   evt->node_seq_id = std::nullopt;
 
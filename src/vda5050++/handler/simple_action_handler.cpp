@@ -25,4 +25,10 @@ vda5050pp::handler::ValidationResult SimpleActionHandler::validate(
 
 std::list<vda5050::AgvAction> SimpleActionHandler::getActionDescription() const noexcept(false) {
   return {vda5050pp::core::common::fromActionDeclaration(this->decl_)};
-}
\ No newline at end of file
+}
+
+bool SimpleActionHandler::isThreadSafe() const noexcept(true) { return true; }
+
+std::optional<std::vector<std::string>> SimpleActionHandler::getHandledActionTypes() const {
+  return std::vector{this->decl_.action_type};
+}
@@ -60,4 +60,17 @@ std::list<vda5050::AgvAction> SimpleMultiActionHandler::getActionDescription() c
                  std::back_inserter(actions), &vda5050pp::core::common::fromActionDeclaration);
 
   return actions;
-}
\ No newline at end of file
+}
+
+bool SimpleMultiActionHandler::isThreadSafe() const noexcept(true) { return true; }
+
+std::optional<std::vector<std::string>> SimpleMultiActionHandler::getHandledActionTypes() const {
+  std::vector<std::string> action_types;
+  action_types.reserve(this->declarations_.size());
+
+  std::transform(this->declarations_.begin(), this->declarations_.end(),
+                 std::back_inserter(action_types),
+                 [](const auto &decl) { return decl.action_type; });
+
+  return action_types;
+}
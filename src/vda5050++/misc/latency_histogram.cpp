@@ -0,0 +1,71 @@
+//  Copyright Open Logistics Foundation
+//
+//  Licensed under the Open Logistics Foundation License 1.3.
+//  For details on the licensing terms, see the LICENSE file.
+//  SPDX-License-Identifier: OLFL-1.3
+//
+
+#include "vda5050++/misc/latency_histogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace vda5050pp::misc;
+
+LatencyHistogram::LatencyHistogram() : counts_(k_buckets, 0) {}
+
+LatencyHistogram::LatencyHistogram(std::vector<uint64_t> counts, uint64_t min, uint64_t max,
+                                   uint64_t sum)
+    : counts_(std::move(counts)), min_(min), max_(max), sum_(sum) {
+  this->counts_.resize(k_buckets, 0);
+  for (auto c : this->counts_) {
+    this->count_ += c;
+  }
+  if (this->count_ == 0) {
+    this->min_ = 0;
+    this->max_ = 0;
+    this->sum_ = 0;
+  }
+}
+
+uint64_t LatencyHistogram::getCount() const noexcept(true) { return this->count_; }
+
+std::chrono::nanoseconds LatencyHistogram::getMin() const noexcept(true) {
+  return std::chrono::nanoseconds(this->min_);
+}
+
+std::chrono::nanoseconds LatencyHistogram::getMax() const noexcept(true) {
+  return std::chrono::nanoseconds(this->max_);
+}
+
+std::chrono::nanoseconds LatencyHistogram::getMean() const noexcept(true) {
+  if (this->count_ == 0) {
+    return std::chrono::nanoseconds(0);
+  }
+  return std::chrono::nanoseconds(this->sum_ / this->count_);
+}
+
+std::chrono::nanoseconds LatencyHistogram::getPercentile(double percentile) const noexcept(true) {
+  if (this->count_ == 0) {
+    return std::chrono::nanoseconds(0);
+  }
+
+  auto fraction = std::clamp(percentile, 0.0, 100.0) / 100.0;
+  auto rank = uint64_t(std::ceil(fraction * static_cast<double>(this->count_)));
+  rank = std::max<uint64_t>(rank, 1);
+
+  uint64_t seen = 0;
+  for (std::size_t i = 0; i < this->counts_.size(); i++) {
+    seen += this->counts_[i];
+    if (seen >= rank) {
+      return std::chrono::nanoseconds(
+          std::clamp(LatencyHistogram::bucketUpperBound(i), this->min_, this->max_));
+    }
+  }
+
+  return std::chrono::nanoseconds(this->max_);
+}
+
+const std::vector<uint64_t> &LatencyHistogram::getBuckets() const noexcept(true) {
+  return this->counts_;
+}
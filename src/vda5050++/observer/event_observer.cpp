@@ -0,0 +1,100 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+#include "vda5050++/observer/event_observer.h"
+
+#include <eventpp/utilities/scopedremover.h>
+
+#include <functional>
+#include <list>
+
+#include "vda5050++/core/instance.h"
+
+using namespace vda5050pp::observer;
+
+namespace {
+
+///
+///\brief The private state of the EventObserver (stored with type vanishing)
+///
+struct EventObserverState {
+  std::list<eventpp::ScopedRemover<
+      vda5050pp::core::common::EventStatisticsRecorder::OverflowCallbackList>>
+      overflow_removers;
+  // The instance bound at construction (empty: the default instance)
+  std::weak_ptr<vda5050pp::core::Instance> instance;
+};
+
+}  // namespace
+
+static std::vector<std::reference_wrapper<const vda5050pp::core::common::EventStatisticsRecorder>>
+getRecorders(const vda5050pp::misc::AnyPtr &opaque_state) {
+  auto instance_ptr =
+      vda5050pp::core::Instance::resolve(opaque_state.get<EventObserverState>()->instance);
+  auto &instance = *instance_ptr;
+
+  return {
+      instance.getActionEventManager().getStatisticsRecorder(),
+      instance.getActionStatusManager().getStatisticsRecorder(),
+      instance.getNavigationEventManager().getStatisticsRecorder(),
+      instance.getNavigationStatusManager().getStatisticsRecorder(),
+      instance.getStatusEventManager().getStatisticsRecorder(),
+      instance.getQueryEventManager().getStatisticsRecorder(),
+      instance.getControlEventManager().getStatisticsRecorder(),
+      instance.getFactsheetEventManager().getStatisticsRecorder(),
+      instance.getInterpreterEventManager().getStatisticsRecorder(),
+      instance.getMessageEventManager().getStatisticsRecorder(),
+      instance.getOrderEventManager().getStatisticsRecorder(),
+      instance.getStateEventManager().getStatisticsRecorder(),
+      instance.getValidationEventManager().getStatisticsRecorder(),
+  };
+}
+
+EventObserver::EventObserver() {
+  // Fail early, if there is no instance
+  vda5050pp::core::Instance::ref();
+  auto state = std::make_shared<EventObserverState>();
+  state->instance = vda5050pp::core::Instance::threadBinding();
+  this->opaque_state_ = state;
+}
+
+bool EventObserver::isEnabled() {
+#ifdef LIBVDA5050PP_EVENT_INSTRUMENTATION
+  return true;
+#else
+  return false;
+#endif
+}
+
+std::vector<EventStatistics> EventObserver::getStatistics() const {
+  std::vector<EventStatistics> ret;
+
+  for (const auto &recorder : getRecorders(this->opaque_state_)) {
+    auto stats = recorder.get().snapshot();
+    ret.insert(ret.end(), std::make_move_iterator(stats.begin()),
+               std::make_move_iterator(stats.end()));
+  }
+
+  return ret;
+}
+
+std::vector<EventStatistics> EventObserver::getStatistics(std::string_view manager) const {
+  for (const auto &recorder : getRecorders(this->opaque_state_)) {
+    if (recorder.get().getManagerName() == manager) {
+      return recorder.get().snapshot();
+    }
+  }
+
+  return {};
+}
+
+void EventObserver::onQueueOverflow(std::function<void(const QueueOverflow &)> callback) {
+  auto &state = *this->opaque_state_.get<EventObserverState>();
+
+  for (const auto &recorder : getRecorders(this->opaque_state_)) {
+    state.overflow_removers.emplace_back(recorder.get().overflowCallbacks()).append(callback);
+  }
+}
@@ -7,21 +7,35 @@
 #include "vda5050++/observer/message_observer.h"
 
 #include "vda5050++/core/instance.h"
+#include "vda5050++/core/messages/mqtt_module.h"
 
 using namespace vda5050pp::observer;
 
 struct OpaqueState {
   vda5050pp::core::GenericEventManager<vda5050pp::core::events::MessageEvent>::ScopedSubscriber
       message_event_subscriber;
+  // The observed instance
+  std::weak_ptr<vda5050pp::core::Instance> instance;
 };
 
 inline OpaqueState &getOpaqueState(vda5050pp::misc::AnyPtr &opaque_state) {
   return *opaque_state.get<OpaqueState>();
 }
 
+static std::shared_ptr<vda5050pp::core::messages::MqttModule> getMqttModule(
+    const vda5050pp::misc::AnyPtr &opaque_state) {
+  auto instance = opaque_state.get<OpaqueState>()->instance.lock();
+  if (instance == nullptr) {
+    return nullptr;
+  }
+  return std::dynamic_pointer_cast<vda5050pp::core::messages::MqttModule>(
+      instance->getModule(vda5050pp::core::module_keys::k_mqtt_key).lock());
+}
+
 MessageObserver::MessageObserver() {
-  auto opaque_state = std::make_shared<OpaqueState>(
-      OpaqueState{vda5050pp::core::Instance::ref().getMessageEventManager().getScopedSubscriber()});
+  auto &instance = vda5050pp::core::Instance::ref();
+  auto opaque_state = std::make_shared<OpaqueState>(OpaqueState{
+      instance.getMessageEventManager().getScopedSubscriber(), instance.weak_from_this()});
 
   opaque_state->message_event_subscriber.subscribe<vda5050pp::core::events::ValidOrderMessageEvent>(
       [this](std::shared_ptr<vda5050pp::core::events::ValidOrderMessageEvent>) {
@@ -92,6 +106,23 @@ std::optional<vda5050pp::misc::ConnectionStatus> MessageObserver::getConnectionS
   return this->connection_status_;
 }
 
+std::optional<vda5050pp::misc::OutboundBufferStatistics>
+MessageObserver::getOutboundBufferStatistics() const {
+  auto module = getMqttModule(this->opaque_state_);
+  if (module == nullptr) {
+    return std::nullopt;
+  }
+  return module->getOutboundBufferStatistics();
+}
+
+std::vector<PublishStatistics> MessageObserver::getPublishStatistics() const {
+  auto module = getMqttModule(this->opaque_state_);
+  if (module == nullptr) {
+    return {};
+  }
+  return module->getPublishStatistics();
+}
+
 void MessageObserver::onValidOrderMessage(
     std::function<void(std::shared_ptr<const vda5050::Order>)> callback) {
   getOpaqueState(this->opaque_state_)
@@ -0,0 +1,118 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+//
+// This file contains a benchmark for the latency of control events under load
+//
+
+#include <algorithm>
+#include <catch2/catch_all.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <iostream>
+#include <mutex>
+
+#include "vda5050++/core/generic_event_manager.h"
+
+namespace {
+
+enum class LoadEventType {
+  k_load,
+  k_cancel,
+};
+
+struct LoadEventBase : vda5050pp::events::Event<LoadEventType> {};
+
+struct LoadEvent : vda5050pp::events::EventId<LoadEventBase, LoadEventType::k_load> {};
+
+struct CancelEvent : vda5050pp::events::EventId<LoadEventBase, LoadEventType::k_cancel> {
+  std::promise<std::chrono::steady_clock::time_point> handled;
+};
+
+constexpr std::size_t k_load_events = 500;
+constexpr auto k_load_work = std::chrono::microseconds(20);
+constexpr std::size_t k_rounds = 20;
+
+struct LatencyResult {
+  std::chrono::microseconds mean{0};
+  std::chrono::microseconds max{0};
+};
+
+///
+///\brief Measure the time from dispatching a CancelEvent behind k_load_events pending events until
+/// it is handled.
+///
+LatencyResult measureCancelLatency(vda5050pp::core::EventPriority cancel_priority,
+                                   vda5050pp::core::EventPriority load_priority) {
+  vda5050pp::config::EventManagerOptions opts;
+  vda5050pp::core::GenericEventManager<LoadEventBase> mgr(opts);
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::size_t handled_load = 0;
+
+  auto sub = mgr.getScopedSubscriber();
+  sub.subscribe<LoadEvent>([&](std::shared_ptr<LoadEvent>) {
+    auto until = std::chrono::steady_clock::now() + k_load_work;
+    while (std::chrono::steady_clock::now() < until) {
+      // simulate work
+    }
+    std::unique_lock lock(mutex);
+    handled_load++;
+    cv.notify_all();
+  });
+  sub.subscribe<CancelEvent>([](std::shared_ptr<CancelEvent> evt) {
+    evt->handled.set_value(std::chrono::steady_clock::now());
+  });
+
+  LatencyResult result;
+  std::chrono::steady_clock::duration sum{0};
+
+  for (std::size_t round = 0; round < k_rounds; round++) {
+    for (std::size_t i = 0; i < k_load_events; i++) {
+      mgr.dispatch(std::make_shared<LoadEvent>(), load_priority);
+    }
+
+    auto cancel = std::make_shared<CancelEvent>();
+    auto handled = cancel->handled.get_future();
+    auto dispatched = std::chrono::steady_clock::now();
+    mgr.dispatch(cancel, cancel_priority);
+
+    auto latency = handled.get() - dispatched;
+    sum += latency;
+    result.max = std::max(result.max,
+                          std::chrono::duration_cast<std::chrono::microseconds>(latency));
+
+    // Drain the load before the next round
+    std::unique_lock lock(mutex);
+    cv.wait(lock, [&] { return handled_load == (round + 1) * k_load_events; });
+  }
+
+  result.mean = std::chrono::duration_cast<std::chrono::microseconds>(sum / k_rounds);
+  return result;
+}
+
+}  // namespace
+
+TEST_CASE("benchmark::GenericEventManager cancel latency under load", "[benchmark][priority]") {
+  using vda5050pp::core::EventPriority;
+
+  auto normal = measureCancelLatency(EventPriority::k_normal, EventPriority::k_normal);
+  auto control = measureCancelLatency(EventPriority::k_control, EventPriority::k_normal);
+  auto control_bulk = measureCancelLatency(EventPriority::k_control, EventPriority::k_bulk);
+
+  std::cout << "Cancel latency behind " << k_load_events << " pending events:\n"
+            << "  normal lane:                 mean " << normal.mean.count() << "us, max "
+            << normal.max.count() << "us\n"
+            << "  control lane:                mean " << control.mean.count() << "us, max "
+            << control.max.count() << "us\n"
+            << "  control lane (bulk load):    mean " << control_bulk.mean.count() << "us, max "
+            << control_bulk.max.count() << "us\n";
+
+  CHECK(control.mean < normal.mean);
+  CHECK(control_bulk.mean < normal.mean);
+}
@@ -0,0 +1,79 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+//
+// This file contains benchmarks for the event queue policies
+//
+
+#include <catch2/catch_all.hpp>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "vda5050++/core/common/event_queue_policy.h"
+
+namespace {
+
+struct BenchmarkEvent {
+  int payload = 0;
+};
+
+constexpr int k_id = 1;
+constexpr std::size_t k_events_per_producer = 20000;
+
+///
+///\brief Enqueue k_events_per_producer events from each producer thread, while a single
+/// consumer processes the queue (like the Strand of an event manager).
+///
+template <typename Queue> std::size_t produceAndConsume(std::size_t producers) {
+  Queue queue;
+  std::size_t received = 0;
+  queue.appendListener(k_id, [&received](std::shared_ptr<BenchmarkEvent>) { received++; });
+
+  auto evt = std::make_shared<BenchmarkEvent>();
+  std::vector<std::thread> threads;
+  for (std::size_t p = 0; p < producers; p++) {
+    threads.emplace_back([&queue, evt] {
+      for (std::size_t i = 0; i < k_events_per_producer; i++) {
+        queue.enqueue(k_id, evt);
+      }
+    });
+  }
+
+  const std::size_t expected = producers * k_events_per_producer;
+  while (received < expected) {
+    if (!queue.process()) {
+      std::this_thread::yield();
+    }
+  }
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  return received;
+}
+
+template <typename Policy>
+using BenchmarkQueue = typename Policy::template Queue<int, std::shared_ptr<BenchmarkEvent>>;
+
+}  // namespace
+
+TEST_CASE("benchmark::EventQueuePolicy multi producer throughput", "[benchmark][EventQueue]") {
+  using vda5050pp::core::common::EventppQueuePolicy;
+  using vda5050pp::core::common::RingBufferQueuePolicy;
+
+  for (std::size_t producers : {1, 2, 4, 8}) {
+    DYNAMIC_SECTION(producers << " producer(s)") {
+      BENCHMARK("eventpp::EventQueue") {
+        return produceAndConsume<BenchmarkQueue<EventppQueuePolicy>>(producers);
+      };
+      BENCHMARK("RingBufferEventQueue") {
+        return produceAndConsume<BenchmarkQueue<RingBufferQueuePolicy>>(producers);
+      };
+    }
+  }
+}
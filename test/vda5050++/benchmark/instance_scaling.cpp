@@ -0,0 +1,174 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+//
+// This file contains a benchmark of several instances in one process. Each instance runs on
+// an own LoopbackTransport. It sweeps the number of instances and reports the memory, thread and
+// CPU usage per instance with own and with shared worker pools.
+//
+
+#include <sys/resource.h>
+
+#include <catch2/catch_all.hpp>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "vda5050++/core/instance.h"
+#include "vda5050++/core/messages/loopback_transport.h"
+#include "vda5050++/core/messages/mqtt_module.h"
+#include "vda5050++/version.h"
+
+namespace {
+
+using vda5050pp::core::messages::LoopbackTransport;
+
+constexpr std::size_t k_max_instances = 64;
+constexpr auto k_idle = std::chrono::seconds(1);
+constexpr auto k_timeout = std::chrono::seconds(5);
+
+struct ProcessUsage {
+  std::size_t rss_kb = 0;
+  std::size_t threads = 0;
+};
+
+ProcessUsage readProcessUsage() {
+  ProcessUsage usage;
+  std::ifstream status("/proc/self/status");
+  std::string key;
+  while (status >> key) {
+    if (key == "VmRSS:") {
+      status >> usage.rss_kb;
+    } else if (key == "Threads:") {
+      status >> usage.threads;
+    }
+    status.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+  }
+  return usage;
+}
+
+std::chrono::microseconds cpuTime() {
+  rusage usage{};
+  getrusage(RUSAGE_SELF, &usage);
+  auto tv = [](const timeval &t) {
+    return std::chrono::seconds(t.tv_sec) + std::chrono::microseconds(t.tv_usec);
+  };
+  return tv(usage.ru_utime) + tv(usage.ru_stime);
+}
+
+struct RunningInstance {
+  std::shared_ptr<vda5050pp::core::Instance> instance;
+  std::shared_ptr<LoopbackTransport> transport;
+  std::string serial;
+};
+
+RunningInstance startInstance(std::size_t n, bool share_worker_pool) {
+  RunningInstance running;
+  running.serial = "serial_" + std::to_string(n);
+  running.transport = std::make_shared<LoopbackTransport>();
+
+  vda5050pp::Config cfg;
+  cfg.refAgvDescription().agv_id = "agv_" + std::to_string(n);
+  cfg.refAgvDescription().manufacturer = "benchmark_manufacturer";
+  cfg.refAgvDescription().serial_number = running.serial;
+  cfg.refGlobalConfig().setLogLevel(vda5050pp::config::LogLevel::k_off);
+  cfg.refGlobalConfig().refEventManagerOptions().worker_pool_size = 4;
+  cfg.refGlobalConfig().refEventManagerOptions().share_worker_pool = share_worker_pool;
+
+  running.instance = vda5050pp::core::Instance::create(cfg);
+  auto module = std::dynamic_pointer_cast<vda5050pp::core::messages::MqttModule>(
+      running.instance->getModule(vda5050pp::core::module_keys::k_mqtt_key).lock());
+  REQUIRE(module != nullptr);
+  module->useTransport(running.transport);
+  running.instance->start();
+  REQUIRE(running.transport->waitForCaptured("state", 1, k_timeout));
+  return running;
+}
+
+vda5050::Order mkOrder(const std::string &serial) {
+  vda5050::Order order;
+  order.header.timestamp = std::chrono::system_clock::now();
+  order.header.manufacturer = "benchmark_manufacturer";
+  order.header.serialNumber = serial;
+  order.header.version = std::string(vda5050pp::version::getCurrentVersion());
+  order.orderId = "order_" + serial;
+
+  auto &node = order.nodes.emplace_back();
+  node.nodeId = "node_0";
+  node.sequenceId = 0;
+  node.released = true;
+  return order;
+}
+
+void run(std::size_t n_instances, bool share_worker_pool) {
+  auto before = readProcessUsage();
+
+  std::vector<RunningInstance> instances;
+  instances.reserve(n_instances);
+  for (std::size_t n = 0; n < n_instances; n++) {
+    instances.push_back(startInstance(n, share_worker_pool));
+  }
+  auto started = readProcessUsage();
+
+  // Idle CPU usage (timers only)
+  auto cpu_start = cpuTime();
+  std::this_thread::sleep_for(k_idle);
+  auto idle_cpu = cpuTime() - cpu_start;
+
+  // One order per instance at once, until every instance published the resulting state
+  for (auto &running : instances) {
+    running.transport->takeCaptured();
+  }
+  auto start = LoopbackTransport::Clock::now();
+  for (auto &running : instances) {
+    running.transport->injectOrder(mkOrder(running.serial));
+  }
+  for (auto &running : instances) {
+    REQUIRE(running.transport->waitForCaptured("state", 1, k_timeout));
+  }
+  auto all_orders = std::chrono::duration_cast<std::chrono::microseconds>(
+      LoopbackTransport::Clock::now() - start);
+
+  // The RSS may shrink (i.e. freed memory of a previous run), so the differences are signed
+  auto rss_kb = static_cast<int64_t>(started.rss_kb) - static_cast<int64_t>(before.rss_kb);
+  auto threads = static_cast<int64_t>(started.threads) - static_cast<int64_t>(before.threads);
+  auto per_instance = [n_instances](int64_t value) {
+    return double(value) / double(n_instances);
+  };
+  auto idle_cpu_per_second =
+      double(idle_cpu.count()) / std::chrono::duration<double>(k_idle).count();
+
+  std::cout << std::setw(4) << n_instances << std::setw(8)
+            << (share_worker_pool ? "shared" : "own") << std::fixed << std::setprecision(1)
+            << std::setw(13) << per_instance(rss_kb) << std::setw(10) << per_instance(threads)
+            << std::setw(15) << idle_cpu_per_second << std::setw(14) << all_orders.count()
+            << "\n";
+
+  for (auto &running : instances) {
+    running.instance->stop();
+  }
+}
+
+}  // namespace
+
+TEST_CASE("benchmark::Instance scaling with own and shared worker pools",
+          "[benchmark][instance]") {
+  vda5050pp::core::Instance::reset();
+
+  std::cout << "   N    pool  kB RSS/inst  thr/inst  idle CPU us/s  order (N) us\n";
+  for (auto share_worker_pool : {false, true}) {
+    for (std::size_t n = 1; n <= k_max_instances; n *= 2) {
+      run(n, share_worker_pool);
+    }
+  }
+}
@@ -0,0 +1,126 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+//
+// This file contains an end-to-end benchmark from a received order until the state reporting it
+// is published. It runs on the LoopbackTransport, so there is no broker in the measurement.
+//
+
+#include <algorithm>
+#include <catch2/catch_all.hpp>
+#include <chrono>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "vda5050++/core/instance.h"
+#include "vda5050++/core/messages/loopback_transport.h"
+#include "vda5050++/core/messages/mqtt_module.h"
+#include "vda5050++/version.h"
+
+namespace {
+
+using vda5050pp::core::messages::LoopbackTransport;
+
+constexpr std::size_t k_rounds = 200;
+constexpr std::size_t k_burst = 200;
+constexpr auto k_timeout = std::chrono::seconds(5);
+
+vda5050::Order mkOrder(const std::string &order_id, uint32_t header_id) {
+  vda5050::Order order;
+  order.header.headerId = header_id;
+  order.header.timestamp = std::chrono::system_clock::now();
+  order.header.manufacturer = "benchmark_manufacturer";
+  order.header.serialNumber = "benchmark_serial";
+  order.header.version = std::string(vda5050pp::version::getCurrentVersion());
+  order.orderId = order_id;
+
+  auto &node = order.nodes.emplace_back();
+  node.nodeId = "node_0";
+  node.sequenceId = 0;
+  node.released = true;
+  return order;
+}
+
+///
+///\brief Wait until a state mentioning the order id was captured (accepted or rejected).
+///
+///\return the publish time of that state
+///
+std::optional<LoopbackTransport::Clock::time_point> waitForState(LoopbackTransport &transport,
+                                                                 const std::string &order_id) {
+  auto deadline = LoopbackTransport::Clock::now() + k_timeout;
+  auto needle = "\"" + order_id + "\"";
+
+  while (LoopbackTransport::Clock::now() < deadline) {
+    transport.waitForCaptured("state", 1, std::chrono::milliseconds(10));
+    for (const auto &capture : transport.takeCaptured()) {
+      if (capture.topic.find("/state") != std::string::npos &&
+          capture.payload.find(needle) != std::string::npos) {
+        return capture.timestamp;
+      }
+    }
+  }
+  return std::nullopt;
+}
+
+}  // namespace
+
+TEST_CASE("benchmark::Loopback order to state latency and throughput", "[benchmark][loopback]") {
+  vda5050pp::Config cfg;
+  cfg.refAgvDescription().agv_id = "benchmark_agv";
+  cfg.refAgvDescription().manufacturer = "benchmark_manufacturer";
+  cfg.refAgvDescription().serial_number = "benchmark_serial";
+  cfg.refGlobalConfig().setLogLevel(vda5050pp::config::LogLevel::k_off);
+  vda5050pp::core::Instance::reset();
+  vda5050pp::core::Instance::init(cfg);
+
+  auto transport = std::make_shared<LoopbackTransport>();
+  auto module = std::dynamic_pointer_cast<vda5050pp::core::messages::MqttModule>(
+      vda5050pp::core::Instance::lookupModule(vda5050pp::core::module_keys::k_mqtt_key).lock());
+  REQUIRE(module != nullptr);
+  module->useTransport(transport);
+  module->connect();
+  transport->takeCaptured();
+
+  uint32_t header_id = 0;
+
+  // Latency: one order at a time
+  std::vector<LoopbackTransport::Clock::duration> latencies;
+  latencies.reserve(k_rounds);
+  for (std::size_t i = 0; i < k_rounds; i++) {
+    auto order_id = "latency_" + std::to_string(i);
+    auto injected = transport->injectOrder(mkOrder(order_id, header_id++));
+    auto published = waitForState(*transport, order_id);
+    REQUIRE(published.has_value());
+    latencies.push_back(*published - injected);
+  }
+  std::sort(latencies.begin(), latencies.end());
+
+  // Throughput: a burst of orders, until the state of the last one was published
+  auto start = LoopbackTransport::Clock::now();
+  std::string last_id;
+  for (std::size_t i = 0; i < k_burst; i++) {
+    last_id = "burst_" + std::to_string(i);
+    transport->injectOrder(mkOrder(last_id, header_id++));
+  }
+  auto done = waitForState(*transport, last_id);
+  REQUIRE(done.has_value());
+  auto burst_duration = std::chrono::duration<double>(*done - start);
+
+  auto us = [](LoopbackTransport::Clock::duration d) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(d).count();
+  };
+  std::cout << "Order to state over the LoopbackTransport (" << k_rounds << " orders):\n"
+            << "  latency p50 " << us(latencies[k_rounds / 2]) << "us, p99 "
+            << us(latencies[k_rounds * 99 / 100]) << "us, max " << us(latencies.back()) << "us\n"
+            << "  burst of " << k_burst << " orders: "
+            << std::size_t(double(k_burst) / burst_duration.count()) << " orders/s\n";
+
+  module->disconnect();
+  vda5050pp::core::Instance::reset();
+}
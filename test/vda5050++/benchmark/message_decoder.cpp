@@ -0,0 +1,79 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+//
+// This file contains benchmarks for decoding incoming messages
+//
+
+#include <catch2/catch_all.hpp>
+#include <string>
+
+#include "vda5050++/core/messages/message_decoder.h"
+
+namespace {
+
+///
+///\brief Make the payload of an order with the given number of nodes, each node and edge
+/// carrying one action with two parameters.
+///
+std::string mkOrderPayload(std::size_t n_nodes) {
+  auto mk_action = [](std::string_view id) {
+    vda5050::Action action;
+    action.actionId = id;
+    action.actionType = "pick";
+    action.blockingType = vda5050::BlockingType::HARD;
+    action.actionParameters = {{"station", "\"s1\""}, {"height", "1.5"}};
+    return action;
+  };
+
+  vda5050::Order order;
+  order.header.timestamp = std::chrono::system_clock::now();
+  order.orderId = "order";
+
+  for (std::size_t i = 0; i < n_nodes; i++) {
+    auto &node = order.nodes.emplace_back();
+    node.nodeId = "node_" + std::to_string(i);
+    node.sequenceId = uint32_t(2 * i);
+    node.released = true;
+    node.nodePosition.emplace();
+    node.nodePosition->x = double(i) * 1.5;
+    node.nodePosition->y = double(i) * -0.25;
+    node.nodePosition->mapId = "map";
+    node.actions.push_back(mk_action("node_action_" + std::to_string(i)));
+
+    if (i > 0) {
+      auto &edge = order.edges.emplace_back();
+      edge.edgeId = "edge_" + std::to_string(i);
+      edge.sequenceId = uint32_t(2 * i - 1);
+      edge.released = true;
+      edge.startNodeId = "node_" + std::to_string(i - 1);
+      edge.endNodeId = node.nodeId;
+      edge.maxSpeed = 1.0;
+      edge.actions.push_back(mk_action("edge_action_" + std::to_string(i)));
+    }
+  }
+
+  return vda5050::json(order).dump();
+}
+
+}  // namespace
+
+TEST_CASE("benchmark::decode Order", "[benchmark][messages]") {
+  for (std::size_t n_nodes : {1, 10, 100}) {
+    auto payload = mkOrderPayload(n_nodes);
+
+    DYNAMIC_SECTION(n_nodes << " node(s), " << payload.size() << " bytes") {
+      BENCHMARK("vda5050::json::parse") {
+        return vda5050::json::parse(payload).get<vda5050::Order>();
+      };
+      BENCHMARK("core::messages::decode") {
+        vda5050::Order order;
+        vda5050pp::core::messages::decode(payload, order);
+        return order;
+      };
+    }
+  }
+}
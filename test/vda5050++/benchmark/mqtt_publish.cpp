@@ -0,0 +1,160 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+//
+// This file contains a benchmark for the publish throughput and latency of each MQTT QoS level.
+// It needs a local broker (VDA5050PP_BENCHMARK_BROKER, default tcp://localhost:1883).
+//
+
+#include <mqtt/async_client.h>
+
+#include <algorithm>
+#include <catch2/catch_all.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t k_messages = 2000;
+// Roughly the size of an encoded state with a short order
+constexpr std::size_t k_payload_size = 2048;
+constexpr int k_max_inflight = 64;
+
+struct PublishResult {
+  double messages_per_second = 0;
+  std::chrono::microseconds mean_latency{0};
+  std::chrono::microseconds max_latency{0};
+};
+
+std::string getBroker() {
+  const char *broker = std::getenv("VDA5050PP_BENCHMARK_BROKER");
+  return broker != nullptr ? broker : "tcp://localhost:1883";
+}
+
+///
+///\brief Publish k_messages on a topic, the same client is subscribed to, and measure the time
+/// from each publish until the message arrives again.
+///
+std::optional<PublishResult> measurePublish(int qos,
+                                            const std::optional<std::string> &persistence_dir) {
+  using Clock = std::chrono::steady_clock;
+
+  auto client_id = "vda5050pp_benchmark_qos" + std::to_string(qos);
+  std::unique_ptr<mqtt::async_client> client;
+  if (persistence_dir) {
+    client = std::make_unique<mqtt::async_client>(getBroker(), client_id, *persistence_dir);
+  } else {
+    client = std::make_unique<mqtt::async_client>(getBroker(), client_id);
+  }
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::vector<Clock::time_point> sent(k_messages);
+  std::vector<Clock::time_point> received(k_messages);
+  std::size_t received_count = 0;
+
+  client->set_message_callback([&](mqtt::const_message_ptr msg) {
+    auto now = Clock::now();
+    auto idx = std::stoul(msg->get_payload_str().substr(0, msg->get_payload_str().find(':')));
+    std::unique_lock lock(mutex);
+    received[idx] = now;
+    received_count++;
+    cv.notify_all();
+  });
+
+  mqtt::connect_options opts;
+  opts.set_clean_session(true);
+  opts.set_max_inflight(k_max_inflight);
+  try {
+    if (!client->connect(opts)->wait_for(std::chrono::seconds(2))) {
+      return std::nullopt;
+    }
+  } catch (const mqtt::exception &) {
+    return std::nullopt;
+  }
+
+  const std::string topic = "vda5050pp/benchmark/" + client_id;
+  client->subscribe(topic, qos)->wait();
+
+  std::string filler(k_payload_size, 'x');
+  auto start = Clock::now();
+  for (std::size_t i = 0; i < k_messages; i++) {
+    auto msg = mqtt::make_message(topic, std::to_string(i) + ":" + filler, qos, false);
+    {
+      std::unique_lock lock(mutex);
+      sent[i] = Clock::now();
+    }
+    // paho holds back messages beyond the in-flight window until older ones are acknowledged
+    client->publish(msg);
+  }
+
+  std::unique_lock lock(mutex);
+  bool done = cv.wait_for(lock, std::chrono::seconds(30),
+                          [&] { return received_count == k_messages; });
+  lock.unlock();
+  client->disconnect()->wait();
+  if (!done) {
+    return std::nullopt;
+  }
+
+  PublishResult result;
+  Clock::duration sum{0};
+  Clock::time_point last = start;
+  for (std::size_t i = 0; i < k_messages; i++) {
+    auto latency = received[i] - sent[i];
+    sum += latency;
+    result.max_latency = std::max(
+        result.max_latency, std::chrono::duration_cast<std::chrono::microseconds>(latency));
+    last = std::max(last, received[i]);
+  }
+  result.mean_latency = std::chrono::duration_cast<std::chrono::microseconds>(sum / k_messages);
+  result.messages_per_second =
+      double(k_messages) / std::chrono::duration<double>(last - start).count();
+  return result;
+}
+
+}  // namespace
+
+TEST_CASE("benchmark::Mqtt publish throughput and latency per QoS", "[benchmark][mqtt]") {
+  auto persistence_dir =
+      std::filesystem::temp_directory_path() / "vda5050pp_benchmark_persistence";
+  std::filesystem::create_directories(persistence_dir);
+
+  struct Run {
+    const char *name;
+    int qos;
+    std::optional<std::string> persistence_dir;
+  };
+  std::vector<Run> runs{
+      {"QoS 0", 0, std::nullopt},
+      {"QoS 1", 1, std::nullopt},
+      {"QoS 2", 2, std::nullopt},
+      {"QoS 1 (file persistence)", 1, persistence_dir.string()},
+      {"QoS 2 (file persistence)", 2, persistence_dir.string()},
+  };
+
+  std::cout << "Publishing " << k_messages << " messages of " << k_payload_size << " bytes to "
+            << getBroker() << ":\n";
+  for (const auto &run : runs) {
+    auto result = measurePublish(run.qos, run.persistence_dir);
+    if (!result) {
+      std::filesystem::remove_all(persistence_dir);
+      SKIP("No MQTT broker reachable at " << getBroker());
+    }
+    std::cout << "  " << run.name << ": " << std::size_t(result->messages_per_second)
+              << " msg/s, latency mean " << result->mean_latency.count() << "us, max "
+              << result->max_latency.count() << "us\n";
+  }
+
+  std::filesystem::remove_all(persistence_dir);
+}
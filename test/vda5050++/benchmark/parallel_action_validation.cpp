@@ -0,0 +1,128 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+//
+// This file contains a benchmark of the validation of large orders, with the actions validated
+// one after another and in parallel on the worker pool.
+//
+
+#include <catch2/catch_all.hpp>
+#include <chrono>
+#include <future>
+#include <iostream>
+#include <string>
+
+#include "vda5050++/core/instance.h"
+#include "vda5050++/handler/base_action_handler.h"
+#include "vda5050++/version.h"
+
+namespace {
+
+constexpr std::size_t k_nodes = 100;
+constexpr std::size_t k_actions_per_node = 4;
+constexpr std::size_t k_rounds = 10;
+// Simulated parameter parsing and lookups of a user handler
+constexpr auto k_validate_work = std::chrono::microseconds(50);
+constexpr auto k_timeout = std::chrono::seconds(10);
+
+class BusyActionHandler : public vda5050pp::handler::BaseActionHandler {
+public:
+  bool match(const vda5050::Action &) const noexcept(false) override { return true; }
+
+  vda5050pp::handler::ActionCallbacks prepare(
+      std::shared_ptr<vda5050pp::handler::ActionState>,
+      std::shared_ptr<vda5050pp::handler::ParametersMap>) noexcept(false) override {
+    return {};
+  }
+
+  vda5050pp::handler::ValidationResult validate(const vda5050::Action &,
+                                                vda5050pp::misc::ActionContext) noexcept(false)
+      override {
+    auto until = std::chrono::steady_clock::now() + k_validate_work;
+    while (std::chrono::steady_clock::now() < until) {
+      // Busy
+    }
+    return {};
+  }
+
+  std::list<vda5050::AgvAction> getActionDescription() const noexcept(false) override {
+    return {};
+  }
+
+  bool isThreadSafe() const noexcept(true) override { return true; }
+};
+
+std::shared_ptr<vda5050::Order> mkOrder() {
+  auto order = std::make_shared<vda5050::Order>();
+  order->header.version = std::string(vda5050pp::version::getCurrentVersion());
+  order->orderId = "benchmark_order";
+
+  for (std::size_t n = 0; n < k_nodes; n++) {
+    auto &node = order->nodes.emplace_back();
+    node.nodeId = "node_" + std::to_string(n);
+    node.sequenceId = static_cast<uint32_t>(2 * n);
+    node.released = true;
+    for (std::size_t a = 0; a < k_actions_per_node; a++) {
+      auto &action = node.actions.emplace_back();
+      action.actionId = node.nodeId + "_action_" + std::to_string(a);
+      action.actionType = "benchmark_action";
+      action.blockingType = vda5050::BlockingType::NONE;
+    }
+
+    if (n + 1 < k_nodes) {
+      auto &edge = order->edges.emplace_back();
+      edge.edgeId = "edge_" + std::to_string(n);
+      edge.sequenceId = static_cast<uint32_t>(2 * n + 1);
+      edge.released = true;
+      edge.startNodeId = node.nodeId;
+      edge.endNodeId = "node_" + std::to_string(n + 1);
+    }
+  }
+  return order;
+}
+
+std::chrono::microseconds measure(bool parallel) {
+  vda5050pp::Config cfg;
+  cfg.refGlobalConfig().setLogLevel(vda5050pp::config::LogLevel::k_off);
+  cfg.refGlobalConfig().useWhiteList();
+  cfg.refGlobalConfig().bwListModule(vda5050pp::core::module_keys::k_validation_event_handler_key);
+  cfg.refGlobalConfig().bwListModule(vda5050pp::core::module_keys::k_action_event_handler_key);
+  cfg.refGlobalConfig().refEventManagerOptions().worker_pool_size = 4;
+  cfg.refGlobalConfig().refEventManagerOptions().parallel_action_validation = parallel;
+
+  auto instance = vda5050pp::core::Instance::create(cfg);
+  instance->addActionHandler(std::make_shared<BusyActionHandler>());
+  auto order = mkOrder();
+
+  std::chrono::steady_clock::duration total{0};
+  for (std::size_t i = 0; i < k_rounds; i++) {
+    auto evt = std::make_shared<vda5050pp::core::events::ValidateOrderEvent>();
+    evt->order = order;
+    auto result = evt->getSynchronizedFuture();
+
+    auto start = std::chrono::steady_clock::now();
+    instance->getValidationEventManager().dispatch(evt);
+    REQUIRE(result.wait_for(k_timeout) == std::future_status::ready);
+    total += std::chrono::steady_clock::now() - start;
+  }
+
+  return std::chrono::duration_cast<std::chrono::microseconds>(total / k_rounds);
+}
+
+}  // namespace
+
+TEST_CASE("benchmark::Validation of large orders, sequential and parallel",
+          "[benchmark][validation]") {
+  vda5050pp::core::Instance::reset();
+
+  auto sequential = measure(false);
+  auto parallel = measure(true);
+
+  std::cout << "Validation of an order with " << k_nodes * k_actions_per_node << " actions ("
+            << k_validate_work.count() << "us per action, 4 workers):\n"
+            << "  sequential: " << sequential.count() << "us\n"
+            << "  parallel:   " << parallel.count() << "us\n";
+}
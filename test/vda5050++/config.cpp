@@ -43,6 +43,13 @@ TEST_CASE("Config - load/save for sub_configs", "[config][io]") {
   cfg.refMqttSubConfig().refOptions().max_retry_interval_ = std::chrono::seconds(10);
   cfg.refMqttSubConfig().refOptions().keep_alive_interval_ = std::chrono::seconds(5);
   cfg.refMqttSubConfig().refOptions().connect_timeout_ = std::chrono::seconds(15);
+  cfg.refMqttSubConfig().refOptions().qos.order = 1;
+  cfg.refMqttSubConfig().refOptions().qos.state = 2;
+  cfg.refMqttSubConfig().refOptions().persistence_dir = "/tmp/vda5050pp";
+  cfg.refMqttSubConfig().refOptions().max_inflight = 20;
+  cfg.refMqttSubConfig().refOptions().mqtt_version = 5;
+  cfg.refMqttSubConfig().refOptions().visualization_ttl_ = std::chrono::seconds(3);
+  cfg.refMqttSubConfig().refOptions().shared_connection = true;
   cfg.refGlobalConfig().bwListModule("Mqtt");
   cfg.refGlobalConfig().bwListModule("Test");
   cfg.refGlobalConfig().useBlackList();
@@ -74,6 +81,18 @@ TEST_CASE("Config - load/save for sub_configs", "[config][io]") {
               cfg.refMqttSubConfig().getOptions().keep_alive_interval_);
       REQUIRE(cfg2.refMqttSubConfig().getOptions().connect_timeout_ ==
               cfg.refMqttSubConfig().getOptions().connect_timeout_);
+      REQUIRE(cfg2.refMqttSubConfig().getOptions().qos.order == 1);
+      REQUIRE(cfg2.refMqttSubConfig().getOptions().qos.state == 2);
+      REQUIRE(cfg2.refMqttSubConfig().getOptions().qos.visualization == 0);
+      REQUIRE(cfg2.refMqttSubConfig().getOptions().persistence_dir ==
+              cfg.refMqttSubConfig().getOptions().persistence_dir);
+      REQUIRE(cfg2.refMqttSubConfig().getOptions().max_inflight ==
+              cfg.refMqttSubConfig().getOptions().max_inflight);
+      REQUIRE_FALSE(cfg2.refMqttSubConfig().getOptions().max_buffered_messages.has_value());
+      REQUIRE(cfg2.refMqttSubConfig().getOptions().mqtt_version == 5);
+      REQUIRE(cfg2.refMqttSubConfig().getOptions().visualization_ttl_ ==
+              cfg.refMqttSubConfig().getOptions().visualization_ttl_);
+      REQUIRE(cfg2.refMqttSubConfig().getOptions().shared_connection);
       REQUIRE_FALSE(cfg2.getGlobalConfig().isListedModule("Mqtt"));
       REQUIRE_FALSE(cfg2.getGlobalConfig().isListedModule("Test"));
       REQUIRE(cfg2.getGlobalConfig().isListedModule("Other"));
@@ -94,6 +113,13 @@ TEST_CASE("Config - load/save for sub_configs", "[config][io]") {
     REQUIRE_THROWS_AS(vda5050pp::Config::loadFrom(std::string_view(invalid)),
                       vda5050pp::VDA5050PPTOMLError);
   }
+
+  WHEN("An invalid MQTT QoS level is restored") {
+    std::string invalid = "[module.Mqtt]\nqos.state = 3\n";
+
+    REQUIRE_THROWS_AS(vda5050pp::Config::loadFrom(std::string_view(invalid)),
+                      vda5050pp::VDA5050PPInvalidConfiguration);
+  }
 }
 
 class TestSubConfig : public vda5050pp::config::SubConfig {
@@ -0,0 +1,125 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+//
+// This file contains tests for the coroutine layer (only built with LIBVDA5050PP_COROUTINES)
+//
+
+#include "vda5050++/core/common/coroutine.h"
+
+#ifdef LIBVDA5050PP_COROUTINES
+
+#include <catch2/catch_all.hpp>
+#include <chrono>
+#include <future>
+#include <thread>
+
+using namespace std::chrono_literals;
+
+static vda5050pp::core::common::Task awaitInline(vda5050pp::events::SynchronizedEvent<int> &event,
+                                                 std::promise<int> &done) {
+  try {
+    done.set_value(co_await event.result());
+  } catch (...) {
+    done.set_exception(std::current_exception());
+  }
+}
+
+static vda5050pp::core::common::Task awaitScheduled(
+    vda5050pp::events::SynchronizedEvent<int> &event,
+    vda5050pp::core::common::CoroutineExecutor::Ref executor,
+    std::optional<std::chrono::steady_clock::duration> timeout, std::promise<int> &done,
+    std::promise<std::thread::id> &resumed_on) {
+  try {
+    auto value =
+        co_await vda5050pp::core::common::awaitResult(event.result(), executor, timeout);
+    resumed_on.set_value(std::this_thread::get_id());
+    done.set_value(value);
+  } catch (...) {
+    resumed_on.set_value(std::this_thread::get_id());
+    done.set_exception(std::current_exception());
+  }
+}
+
+TEST_CASE("core::common coroutines await SynchronizedEvent results", "[core::common]") {
+  vda5050pp::events::SynchronizedEvent<int> event;
+  std::promise<int> done;
+  auto done_future = done.get_future();
+
+  WHEN("The result is already set") {
+    event.acquireResultToken().setValue(1);
+    awaitInline(event, done);
+
+    THEN("The coroutine does not suspend") {
+      REQUIRE(done_future.wait_for(0s) == std::future_status::ready);
+      REQUIRE(done_future.get() == 1);
+    }
+  }
+
+  WHEN("The result is set later") {
+    awaitInline(event, done);
+    REQUIRE(done_future.wait_for(0s) == std::future_status::timeout);
+
+    event.acquireResultToken().setValue(2);
+
+    THEN("The coroutine is resumed by the setting thread") {
+      REQUIRE(done_future.wait_for(0s) == std::future_status::ready);
+      REQUIRE(done_future.get() == 2);
+    }
+  }
+
+  WHEN("An exception is set") {
+    awaitInline(event, done);
+    event.acquireResultToken().setException(std::make_exception_ptr(std::logic_error("test")));
+
+    THEN("co_await throws") { REQUIRE_THROWS_AS(done_future.get(), std::logic_error); }
+  }
+}
+
+TEST_CASE("core::common::CoroutineExecutor resumes awaiters", "[core::common]") {
+  auto executor = std::make_unique<vda5050pp::core::common::CoroutineExecutor>(nullptr);
+  vda5050pp::events::SynchronizedEvent<int> event;
+  std::promise<int> done;
+  std::promise<std::thread::id> resumed_on;
+  auto done_future = done.get_future();
+  auto resumed_on_future = resumed_on.get_future();
+
+  WHEN("The result is set in time") {
+    awaitScheduled(event, executor->ref(), 1s, done, resumed_on);
+    event.acquireResultToken().setValue(3);
+
+    THEN("The coroutine is resumed on the executor") {
+      REQUIRE(done_future.wait_for(1s) == std::future_status::ready);
+      REQUIRE(done_future.get() == 3);
+      REQUIRE(resumed_on_future.get() != std::this_thread::get_id());
+    }
+  }
+
+  WHEN("The result is not set in time") {
+    awaitScheduled(event, executor->ref(), 10ms, done, resumed_on);
+
+    THEN("The coroutine is resumed with a timeout") {
+      REQUIRE(done_future.wait_for(1s) == std::future_status::ready);
+      REQUIRE_THROWS_AS(done_future.get(), vda5050pp::VDA5050PPSynchronizedEventTimedOut);
+    }
+    THEN("Setting the result afterwards does not resume it again") {
+      REQUIRE(done_future.wait_for(1s) == std::future_status::ready);
+      event.acquireResultToken().setValue(4);
+    }
+  }
+
+  WHEN("The executor is destroyed while the coroutine is suspended") {
+    awaitScheduled(event, executor->ref(), std::nullopt, done, resumed_on);
+    executor.reset();
+    event.acquireResultToken().setValue(5);
+
+    THEN("The coroutine is not resumed") {
+      REQUIRE(done_future.wait_for(10ms) == std::future_status::timeout);
+    }
+  }
+}
+
+#endif  // LIBVDA5050PP_COROUTINES
@@ -0,0 +1,268 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+//
+// This file contains tests for the EventLane and the RingBufferEventQueue
+//
+
+#include "vda5050++/core/common/event_queue_policy.h"
+
+#include <atomic>
+#include <catch2/catch_all.hpp>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct RecordingDispatcher {
+  mutable std::vector<std::pair<int, int>> dispatched;
+
+  void dispatch(int id, std::shared_ptr<int> event) const { dispatched.emplace_back(id, *event); }
+};
+
+struct EnqueueingDispatcher {
+  vda5050pp::core::common::EventLane<int, std::shared_ptr<int>> &lane;
+  mutable std::vector<std::pair<int, int>> dispatched;
+
+  void dispatch(int id, std::shared_ptr<int> event) const {
+    dispatched.emplace_back(id, *event);
+    if (*event == 0) {
+      // Enqueue more events than the capacity, while processing an event
+      for (int i = 1; i < 4; i++) {
+        lane.enqueue(id, std::make_shared<int>(i));
+      }
+    }
+  }
+};
+
+}  // namespace
+
+TEST_CASE("core::common::EventLane", "[core::common::EventLane]") {
+  GIVEN("An EventLane with a capacity of 4") {
+    vda5050pp::core::common::EventLane<int, std::shared_ptr<int>> lane(4);
+    RecordingDispatcher dispatcher;
+
+    THEN("Processing an empty lane does nothing") {
+      REQUIRE_FALSE(lane.processOne(dispatcher));
+      REQUIRE_FALSE(lane.process(dispatcher));
+      REQUIRE(dispatcher.dispatched.empty());
+    }
+
+    WHEN("More events than the capacity are enqueued") {
+      for (int i = 0; i < 10; i++) {
+        lane.enqueue(i % 2, std::make_shared<int>(i));
+      }
+
+      THEN("The events spilled into the overflow list") { REQUIRE(lane.overflowCount() == 6); }
+
+      THEN("All events are dispatched in enqueue order") {
+        REQUIRE(lane.processOne(dispatcher));
+        REQUIRE(dispatcher.dispatched.size() == 1);
+        REQUIRE(lane.process(dispatcher));
+        REQUIRE(dispatcher.dispatched.size() == 10);
+        for (int i = 0; i < 10; i++) {
+          REQUIRE(dispatcher.dispatched[std::size_t(i)] == std::make_pair(i % 2, i));
+        }
+      }
+
+      AND_WHEN("Events are enqueued, while the overflow is being processed") {
+        for (int i = 0; i < 6; i++) {
+          REQUIRE(lane.processOne(dispatcher));
+        }
+        for (int i = 10; i < 12; i++) {
+          lane.enqueue(0, std::make_shared<int>(i));
+        }
+
+        THEN("They are dispatched after all overflow events") {
+          REQUIRE(lane.process(dispatcher));
+          REQUIRE(dispatcher.dispatched.size() == 12);
+          for (int i = 0; i < 12; i++) {
+            REQUIRE(dispatcher.dispatched[std::size_t(i)].second == i);
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST_CASE("core::common::EventLane - queue limits", "[core::common::EventLane]") {
+  using vda5050pp::config::QueueOverflowPolicy;
+
+  vda5050pp::core::common::EventStatisticsRecorder recorder("TestManager");
+  vda5050pp::core::common::EventLane<int, std::shared_ptr<int>> lane(4);
+  RecordingDispatcher dispatcher;
+  lane.setStatisticsRecorder(&recorder);
+
+  auto dropped = [&recorder] {
+    uint64_t sum = 0;
+    for (const auto &stats : recorder.snapshot()) {
+      sum += stats.dropped;
+    }
+    return sum;
+  };
+
+  WHEN("The drop_oldest policy is used") {
+    std::vector<int> handled;
+    lane.setDropHandler(
+        [&handled](int, std::shared_ptr<int> &event) { handled.push_back(*event); });
+    lane.setLimit({3, QueueOverflowPolicy::k_drop_oldest});
+    for (int i = 0; i < 5; i++) {
+      lane.enqueue(0, std::make_shared<int>(i));
+    }
+
+    THEN("The oldest events are dropped") {
+      lane.process(dispatcher);
+      REQUIRE(dispatcher.dispatched ==
+              std::vector<std::pair<int, int>>{{0, 2}, {0, 3}, {0, 4}});
+      REQUIRE(dropped() == 2);
+    }
+
+    THEN("The drop handler received the dropped events") {
+      REQUIRE(handled == std::vector<int>{0, 1});
+    }
+  }
+
+  WHEN("A limit is set") {
+    lane.setLimit({8, QueueOverflowPolicy::k_drop_newest});
+    for (int i = 0; i < 8; i++) {
+      lane.enqueue(0, std::make_shared<int>(i));
+    }
+
+    THEN("The ring buffer holds the capacity, nothing spills into the overflow list") {
+      REQUIRE(lane.overflowCount() == 0);
+      REQUIRE(dropped() == 0);
+      lane.process(dispatcher);
+      REQUIRE(dispatcher.dispatched.size() == 8);
+    }
+  }
+
+  WHEN("The drop_newest policy is used") {
+    lane.setLimit({3, QueueOverflowPolicy::k_drop_newest});
+    for (int i = 0; i < 5; i++) {
+      lane.enqueue(0, std::make_shared<int>(i));
+    }
+
+    THEN("The new events are dropped") {
+      lane.process(dispatcher);
+      REQUIRE(dispatcher.dispatched ==
+              std::vector<std::pair<int, int>>{{0, 0}, {0, 1}, {0, 2}});
+      REQUIRE(dropped() == 2);
+    }
+  }
+
+  WHEN("The coalesce policy is used") {
+    lane.setLimit({3, QueueOverflowPolicy::k_coalesce});
+    lane.enqueue(0, std::make_shared<int>(0));
+    lane.enqueue(1, std::make_shared<int>(1));
+    lane.enqueue(0, std::make_shared<int>(2));
+    lane.enqueue(1, std::make_shared<int>(3));
+    lane.enqueue(2, std::make_shared<int>(4));
+
+    THEN("The newest pending event of the same id is replaced") {
+      lane.process(dispatcher);
+      REQUIRE(dispatcher.dispatched ==
+              std::vector<std::pair<int, int>>{{0, 0}, {1, 3}, {0, 2}});
+      REQUIRE(dropped() == 2);
+    }
+  }
+
+  WHEN("The block policy is used") {
+    lane.setLimit({2, QueueOverflowPolicy::k_block});
+    lane.enqueue(0, std::make_shared<int>(0));
+    lane.enqueue(0, std::make_shared<int>(1));
+
+    std::atomic_bool enqueued = false;
+    std::thread producer([&lane, &enqueued] {
+      lane.enqueue(0, std::make_shared<int>(2));
+      enqueued = true;
+    });
+
+    THEN("The producer waits until the consumer made space") {
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+      REQUIRE_FALSE(enqueued);
+
+      REQUIRE(lane.processOne(dispatcher));
+      producer.join();
+      REQUIRE(enqueued);
+
+      lane.process(dispatcher);
+      REQUIRE(dispatcher.dispatched ==
+              std::vector<std::pair<int, int>>{{0, 0}, {0, 1}, {0, 2}});
+      REQUIRE(dropped() == 0);
+      REQUIRE(recorder.snapshot().at(0).blocked == 1);
+    }
+
+    if (producer.joinable()) {
+      lane.process(dispatcher);
+      producer.join();
+    }
+  }
+
+  WHEN("The block policy is used and an event worker enqueues into a full queue") {
+    lane.setLimit({2, QueueOverflowPolicy::k_block});
+    lane.enqueue(0, std::make_shared<int>(0));
+    EnqueueingDispatcher enqueueing{lane, {}};
+    lane.process(enqueueing);
+
+    THEN("It does not wait, the overrun is counted and no event is lost") {
+      REQUIRE(enqueueing.dispatched ==
+              std::vector<std::pair<int, int>>{{0, 0}, {0, 1}, {0, 2}, {0, 3}});
+      REQUIRE(recorder.snapshot().at(0).overrun == 1);
+      REQUIRE(recorder.snapshot().at(0).blocked == 0);
+      REQUIRE(dropped() == 0);
+    }
+  }
+}
+
+TEST_CASE("core::common::EventLane - queue limits under load", "[core::common::EventLane]") {
+  using vda5050pp::config::QueueOverflowPolicy;
+
+  constexpr int k_producers = 4;
+  constexpr int k_events = 2000;
+
+  auto policy = GENERATE(QueueOverflowPolicy::k_block, QueueOverflowPolicy::k_drop_oldest,
+                         QueueOverflowPolicy::k_drop_newest, QueueOverflowPolicy::k_coalesce);
+
+  vda5050pp::core::common::EventStatisticsRecorder recorder("TestManager");
+  vda5050pp::core::common::EventLane<int, std::shared_ptr<int>> lane;
+  lane.setStatisticsRecorder(&recorder);
+  lane.setLimit({8, policy});
+
+  std::atomic_int done = 0;
+  std::vector<std::thread> producers;
+  for (int p = 0; p < k_producers; p++) {
+    producers.emplace_back([&lane, &done, p] {
+      for (int i = 0; i < k_events; i++) {
+        lane.enqueue(p, std::make_shared<int>(i));
+      }
+      done++;
+    });
+  }
+
+  RecordingDispatcher dispatcher;
+  while (done < k_producers) {
+    lane.process(dispatcher);
+  }
+  for (auto &producer : producers) {
+    producer.join();
+  }
+  lane.process(dispatcher);
+
+  uint64_t dropped = 0;
+  for (const auto &stats : recorder.snapshot()) {
+    dropped += stats.dropped;
+  }
+
+  THEN("Each event was either dispatched or dropped, in order per producer") {
+    REQUIRE(dispatcher.dispatched.size() + dropped == std::size_t(k_producers * k_events));
+    REQUIRE(lane.overflowCount() == 0);
+    std::vector<int> last(k_producers, -1);
+    for (const auto &[id, value] : dispatcher.dispatched) {
+      REQUIRE(value > last[std::size_t(id)]);
+      last[std::size_t(id)] = value;
+    }
+  }
+}
@@ -0,0 +1,110 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+//
+// This file contains tests for the MpscRingBuffer
+//
+
+#include "vda5050++/core/common/mpsc_ring_buffer.h"
+
+#include <catch2/catch_all.hpp>
+#include <memory>
+#include <thread>
+#include <vector>
+
+TEST_CASE("core::common::MpscRingBuffer single threaded", "[core::common::MpscRingBuffer]") {
+  GIVEN("A buffer with a requested capacity of 5") {
+    vda5050pp::core::common::MpscRingBuffer<std::unique_ptr<int>> buffer(5);
+
+    THEN("The capacity is rounded up to 8") { REQUIRE(buffer.capacity() == 8); }
+
+    THEN("It is initially empty") { REQUIRE_FALSE(buffer.tryPop().has_value()); }
+
+    WHEN("The buffer is filled") {
+      for (int i = 0; i < 8; i++) {
+        REQUIRE(buffer.tryPush(std::make_unique<int>(i)));
+      }
+
+      THEN("Further pushes fail and do not consume the value") {
+        auto value = std::make_unique<int>(8);
+        REQUIRE_FALSE(buffer.tryPush(std::move(value)));
+        REQUIRE(value != nullptr);
+      }
+
+      THEN("All values are popped in FIFO order") {
+        for (int i = 0; i < 8; i++) {
+          auto value = buffer.tryPop();
+          REQUIRE(value.has_value());
+          REQUIRE(**value == i);
+        }
+        REQUIRE_FALSE(buffer.tryPop().has_value());
+      }
+
+      THEN("The newest matching value is found") {
+        REQUIRE(buffer.tryPop().has_value());
+        auto *found = buffer.findNewest([](const auto &v) { return *v % 3 == 0; });
+        REQUIRE(found != nullptr);
+        REQUIRE(**found == 6);
+        REQUIRE(buffer.findNewest([](const auto &v) { return *v == 0; }) == nullptr);
+      }
+
+      THEN("The buffer can wrap around") {
+        for (int i = 8; i < 100; i++) {
+          auto value = buffer.tryPop();
+          REQUIRE(value.has_value());
+          REQUIRE(**value == i - 8);
+          REQUIRE(buffer.tryPush(std::make_unique<int>(i)));
+        }
+      }
+    }
+  }
+}
+
+TEST_CASE("core::common::MpscRingBuffer multiple producers", "[core::common::MpscRingBuffer]") {
+  GIVEN("A small buffer and 4 producers") {
+    constexpr int k_producers = 4;
+    constexpr int k_per_producer = 10000;
+    vda5050pp::core::common::MpscRingBuffer<std::pair<int, int>> buffer(16);
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < k_producers; p++) {
+      producers.emplace_back([&buffer, p] {
+        for (int i = 0; i < k_per_producer; i++) {
+          while (!buffer.tryPush({p, i})) {
+            std::this_thread::yield();
+          }
+        }
+      });
+    }
+
+    WHEN("A single consumer pops all values") {
+      std::vector<int> next(k_producers, 0);
+      int received = 0;
+      bool in_order = true;
+      while (received < k_producers * k_per_producer) {
+        if (auto value = buffer.tryPop(); value.has_value()) {
+          in_order = in_order && next[std::size_t(value->first)] == value->second;
+          next[std::size_t(value->first)] = value->second + 1;
+          received++;
+        } else {
+          std::this_thread::yield();
+        }
+      }
+
+      for (auto &producer : producers) {
+        producer.join();
+      }
+
+      THEN("No value was lost and each producer's values are in order") {
+        REQUIRE(in_order);
+        for (int n : next) {
+          REQUIRE(n == k_per_producer);
+        }
+        REQUIRE_FALSE(buffer.tryPop().has_value());
+      }
+    }
+  }
+}
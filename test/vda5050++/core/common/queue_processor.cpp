@@ -0,0 +1,82 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+//
+// This file contains tests for the QueueProcessor class
+//
+
+#include "vda5050++/core/common/queue_processor.h"
+
+#include <atomic>
+#include <catch2/catch_all.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+using namespace std::chrono_literals;
+
+TEST_CASE("core::common::QueueProcessor wake-up", "[core::common::QueueProcessor]") {
+  std::mutex mutex;
+  std::condition_variable cv;
+  int passes = 0;
+  auto process = [&] {
+    std::unique_lock lock(mutex);
+    passes++;
+    cv.notify_all();
+  };
+  auto wait_for_passes = [&](int count) {
+    std::unique_lock lock(mutex);
+    return cv.wait_for(lock, 1s, [&] { return passes >= count; });
+  };
+
+  vda5050pp::config::EventManagerOptions opts;
+  auto pool = GENERATE(std::shared_ptr<vda5050pp::core::common::WorkerPool>(nullptr),
+                       std::make_shared<vda5050pp::core::common::WorkerPool>(2));
+
+  GIVEN("A QueueProcessor") {
+    vda5050pp::core::common::QueueProcessor processor(process, opts, pool);
+
+    THEN("It does not poll, while it is idle") {
+      std::this_thread::sleep_for(50ms);
+      std::unique_lock lock(mutex);
+      REQUIRE(passes == 0);
+    }
+
+    WHEN("It is notified") {
+      auto notified = std::chrono::steady_clock::now();
+      processor.notify();
+
+      THEN("A pass runs right away") {
+        REQUIRE(wait_for_passes(1));
+        // Far below a polling interval (the sanitizer builds are slow, so this is generous)
+        REQUIRE(std::chrono::steady_clock::now() - notified < 100ms);
+      }
+
+      AND_WHEN("It is notified again after the pass") {
+        REQUIRE(wait_for_passes(1));
+        processor.notify();
+
+        THEN("Another pass runs") { REQUIRE(wait_for_passes(2)); }
+      }
+    }
+  }
+
+  GIVEN("A QueueProcessor with synchronous_event_dispatch") {
+    opts.synchronous_event_dispatch = true;
+    vda5050pp::core::common::QueueProcessor processor(process, opts, pool);
+
+    WHEN("It is notified") {
+      processor.notify();
+
+      THEN("No pass runs (events are dispatched synchronously)") {
+        std::this_thread::sleep_for(50ms);
+        std::unique_lock lock(mutex);
+        REQUIRE(passes == 0);
+      }
+    }
+  }
+}
@@ -0,0 +1,159 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+//
+// This file contains tests for the WorkerPool and Strand classes
+//
+
+#include "vda5050++/core/common/worker_pool.h"
+
+#include <atomic>
+#include <catch2/catch_all.hpp>
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+TEST_CASE("core::common::WorkerPool runs tasks", "[core::common::WorkerPool]") {
+  GIVEN("A WorkerPool with 2 workers") {
+    auto pool = std::make_shared<vda5050pp::core::common::WorkerPool>(2);
+    REQUIRE(pool->size() == 2);
+
+    WHEN("Two blocking tasks are posted") {
+      std::promise<void> release;
+      auto released = release.get_future().share();
+      std::promise<void> started_1;
+      std::promise<void> started_2;
+
+      pool->post([&started_1, released] {
+        started_1.set_value();
+        released.wait();
+      });
+      pool->post([&started_2, released] {
+        started_2.set_value();
+        released.wait();
+      });
+
+      THEN("They run in parallel") {
+        REQUIRE(started_1.get_future().wait_for(1s) == std::future_status::ready);
+        REQUIRE(started_2.get_future().wait_for(1s) == std::future_status::ready);
+      }
+
+      release.set_value();
+    }
+  }
+}
+
+TEST_CASE("core::common::Strand serializes tasks", "[core::common::Strand]") {
+  GIVEN("Two Strands on a WorkerPool with 4 workers") {
+    auto pool = std::make_shared<vda5050pp::core::common::WorkerPool>(4);
+    std::vector<int> results_1;
+    std::vector<int> results_2;
+    std::promise<void> done_1;
+    std::promise<void> done_2;
+
+    {
+      vda5050pp::core::common::Strand strand_1(pool);
+      vda5050pp::core::common::Strand strand_2(pool);
+
+      WHEN("Many tasks are posted to both strands") {
+        constexpr int k_n = 1000;
+        for (int i = 0; i < k_n; i++) {
+          strand_1.post([&results_1, i] { results_1.push_back(i); });
+          strand_2.post([&results_2, i] { results_2.push_back(i); });
+        }
+        strand_1.post([&done_1] { done_1.set_value(); });
+        strand_2.post([&done_2] { done_2.set_value(); });
+
+        THEN("Each strand executed it's tasks in order") {
+          REQUIRE(done_1.get_future().wait_for(5s) == std::future_status::ready);
+          REQUIRE(done_2.get_future().wait_for(5s) == std::future_status::ready);
+          REQUIRE(results_1.size() == k_n);
+          REQUIRE(results_2.size() == k_n);
+          for (int i = 0; i < k_n; i++) {
+            REQUIRE(results_1[i] == i);
+            REQUIRE(results_2[i] == i);
+          }
+        }
+      }
+    }
+  }
+
+  GIVEN("A Strand with a running task") {
+    auto pool = std::make_shared<vda5050pp::core::common::WorkerPool>(1);
+    auto strand = std::make_unique<vda5050pp::core::common::Strand>(pool);
+    std::promise<void> started;
+    bool finished = false;
+    bool discarded_called = false;
+
+    strand->post([&started, &finished] {
+      started.set_value();
+      std::this_thread::sleep_for(50ms);
+      finished = true;
+    });
+    strand->post([&discarded_called] { discarded_called = true; });
+    REQUIRE(started.get_future().wait_for(1s) == std::future_status::ready);
+
+    WHEN("The Strand is destroyed") {
+      strand.reset();
+
+      THEN("It waited for the running task and discarded the pending one") {
+        REQUIRE(finished);
+        REQUIRE_FALSE(discarded_called);
+      }
+    }
+  }
+}
+
+TEST_CASE("core::common::parallelFor calls each index once", "[core::common::WorkerPool]") {
+  auto pool = std::make_shared<vda5050pp::core::common::WorkerPool>(3);
+
+  WHEN("Running many calls") {
+    std::vector<std::atomic_int> calls(1000);
+    vda5050pp::core::common::parallelFor(*pool, calls.size(), pool->size(),
+                                         [&calls](std::size_t i) { calls[i]++; });
+
+    THEN("Each index was called exactly once") {
+      for (const auto &c : calls) {
+        REQUIRE(c == 1);
+      }
+    }
+  }
+
+  WHEN("All workers are blocked") {
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    for (std::size_t i = 0; i < pool->size(); i++) {
+      pool->post([released] { released.wait(); });
+    }
+
+    std::atomic_int calls = 0;
+    vda5050pp::core::common::parallelFor(*pool, 10, pool->size(),
+                                         [&calls](std::size_t) { calls++; });
+    release.set_value();
+
+    THEN("The calling thread runs all calls") { REQUIRE(calls == 10); }
+  }
+
+  WHEN("A call throws") {
+    std::atomic_int calls = 0;
+    auto run = [&pool, &calls] {
+      vda5050pp::core::common::parallelFor(*pool, 10, pool->size(), [&calls](std::size_t i) {
+        calls++;
+        if (i == 5) {
+          throw std::runtime_error("test");
+        }
+      });
+    };
+
+    THEN("It is rethrown after all calls returned") {
+      REQUIRE_THROWS_AS(run(), std::runtime_error);
+      REQUIRE(calls == 10);
+    }
+  }
+}
@@ -7,7 +7,13 @@
 
 #include "vda5050++/core/generic_event_manager.h"
 
+#include <algorithm>
 #include <catch2/catch_all.hpp>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 using namespace std::chrono_literals;
 
@@ -119,4 +125,151 @@ TEST_CASE("core::GenericEventManager - dispatch/subscribe", "[core][events]") {
       REQUIRE(future3.wait_for(100ms) == std::future_status::timeout);
     }
   }
-}
\ No newline at end of file
+}
+
+TEST_CASE("core::GenericEventManager - priority lanes", "[core][events]") {
+  vda5050pp::config::EventManagerOptions opts;
+  vda5050pp::core::GenericEventManager<MyEvent> mgr(opts);
+
+  std::promise<void> release;
+  auto released = release.get_future().share();
+  std::promise<void> blocked;
+  std::promise<void> all_done;
+
+  std::mutex order_mutex;
+  std::vector<std::string> order;
+  auto record = [&order_mutex, &order, &all_done](std::string name) {
+    std::unique_lock lock(order_mutex);
+    order.push_back(std::move(name));
+    if (order.size() == 5) {
+      all_done.set_value();
+    }
+  };
+
+  auto sub = mgr.getScopedSubscriber();
+  sub.subscribe<MyEvent1>([&](std::shared_ptr<MyEvent1> evt) {
+    if (evt->value == 0) {
+      blocked.set_value();
+      released.wait();
+    }
+    record(evt->name);
+  });
+  sub.subscribe<MyEvent2>([&](std::shared_ptr<MyEvent2> evt) { record(evt->name); });
+  sub.subscribe<MyEvent3>([&](std::shared_ptr<MyEvent3> evt) { record(evt->name); });
+
+  WHEN("Events of all priorities are queued behind a blocking event") {
+    auto blocking = std::make_shared<MyEvent1>();
+    blocking->name = "blocking";
+    blocking->value = 0;
+    mgr.dispatch(blocking);
+    REQUIRE(blocked.get_future().wait_for(1s) == std::future_status::ready);
+
+    auto bulk = std::make_shared<MyEvent3>();
+    bulk->name = "bulk";
+    mgr.dispatch(bulk, vda5050pp::core::EventPriority::k_bulk);
+    auto normal = std::make_shared<MyEvent2>();
+    normal->name = "normal";
+    mgr.dispatch(normal);
+    auto control_1 = std::make_shared<MyEvent1>();
+    control_1->name = "control_1";
+    control_1->value = 1;
+    mgr.dispatch(control_1, vda5050pp::core::EventPriority::k_control);
+    auto control_2 = std::make_shared<MyEvent3>();
+    control_2->name = "control_2";
+    mgr.dispatch(control_2, vda5050pp::core::EventPriority::k_control);
+
+    release.set_value();
+
+    THEN("Control events are processed first and bulk events last") {
+      REQUIRE(all_done.get_future().wait_for(1s) == std::future_status::ready);
+      std::unique_lock lock(order_mutex);
+      REQUIRE(order ==
+              std::vector<std::string>{"blocking", "control_1", "control_2", "normal", "bulk"});
+    }
+  }
+}
+
+TEST_CASE("core::GenericEventManager - bulk events are not starved", "[core][events]") {
+  using Manager = vda5050pp::core::GenericEventManager<MyEvent>;
+  vda5050pp::config::EventManagerOptions opts;
+  Manager mgr(opts);
+
+  constexpr std::size_t k_normal_events = 4 * Manager::k_bulk_share;
+
+  std::promise<void> release;
+  auto released = release.get_future().share();
+  std::promise<void> blocked;
+  std::promise<void> all_done;
+
+  std::mutex order_mutex;
+  std::vector<std::string> order;
+  auto record = [&order_mutex, &order, &all_done](std::string name) {
+    std::unique_lock lock(order_mutex);
+    order.push_back(std::move(name));
+    if (order.size() == k_normal_events + 2) {
+      all_done.set_value();
+    }
+  };
+
+  auto sub = mgr.getScopedSubscriber();
+  sub.subscribe<MyEvent1>([&](std::shared_ptr<MyEvent1> evt) {
+    if (evt->value == 0) {
+      blocked.set_value();
+      released.wait();
+    }
+    record(evt->name);
+  });
+  sub.subscribe<MyEvent3>([&](std::shared_ptr<MyEvent3> evt) { record(evt->name); });
+
+  auto blocking = std::make_shared<MyEvent1>();
+  blocking->name = "blocking";
+  blocking->value = 0;
+  mgr.dispatch(blocking);
+  REQUIRE(blocked.get_future().wait_for(1s) == std::future_status::ready);
+
+  auto bulk = std::make_shared<MyEvent3>();
+  bulk->name = "bulk";
+  mgr.dispatch(bulk, vda5050pp::core::EventPriority::k_bulk);
+  for (std::size_t i = 0; i < k_normal_events; i++) {
+    auto normal = std::make_shared<MyEvent1>();
+    normal->name = "normal";
+    normal->value = 1;
+    mgr.dispatch(normal);
+  }
+
+  release.set_value();
+
+  THEN("The bulk event is processed after at most k_bulk_share normal events") {
+    REQUIRE(all_done.get_future().wait_for(1s) == std::future_status::ready);
+    std::unique_lock lock(order_mutex);
+    auto bulk_pos = std::find(order.begin(), order.end(), "bulk") - order.begin();
+    REQUIRE(bulk_pos <= std::ptrdiff_t(Manager::k_bulk_share));
+  }
+}
+
+TEST_CASE("core::GenericEventManager - throwing listeners", "[core][events]") {
+  vda5050pp::config::EventManagerOptions opts;
+  vda5050pp::core::GenericEventManager<MyEvent> mgr(opts);
+
+  std::promise<void> done;
+  auto sub = mgr.getScopedSubscriber();
+  sub.subscribe<MyEvent1>([](std::shared_ptr<MyEvent1> evt) {
+    if (evt->value == 0) {
+      throw std::runtime_error("std::exception");
+    }
+    throw 1;
+  });
+  sub.subscribe<MyEvent2>([&done](std::shared_ptr<MyEvent2>) { done.set_value(); });
+
+  auto std_exception = std::make_shared<MyEvent1>();
+  std_exception->value = 0;
+  auto unknown_exception = std::make_shared<MyEvent1>();
+  unknown_exception->value = 1;
+  mgr.dispatch(std_exception);
+  mgr.dispatch(unknown_exception);
+  mgr.dispatch(std::make_shared<MyEvent2>());
+
+  THEN("The events after them are still processed") {
+    REQUIRE(done.get_future().wait_for(1s) == std::future_status::ready);
+  }
+}
@@ -7,6 +7,7 @@
 
 #include "vda5050++/core/agv_handler/action_event_handler.h"
 
+#include <atomic>
 #include <catch2/catch_all.hpp>
 
 #include "test/test_action_handler.h"
@@ -15,6 +16,30 @@
 
 using namespace std::chrono_literals;
 
+///
+///\brief A TestActionHandler, which matches all action types with a prefix (dynamically).
+///
+class PrefixActionHandler : public test::TestActionHandler {
+private:
+  std::string prefix_;
+
+public:
+  mutable std::atomic_int match_calls = 0;
+
+  PrefixActionHandler(const vda5050pp::agv_description::ActionDeclaration &decl,
+                      std::string_view prefix)
+      : test::TestActionHandler(decl), prefix_(prefix) {}
+
+  bool match(const vda5050::Action &action) const noexcept(true) override {
+    this->match_calls++;
+    return action.actionType.rfind(this->prefix_, 0) == 0;
+  }
+
+  std::optional<std::vector<std::string>> getHandledActionTypes() const noexcept(false) override {
+    return std::nullopt;
+  }
+};
+
 TEST_CASE("ActionEventHandler event propagation", "[core][ActionEventHandler]") {
   vda5050pp::core::Instance::reset();
   vda5050pp::Config cfg;
@@ -212,4 +237,74 @@ TEST_CASE("ActionEventHandler validation", "[core][ActionEventHandler]") {
       REQUIRE(future.get().empty());
     }
   }
-}
\ No newline at end of file
+}
+
+TEST_CASE("ActionEventHandler routing by action type", "[core][ActionEventHandler]") {
+  vda5050pp::core::Instance::reset();
+  vda5050pp::Config cfg;
+  cfg.refGlobalConfig().useWhiteList();
+  cfg.refGlobalConfig().bwListModule(vda5050pp::core::module_keys::k_action_event_handler_key);
+  vda5050pp::core::Instance::init(cfg);
+
+  vda5050pp::agv_description::ActionDeclaration decl1;
+  decl1.action_type = "type1";
+  decl1.blocking_types = {vda5050::BlockingType::NONE};
+  decl1.edge = true;
+  decl1.node = true;
+  decl1.instant = true;
+
+  auto decl_dynamic = decl1;
+  decl_dynamic.action_type = "dynamic";
+
+  auto indexed_handler = std::make_shared<test::TestActionHandler>(decl1);
+  auto duplicate_handler = std::make_shared<test::TestActionHandler>(decl1);
+  auto dynamic_handler = std::make_shared<PrefixActionHandler>(decl_dynamic, "dynamic");
+
+  vda5050pp::core::Instance::ref().addActionHandler(dynamic_handler);
+  vda5050pp::core::Instance::ref().addActionHandler(indexed_handler);
+  vda5050pp::core::Instance::ref().addActionHandler(duplicate_handler);
+
+  THEN("The published action types are indexed") {
+    REQUIRE(vda5050pp::core::Instance::ref().getIndexedActionHandler("type1") == indexed_handler);
+    REQUIRE(vda5050pp::core::Instance::ref().getIndexedActionHandler("dynamic") == nullptr);
+    REQUIRE(vda5050pp::core::Instance::ref().getDynamicActionHandler() ==
+            std::vector<std::shared_ptr<vda5050pp::handler::BaseActionHandler>>{dynamic_handler});
+    REQUIRE(vda5050pp::core::Instance::ref().getActionHandler().size() == 3);
+  }
+
+  WHEN("An action with an indexed type is validated") {
+    auto action = std::make_shared<vda5050::Action>();
+    action->actionId = "indexed";
+    action->actionType = decl1.action_type;
+    action->blockingType = vda5050::BlockingType::NONE;
+
+    auto event = std::make_shared<vda5050pp::events::ActionValidate>();
+    event->action = action;
+    auto future = event->getFuture();
+    vda5050pp::core::Instance::ref().getActionEventManager().dispatch(event);
+
+    THEN("It is validated by the indexed handler without calling match()") {
+      REQUIRE(future.wait_for(100ms) == std::future_status::ready);
+      REQUIRE(future.get().empty());
+      REQUIRE(dynamic_handler->match_calls == 0);
+    }
+  }
+
+  WHEN("An action with an unindexed type is validated") {
+    auto action = std::make_shared<vda5050::Action>();
+    action->actionId = "dynamic";
+    action->actionType = decl_dynamic.action_type;
+    action->blockingType = vda5050::BlockingType::NONE;
+
+    auto event = std::make_shared<vda5050pp::events::ActionValidate>();
+    event->action = action;
+    auto future = event->getFuture();
+    vda5050pp::core::Instance::ref().getActionEventManager().dispatch(event);
+
+    THEN("It is matched by the dynamic handler") {
+      REQUIRE(future.wait_for(100ms) == std::future_status::ready);
+      REQUIRE(future.get().empty());
+      REQUIRE(dynamic_handler->match_calls == 1);
+    }
+  }
+}
@@ -0,0 +1,167 @@
+//  Copyright Open Logistics Foundation
+//
+//  Licensed under the Open Logistics Foundation License 1.3.
+//  For details on the licensing terms, see the LICENSE file.
+//  SPDX-License-Identifier: OLFL-1.3
+//
+#include "vda5050++/core/instance.h"
+
+#include <catch2/catch_all.hpp>
+#include <chrono>
+#include <future>
+#include <thread>
+
+#include "vda5050++/core/instance_scope.h"
+#include "vda5050++/exception.h"
+#include "vda5050++/handle.h"
+
+using namespace std::chrono_literals;
+
+static vda5050pp::Config mkConfig(bool share_worker_pool = false) {
+  vda5050pp::Config cfg;
+  cfg.refGlobalConfig().useWhiteList();
+  cfg.refGlobalConfig().bwListModule(vda5050pp::core::module_keys::k_state_event_handler_key);
+  cfg.refGlobalConfig().refEventManagerOptions().worker_pool_size = 2;
+  cfg.refGlobalConfig().refEventManagerOptions().share_worker_pool = share_worker_pool;
+  return cfg;
+}
+
+TEST_CASE("core::Instance - multiple instances", "[core][Instance]") {
+  vda5050pp::core::Instance::reset();
+
+  auto instance_a = vda5050pp::core::Instance::create(mkConfig());
+  auto instance_b = vda5050pp::core::Instance::create(mkConfig());
+
+  WHEN("No instance is bound") {
+    THEN("There is no default instance") {
+      REQUIRE(vda5050pp::core::Instance::get().expired());
+      REQUIRE(vda5050pp::core::Instance::threadBinding().expired());
+      REQUIRE_THROWS_AS(vda5050pp::core::Instance::ref(), vda5050pp::VDA5050PPNotInitialized);
+    }
+  }
+
+  WHEN("The instances are bound") {
+    THEN("get() and ref() return the innermost binding") {
+      vda5050pp::core::InstanceScope scope_a(instance_a.get());
+      REQUIRE(&vda5050pp::core::Instance::ref() == instance_a.get());
+      {
+        vda5050pp::core::InstanceScope scope_b(instance_b.get());
+        REQUIRE(vda5050pp::core::Instance::get().lock() == instance_b);
+        REQUIRE(vda5050pp::core::Instance::threadBinding().lock() == instance_b);
+
+        vda5050pp::core::InstanceScope scope_keep(nullptr);
+        REQUIRE(&vda5050pp::core::Instance::ref() == instance_b.get());
+      }
+      REQUIRE(&vda5050pp::core::Instance::ref() == instance_a.get());
+    }
+
+    THEN("Each instance has own modules") {
+      auto key = vda5050pp::core::module_keys::k_state_event_handler_key;
+      REQUIRE(instance_a->getModule(key).lock() != nullptr);
+      REQUIRE(instance_a->getModule(key).lock() != instance_b->getModule(key).lock());
+
+      vda5050pp::core::InstanceScope scope_b(instance_b.get());
+      REQUIRE(vda5050pp::core::Instance::lookupModule(key).lock() ==
+              instance_b->getModule(key).lock());
+    }
+
+    THEN("Each instance has own worker pool with the minimum number of workers") {
+      REQUIRE(instance_a->getWorkerPool() != instance_b->getWorkerPool());
+      REQUIRE(instance_a->getWorkerPool()->size() ==
+              vda5050pp::config::EventManagerOptions::k_min_worker_pool_size);
+    }
+  }
+
+  WHEN("An event is dispatched on an instance") {
+    std::promise<vda5050pp::core::Instance *> bound;
+    auto sub = instance_a->getStatusEventManager().getScopedStatusEventSubscriber();
+    sub.subscribe([&bound](std::shared_ptr<vda5050pp::events::OperatingModeSet>) {
+      bound.set_value(vda5050pp::core::InstanceScope::current());
+    });
+    instance_a->getStatusEventManager().dispatch(
+        std::make_shared<vda5050pp::events::OperatingModeSet>());
+
+    THEN("The instance is bound while processing it") {
+      auto future = bound.get_future();
+      REQUIRE(future.wait_for(1s) == std::future_status::ready);
+      REQUIRE(future.get() == instance_a.get());
+    }
+  }
+
+  WHEN("A binding is resolved after the instance was released") {
+    auto binding = std::weak_ptr<vda5050pp::core::Instance>(instance_b);
+    instance_b.reset();
+
+    THEN("It is not initialized") {
+      REQUIRE_THROWS_AS(vda5050pp::core::Instance::resolve(binding),
+                        vda5050pp::VDA5050PPNotInitialized);
+    }
+  }
+}
+
+TEST_CASE("Handle - created instances are isolated", "[core][Instance]") {
+  vda5050pp::core::Instance::reset();
+
+  bool share_worker_pool = GENERATE(false, true);
+  auto handle_a = vda5050pp::Handle::createInstance(mkConfig(share_worker_pool));
+  auto handle_b = vda5050pp::Handle::createInstance(mkConfig(share_worker_pool));
+
+  vda5050::Load load;
+  load.loadId = "load_a";
+
+  auto sink_a = handle_a.getStatusSink();
+  auto sink_b = handle_b.getStatusSink();
+  sink_a.addLoad(load);
+
+  THEN("Only the status of the own instance changed") {
+    REQUIRE(sink_a.getLoads().size() == 1);
+    REQUIRE(sink_b.getLoads().empty());
+  }
+
+  THEN("The default instance is not initialized") {
+    REQUIRE_THROWS_AS(vda5050pp::sinks::StatusSink().getLoads(),
+                      vda5050pp::VDA5050PPNotInitialized);
+  }
+
+  THEN("A sink constructed during a Binding keeps the instance on other threads") {
+    auto sink = [&handle_a] {
+      auto binding = handle_a.bind();
+      return vda5050pp::sinks::StatusSink();
+    }();
+
+    auto loads = std::async(std::launch::async, [&sink] { return sink.getLoads(); });
+    REQUIRE(loads.get().size() == 1);
+  }
+
+  handle_a.shutdown();
+  handle_b.shutdown();
+}
+
+TEST_CASE("core::Instance - registered module objects", "[core][Instance]") {
+  class CountingModule : public vda5050pp::core::Module {
+  public:
+    int initialized = 0;
+    void initialize(vda5050pp::core::Instance &) override { this->initialized++; }
+    void deinitialize(vda5050pp::core::Instance &) override {}
+    std::string_view describe() const override { return "CountingModule"; }
+  };
+
+  vda5050pp::core::Instance::reset();
+  auto module = std::make_shared<CountingModule>();
+  constexpr std::string_view k_key = "CountingModule";
+  vda5050pp::core::Instance::registerModule(k_key, module);
+
+  auto cfg = mkConfig();
+  cfg.refGlobalConfig().bwListModule(k_key);
+  auto created = vda5050pp::core::Instance::create(cfg);
+  auto instance = vda5050pp::core::Instance::init(cfg).lock();
+
+  THEN("Only the default instance uses the module object") {
+    REQUIRE(instance->getModule(k_key).lock() == module);
+    REQUIRE_THROWS_AS(created->getModule(k_key), vda5050pp::VDA5050PPInvalidArgument);
+    REQUIRE(module->initialized == 1);
+  }
+
+  vda5050pp::core::Instance::reset();
+  vda5050pp::core::Instance::unregisterModule(k_key);
+}
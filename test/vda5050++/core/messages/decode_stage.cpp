@@ -0,0 +1,88 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+//
+
+#include "vda5050++/core/messages/decode_stage.h"
+
+#include <catch2/catch_all.hpp>
+#include <chrono>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include "vda5050++/exception.h"
+
+using namespace std::chrono_literals;
+using vda5050pp::core::messages::DecodeStage;
+
+TEST_CASE("core::messages::DecodeStage", "[core][messages]") {
+  SECTION("Deliveries of a lane keep the posting order") {
+    std::mutex mutex;
+    std::vector<int> delivered;
+    std::promise<void> all_delivered;
+    constexpr int k_n = 50;
+
+    {
+      DecodeStage stage(4, 1);
+      for (int i = 0; i < k_n; i++) {
+        stage.post(0, [&, i]() -> DecodeStage::Delivery {
+          // Early tasks take longer, so they finish last
+          std::this_thread::sleep_for(std::chrono::microseconds((k_n - i) * 50));
+          return [&, i] {
+            std::unique_lock lock(mutex);
+            delivered.push_back(i);
+            if (delivered.size() == k_n) {
+              all_delivered.set_value();
+            }
+          };
+        });
+      }
+      REQUIRE(all_delivered.get_future().wait_for(5s) == std::future_status::ready);
+    }
+
+    for (int i = 0; i < k_n; i++) {
+      REQUIRE(delivered[std::size_t(i)] == i);
+    }
+  }
+
+  SECTION("A slow lane does not block other lanes") {
+    std::promise<void> fast_delivered;
+    std::promise<void> slow_delivered;
+    auto fast_future = fast_delivered.get_future().share();
+
+    DecodeStage stage(2, 2);
+    stage.post(0, [fast_future, &slow_delivered]() -> DecodeStage::Delivery {
+      fast_future.wait_for(5s);
+      return [&slow_delivered] { slow_delivered.set_value(); };
+    });
+    stage.post(1, [&fast_delivered]() -> DecodeStage::Delivery {
+      return [&fast_delivered] { fast_delivered.set_value(); };
+    });
+
+    REQUIRE(fast_future.wait_for(5s) == std::future_status::ready);
+    REQUIRE(slow_delivered.get_future().wait_for(5s) == std::future_status::ready);
+  }
+
+  SECTION("Failed tasks are skipped in the sequence") {
+    std::vector<int> delivered;
+
+    DecodeStage stage(0, 1);
+    stage.post(0, [&delivered] { return [&delivered] { delivered.push_back(0); }; });
+    stage.post(0, []() -> DecodeStage::Delivery { throw std::runtime_error("decode failed"); });
+    stage.post(0, [] { return DecodeStage::Delivery(); });
+    stage.post(0, [&delivered] { return [&delivered] { delivered.push_back(3); }; });
+
+    // Without workers, each task is delivered within post()
+    REQUIRE(delivered == std::vector<int>{0, 3});
+  }
+
+  SECTION("Posting to an unknown lane throws") {
+    DecodeStage stage(0, 1);
+    DecodeStage::Task task = [] { return DecodeStage::Delivery(); };
+    REQUIRE_THROWS_AS(stage.post(1, std::move(task)), vda5050pp::VDA5050PPInvalidArgument);
+  }
+}
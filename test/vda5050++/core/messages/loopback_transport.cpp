@@ -0,0 +1,100 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+
+#include "vda5050++/core/messages/loopback_transport.h"
+
+#include <catch2/catch_all.hpp>
+#include <chrono>
+#include <future>
+
+#include "vda5050++/core/instance.h"
+#include "vda5050++/core/messages/mqtt_module.h"
+#include "vda5050++/exception.h"
+
+using namespace std::chrono_literals;
+
+TEST_CASE("core::messages::LoopbackTransport - MqttModule without a broker",
+          "[core][messages]") {
+  vda5050pp::Config cfg;
+  cfg.refGlobalConfig().useWhiteList();
+  cfg.refGlobalConfig().bwListModule(vda5050pp::core::module_keys::k_mqtt_key);
+  cfg.refAgvDescription().manufacturer = "test_manufacturer";
+  cfg.refAgvDescription().serial_number = "test_serial";
+  cfg.refMqttSubConfig().refOptions().interface = "uagv";
+  vda5050pp::core::Instance::reset();
+  auto instance = vda5050pp::core::Instance::init(cfg).lock();
+
+  // The module was not connected yet, so the transport is used immediately
+  auto transport = std::make_shared<vda5050pp::core::messages::LoopbackTransport>();
+  auto module = std::dynamic_pointer_cast<vda5050pp::core::messages::MqttModule>(
+      vda5050pp::core::Instance::lookupModule(vda5050pp::core::module_keys::k_mqtt_key).lock());
+  REQUIRE(module != nullptr);
+  module->useTransport(transport);
+
+  WHEN("The module is not connected") {
+    THEN("Nothing can be injected") {
+      REQUIRE_THROWS_AS(transport->injectOrder(vda5050::Order{}), vda5050pp::VDA5050PPMqttError);
+    }
+  }
+
+  WHEN("The module connects") {
+    module->connect();
+
+    THEN("The connection message is captured") {
+      REQUIRE(transport->waitForCaptured("connection", 1, 1s));
+      auto captured = transport->takeCaptured();
+      REQUIRE(captured.size() == 1);
+      REQUIRE(captured[0].topic == "uagv/v2/test_manufacturer/test_serial/connection");
+      REQUIRE(vda5050::json::parse(captured[0].payload)["connectionState"] == "ONLINE");
+    }
+
+    THEN("An injected order is received by the module") {
+      std::promise<std::shared_ptr<vda5050::Order>> received;
+      auto sub = instance->getMessageEventManager().getScopedSubscriber();
+      sub.subscribe<vda5050pp::core::events::ReceiveOrderMessageEvent>(
+          [&received](auto evt) { received.set_value(evt->order); });
+
+      vda5050::Order order;
+      order.orderId = "loopback_order";
+      order.header.manufacturer = "test_manufacturer";
+      order.header.serialNumber = "test_serial";
+      transport->injectOrder(order);
+
+      auto future = received.get_future();
+      REQUIRE(future.wait_for(1s) == std::future_status::ready);
+      REQUIRE(future.get()->orderId == "loopback_order");
+    }
+
+    THEN("A sent state is captured with a timestamp") {
+      transport->takeCaptured();
+      auto before = vda5050pp::core::messages::LoopbackTransport::Clock::now();
+      vda5050::State state;
+      state.orderId = "loopback_order";
+      module->sendState(state);
+
+      REQUIRE(transport->waitForCaptured("state", 1, 1s));
+      auto captured = transport->takeCaptured();
+      REQUIRE(captured[0].topic == "uagv/v2/test_manufacturer/test_serial/state");
+      REQUIRE(captured[0].timestamp >= before);
+      REQUIRE(vda5050::json::parse(captured[0].payload)["orderId"] == "loopback_order");
+    }
+
+    THEN("States sent while the connection is lost are flushed on reconnect") {
+      transport->dropConnection("test");
+      transport->takeCaptured();
+      module->sendState(vda5050::State{});
+      REQUIRE(transport->takeCaptured().empty());
+
+      module->connect();
+      REQUIRE(transport->waitForCaptured("state", 1, 1s));
+    }
+
+    module->disconnect();
+  }
+
+  vda5050pp::core::Instance::reset();
+}
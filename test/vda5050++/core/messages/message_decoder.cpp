@@ -0,0 +1,198 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+//
+
+#include "vda5050++/core/messages/message_decoder.h"
+
+#include <catch2/catch_all.hpp>
+
+#include "vda5050++/exception.h"
+
+template <typename MessageT> static std::string decodeToString(std::string_view payload) {
+  MessageT message;
+  vda5050pp::core::messages::decode(payload, message);
+  return vda5050::json(message).dump();
+}
+
+template <typename MessageT> static std::string parseToString(std::string_view payload) {
+  return vda5050::json(vda5050::json::parse(payload).get<MessageT>()).dump();
+}
+
+static vda5050::Action mkAction(std::string_view id) {
+  vda5050::Action action;
+  action.actionId = id;
+  action.actionType = "pick";
+  action.actionDescription = "quote\" unicode \xc3\xbc";
+  action.blockingType = vda5050::BlockingType::HARD;
+  action.actionParameters = {{"station", "\"s1\""}, {"height", "1.5"}, {"list", "[1,2]"}};
+  return action;
+}
+
+static vda5050::Order mkFullOrder() {
+  vda5050::Order order;
+  order.header.headerId = 4294967295;
+  order.header.manufacturer = "manufacturer";
+  order.header.serialNumber = "serial";
+  order.header.version = "2.0.0";
+  order.header.timestamp = std::chrono::system_clock::now();
+  order.orderId = "order";
+  order.orderUpdateId = 3;
+  order.zoneSetId = "zone";
+
+  vda5050::Node n0;
+  n0.nodeId = "n0";
+  n0.sequenceId = 0;
+  n0.released = true;
+  n0.nodeDescription = "first";
+  n0.nodePosition = vda5050::NodePosition{};
+  n0.nodePosition->x = -1.25e-3;
+  n0.nodePosition->y = 1e21;
+  n0.nodePosition->theta = 3.0;
+  n0.nodePosition->allowedDeviationXY = 0.5;
+  n0.nodePosition->mapId = "map";
+  n0.actions = {mkAction("a0"), mkAction("a1")};
+
+  vda5050::Node n2;
+  n2.nodeId = "n2";
+  n2.sequenceId = 2;
+  n2.released = false;
+
+  vda5050::Edge e1;
+  e1.edgeId = "e1";
+  e1.sequenceId = 1;
+  e1.released = true;
+  e1.startNodeId = "n0";
+  e1.endNodeId = "n2";
+  e1.maxSpeed = 1.5;
+  e1.rotationAllowed = false;
+  e1.length = 10;
+  e1.trajectory.emplace();
+  e1.trajectory->degree = 1;
+  e1.trajectory->knotVector = {0, 0, 1, 1};
+  e1.trajectory->controlPoints.resize(2);
+  e1.trajectory->controlPoints[1].x = 2;
+  e1.trajectory->controlPoints[1].weight = 1;
+  e1.actions = {mkAction("a2")};
+
+  order.nodes = {n0, n2};
+  order.edges = {e1};
+  return order;
+}
+
+TEST_CASE("core::messages::decode - Order", "[core][messages]") {
+  SECTION("A full order decodes like vda5050::json") {
+    auto payload = vda5050::json(mkFullOrder()).dump();
+    REQUIRE(decodeToString<vda5050::Order>(payload) == parseToString<vda5050::Order>(payload));
+  }
+
+  SECTION("Whitespace, escapes and unknown keys are accepted") {
+    auto payload = vda5050::json(mkFullOrder()).dump(2);
+    payload.insert(1, R"( "unknown": {"a": [1, {"b": null}, "\u00fc\ud83d\ude00"]},)");
+    REQUIRE(decodeToString<vda5050::Order>(payload) == parseToString<vda5050::Order>(payload));
+  }
+
+  SECTION("Arrays are replaced, not appended") {
+    auto payload = vda5050::json(mkFullOrder()).dump();
+    auto order = mkFullOrder();
+    vda5050pp::core::messages::decode(payload, order);
+    REQUIRE(order.nodes.size() == 2);
+    REQUIRE(order.edges.size() == 1);
+  }
+}
+
+TEST_CASE("core::messages::decode - InstantActions", "[core][messages]") {
+  vda5050::InstantActions instant_actions;
+  instant_actions.header.headerId = 1;
+  instant_actions.header.timestamp = std::chrono::system_clock::now();
+  instant_actions.actions = {mkAction("i0"), mkAction("i1")};
+
+  auto payload = vda5050::json(instant_actions).dump();
+  REQUIRE(decodeToString<vda5050::InstantActions>(payload) ==
+          parseToString<vda5050::InstantActions>(payload));
+}
+
+TEST_CASE("core::messages::decode - invalid payloads", "[core][messages]") {
+  auto valid = vda5050::json(mkFullOrder()).dump();
+
+  auto invalidate = [&valid](std::string_view from, std::string_view to) {
+    auto payload = valid;
+    auto pos = payload.find(from);
+    REQUIRE(pos != std::string::npos);
+    payload.replace(pos, from.size(), to);
+    return payload;
+  };
+
+  auto payload = GENERATE_COPY(
+      std::string(""), std::string("[]"), std::string("{"), valid + "x",
+      valid.substr(0, valid.size() - 1), invalidate("\"orderId\"", "\"renamed\""),
+      invalidate("\"orderUpdateId\":3", "\"orderUpdateId\":\"3\""),
+      invalidate("\"released\":true", "\"released\":1"), invalidate("\"n0\"", "\"n\xff\""),
+      invalidate("\"n0\"", "\"n\x01\""), invalidate("\"n0\"", "\"n\\x\""),
+      invalidate("\"n0\"", "\"\\ud83d\""), invalidate("]", ",]"), invalidate(":3", ":03"),
+      invalidate(":3", ":3."), invalidate(":true", ":tru"),
+      invalidate("\"actionType\":\"pick\"", "\"actionType\":null"));
+
+  CAPTURE(payload);
+  vda5050::Order order;
+  REQUIRE_THROWS_AS(vda5050pp::core::messages::decode(payload, order),
+                    vda5050pp::VDA5050PPJsonError);
+  REQUIRE_THROWS_AS(vda5050::json::parse(payload).get<vda5050::Order>(), vda5050::json::exception);
+}
+
+TEST_CASE("core::messages::decode - protocol limits", "[core][messages]") {
+  auto payload = vda5050::json(mkFullOrder()).dump();
+  vda5050pp::agv_description::SimpleProtocolLimits limits;
+  vda5050::Order order;
+
+  SECTION("Messages within the limits are accepted") {
+    limits.max_message_len = uint32_t(payload.size());
+    limits.max_id_len = 5;
+    limits.max_order_nodes = 2;
+    limits.max_order_edges = 1;
+    limits.max_node_actions = 2;
+    limits.max_edge_actions = 1;
+    limits.max_action_parameters = 3;
+    REQUIRE_NOTHROW(vda5050pp::core::messages::decode(payload, order, limits));
+  }
+
+  SECTION("Each exceeded limit is rejected") {
+    auto limit = GENERATE(&vda5050pp::agv_description::SimpleProtocolLimits::max_id_len,
+                          &vda5050pp::agv_description::SimpleProtocolLimits::max_order_nodes,
+                          &vda5050pp::agv_description::SimpleProtocolLimits::max_order_edges,
+                          &vda5050pp::agv_description::SimpleProtocolLimits::max_node_actions,
+                          &vda5050pp::agv_description::SimpleProtocolLimits::max_edge_actions,
+                          &vda5050pp::agv_description::SimpleProtocolLimits::max_action_parameters);
+    limits.*limit = 0;
+    REQUIRE_THROWS_AS(vda5050pp::core::messages::decode(payload, order, limits),
+                      vda5050pp::VDA5050PPProtocolLimitExceeded);
+  }
+
+  SECTION("An oversized message is rejected before it is read") {
+    limits.max_message_len = uint32_t(payload.size() - 1);
+    REQUIRE_THROWS_AS(vda5050pp::core::messages::decode(payload, order, limits),
+                      vda5050pp::VDA5050PPProtocolLimitExceeded);
+  }
+
+  SECTION("A too long array is rejected after reading only its allowed prefix") {
+    // The message ends within the second node, so reading any further would fail
+    limits.max_order_nodes = 1;
+    std::string truncated =
+        R"({"nodes":[{"actions":[],"nodeId":"n0","released":true,"sequenceId":0},{"nodeId":)";
+    REQUIRE_THROWS_AS(vda5050pp::core::messages::decode(truncated, order, limits),
+                      vda5050pp::VDA5050PPProtocolLimitExceeded);
+  }
+
+  SECTION("InstantActions are limited") {
+    vda5050::InstantActions instant_actions;
+    instant_actions.actions = {mkAction("i0"), mkAction("i1")};
+    auto ia_payload = vda5050::json(instant_actions).dump();
+
+    limits.max_instant_actions = 1;
+    REQUIRE_THROWS_AS(vda5050pp::core::messages::decode(ia_payload, instant_actions, limits),
+                      vda5050pp::VDA5050PPProtocolLimitExceeded);
+  }
+}
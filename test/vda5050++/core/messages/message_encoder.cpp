@@ -0,0 +1,284 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+//
+
+#include "vda5050++/core/messages/message_encoder.h"
+
+#include <catch2/catch_all.hpp>
+#include <limits>
+
+#include "vda5050++/exception.h"
+
+template <typename MessageT> static std::string encodeToString(const MessageT &message) {
+  vda5050pp::core::messages::JsonWriter writer;
+  writer.reset();
+  vda5050pp::core::messages::encode(writer, message);
+  return writer.take();
+}
+
+static const std::string k_nasty_string =
+    "quote\" backslash\\ slash/ \b\f\n\r\t \x01\x1f\x7f unicode \xc3\xbc \xe2\x82\xac";
+
+static vda5050::HeaderVDA5050 mkHeader() {
+  vda5050::HeaderVDA5050 header;
+  header.headerId = 4294967295;
+  header.manufacturer = "manufacturer";
+  header.serialNumber = k_nasty_string;
+  header.version = "2.0.0";
+  header.timestamp = std::chrono::system_clock::now();
+  return header;
+}
+
+static vda5050::AGVPosition mkAgvPosition() {
+  vda5050::AGVPosition agv_position;
+  agv_position.positionInitialized = true;
+  agv_position.localizationScore = 0.1;
+  agv_position.deviationRange = 1e-7;
+  agv_position.x = 1e21;
+  agv_position.y = -0.0;
+  agv_position.theta = 1.0 / 3.0;
+  agv_position.mapId = "map";
+  agv_position.mapDescription = k_nasty_string;
+  return agv_position;
+}
+
+static vda5050::State mkFullState() {
+  vda5050::State state;
+  state.header = mkHeader();
+  state.orderId = "order";
+  state.orderUpdateId = 7;
+  state.zoneSetId = "zone";
+  state.lastNodeId = "n1";
+  state.lastNodeSequenceId = 2;
+  state.driving = true;
+  state.paused = false;
+  state.newBaseRequest = true;
+  state.distanceSinceLastNode = std::numeric_limits<double>::quiet_NaN();
+  state.operatingMode = vda5050::OperatingMode::AUTOMATIC;
+
+  auto &node_state = state.nodeStates.emplace_back();
+  node_state.nodeId = "n2";
+  node_state.sequenceId = 4;
+  node_state.nodeDescription = k_nasty_string;
+  node_state.released = true;
+  node_state.nodePosition.emplace();
+  node_state.nodePosition->x = 3.0;
+  node_state.nodePosition->y = -2.5;
+  node_state.nodePosition->theta = 3.14159;
+  node_state.nodePosition->allowedDeviationXY = 0.5;
+  node_state.nodePosition->allowedDeviationTheta = 0.25;
+  node_state.nodePosition->mapId = "map";
+  node_state.nodePosition->mapDescription = "description";
+  state.nodeStates.emplace_back().nodeId = "n3";
+
+  auto &edge_state = state.edgeStates.emplace_back();
+  edge_state.edgeId = "e1";
+  edge_state.sequenceId = 3;
+  edge_state.edgeDescription = "edge";
+  edge_state.released = false;
+  edge_state.trajectory.emplace();
+  edge_state.trajectory->degree = 2;
+  edge_state.trajectory->knotVector = {0.0, 0.5, 1.0};
+  edge_state.trajectory->controlPoints.emplace_back().x = 1.0;
+  edge_state.trajectory->controlPoints.back().weight = 0.3;
+  edge_state.trajectory->controlPoints.emplace_back().y = 2.0;
+  state.edgeStates.emplace_back().edgeId = "e2";
+
+  state.agvPosition = mkAgvPosition();
+  state.velocity.emplace();
+  state.velocity->vx = 0.7;
+  state.velocity->omega = -std::numeric_limits<double>::infinity();
+
+  auto &load = state.loads.emplace().emplace_back();
+  load.loadId = "load";
+  load.loadType = "type";
+  load.loadPosition = "front";
+  load.weight = 12.5;
+  load.boundingBoxReference = vda5050::BoundingBoxReference{};
+  load.boundingBoxReference->x = 1;
+  load.boundingBoxReference->y = 2;
+  load.boundingBoxReference->theta = 0.1;
+  load.loadDimensions = vda5050::LoadDimensions{};
+  load.loadDimensions->length = 1.2;
+  load.loadDimensions->width = 0.8;
+  load.loadDimensions->height = 1.5;
+  state.loads->emplace_back();
+
+  auto &action_state = state.actionStates.emplace_back();
+  action_state.actionId = "a1";
+  action_state.actionType = "pick";
+  action_state.actionDescription = k_nasty_string;
+  action_state.actionStatus = vda5050::ActionStatus::FINISHED;
+  action_state.resultDescription = "result";
+  state.actionStates.emplace_back().actionId = "a2";
+
+  state.batteryState.batteryCharge = 99.5;
+  state.batteryState.batteryVoltage = 48.2;
+  state.batteryState.batteryHealth = 50;
+  state.batteryState.charging = true;
+  state.batteryState.reach = 1000;
+
+  auto &error = state.errors.emplace_back();
+  error.errorType = "type";
+  error.errorLevel = vda5050::ErrorLevel::FATAL;
+  error.errorDescription = k_nasty_string;
+  error.errorReferences = std::vector<vda5050::ErrorReference>{};
+  error.errorReferences->emplace_back().referenceKey = "key";
+  error.errorReferences->back().referenceValue = "value";
+  state.errors.emplace_back().errorType = "type2";
+
+  auto &info = state.information.emplace().emplace_back();
+  info.infoType = "type";
+  info.infoDescription = "description";
+  info.infoReferences.emplace().emplace_back().referenceKey = "key";
+  info.infoReferences->back().referenceValue = k_nasty_string;
+
+  state.safetyState.fieldViolation = true;
+  return state;
+}
+
+TEST_CASE("core::messages::encode - byte identical to vda5050::json::dump",
+          "[core][messages]") {
+  SECTION("Default State") {
+    vda5050::State state;
+    state.header = mkHeader();
+    REQUIRE(encodeToString(state) == vda5050::json(state).dump());
+  }
+
+  SECTION("Full State") {
+    auto state = mkFullState();
+    REQUIRE(encodeToString(state) == vda5050::json(state).dump());
+  }
+
+  SECTION("Visualization") {
+    vda5050::Visualization visualization;
+    visualization.header = mkHeader();
+    REQUIRE(encodeToString(visualization) == vda5050::json(visualization).dump());
+
+    // An empty velocity is serialized as null
+    visualization.velocity.emplace();
+    REQUIRE(encodeToString(visualization) == vda5050::json(visualization).dump());
+
+    visualization.agvPosition = mkAgvPosition();
+    visualization.velocity->vy = 0.1;
+    REQUIRE(encodeToString(visualization) == vda5050::json(visualization).dump());
+  }
+
+  SECTION("Connection") {
+    vda5050::Connection connection;
+    connection.header = mkHeader();
+    connection.connectionState = vda5050::ConnectionState::CONNECTIONBROKEN;
+    REQUIRE(encodeToString(connection) == vda5050::json(connection).dump());
+  }
+
+  SECTION("AgvFactsheet") {
+    vda5050::AgvFactsheet factsheet;
+    factsheet.header = mkHeader();
+    REQUIRE(encodeToString(factsheet) == vda5050::json(factsheet).dump());
+  }
+}
+
+TEST_CASE("core::messages::JsonWriter - reuse", "[core][messages]") {
+  vda5050pp::core::messages::JsonWriter writer;
+  auto state = mkFullState();
+  auto expected = vda5050::json(state).dump();
+
+  writer.reset();
+  vda5050pp::core::messages::encode(writer, state);
+  REQUIRE(writer.take() == expected);
+
+  // The buffer was handed out, the writer starts from scratch
+  writer.reset();
+  REQUIRE(writer.view().empty());
+  vda5050pp::core::messages::encode(writer, state);
+  REQUIRE(writer.view() == expected);
+
+  // Resetting without taking the text keeps the buffer
+  writer.reset();
+  writer.beginArray();
+  writer.value(1);
+  writer.value(-1);
+  writer.value(0.5f);
+  writer.null();
+  writer.endArray();
+  REQUIRE(writer.take() == "[1,-1,0.5,null]");
+}
+
+TEST_CASE("core::messages::JsonWriter - invalid UTF-8", "[core][messages]") {
+  vda5050pp::core::messages::JsonWriter writer;
+  writer.reset();
+
+  WHEN("A string is valid UTF-8") {
+    // 2, 3 and 4 byte sequences, including the bounds of the restricted second bytes
+    std::string str = "\xc3\xa4 \xe2\x82\xac \xf0\x9f\x98\x80 \xe0\xa0\x80 \xed\x9f\xbf "
+                      "\xf4\x8f\xbf\xbf";
+    writer.value(str);
+
+    THEN("It is written like nlohmann does") {
+      REQUIRE(writer.take() == vda5050::json(str).dump());
+    }
+  }
+
+  WHEN("A string is not valid UTF-8") {
+    auto str = GENERATE(as<std::string>(), "invalid \xff", "overlong \xc0\xaf",
+                        "surrogate \xed\xa0\x80", "too large \xf4\x90\x80\x80",
+                        "bad continuation \xc3\x28", "incomplete \xe2\x82");
+
+    THEN("It throws like nlohmann does") {
+      REQUIRE_THROWS_AS(writer.value(str), vda5050pp::VDA5050PPJsonError);
+      REQUIRE_THROWS(vda5050::json(str).dump());
+    }
+  }
+}
+
+TEST_CASE("core::messages::encode - State fragment cache", "[core][messages]") {
+  vda5050pp::core::messages::StateFragmentCache cache;
+  vda5050pp::core::state::StateRevisions revisions;
+  revisions.graph = vda5050pp::core::state::nextStateRevision();
+  revisions.action_states = vda5050pp::core::state::nextStateRevision();
+  revisions.loads = vda5050pp::core::state::nextStateRevision();
+  revisions.errors = vda5050pp::core::state::nextStateRevision();
+  revisions.information = vda5050pp::core::state::nextStateRevision();
+
+  auto encode_cached = [&cache, &revisions](const vda5050::State &state) {
+    vda5050pp::core::messages::JsonWriter writer;
+    writer.reset();
+    vda5050pp::core::messages::encode(writer, state, revisions, cache);
+    return writer.take();
+  };
+
+  auto state = mkFullState();
+  REQUIRE(encode_cached(state) == vda5050::json(state).dump());
+  REQUIRE_FALSE(cache.node_states.json.empty());
+
+  SECTION("Unchanged parts are reused") {
+    state.driving = false;
+    state.agvPosition->x = 5.0;
+    auto expected = vda5050::json(state).dump();
+
+    // Same revisions -> the cached (previous) encoding is spliced in
+    state.nodeStates.clear();
+    state.actionStates.clear();
+    REQUIRE(encode_cached(state) == expected);
+  }
+
+  SECTION("Changed revisions are encoded again") {
+    state.nodeStates.pop_back();
+    state.actionStates.front().actionStatus = vda5050::ActionStatus::FAILED;
+    state.loads.reset();
+    revisions.graph = vda5050pp::core::state::nextStateRevision();
+    revisions.action_states = vda5050pp::core::state::nextStateRevision();
+    revisions.loads = vda5050pp::core::state::nextStateRevision();
+    REQUIRE(encode_cached(state) == vda5050::json(state).dump());
+  }
+
+  SECTION("Unknown revisions are never cached") {
+    revisions = {};
+    state.errors.clear();
+    REQUIRE(encode_cached(state) == vda5050::json(state).dump());
+  }
+}
@@ -6,6 +6,10 @@
 //
 
 #include <catch2/catch_all.hpp>
+#include <future>
+#include <mutex>
+#include <string>
+#include <vector>
 
 #include "vda5050++/core/instance.h"
 
@@ -140,4 +144,127 @@ TEST_CASE("core::messages::MessageEventHandler behaviour", "[core][messages][eve
 
     THEN("All errors were dispatched") { REQUIRE(received_errors == std::list{e1, e2, e3}); }
   }
-}
\ No newline at end of file
+}
+
+#ifdef LIBVDA5050PP_COROUTINES
+TEST_CASE("core::messages::MessageEventHandler - order of awaited validations",
+          "[core][messages][events]") {
+  using namespace std::chrono_literals;
+
+  vda5050pp::Config cfg;
+  cfg.refGlobalConfig().useWhiteList();
+  cfg.refGlobalConfig().refEventManagerOptions().synchronous_event_dispatch = true;
+  cfg.refGlobalConfig().bwListModule(vda5050pp::core::module_keys::k_message_event_handler_key);
+
+  vda5050pp::core::Instance::reset();
+  auto instance = vda5050pp::core::Instance::init(cfg).lock();
+
+  std::mutex mutex;
+  std::vector<std::string> valid_orders;
+  std::promise<void> both_valid;
+  auto msg_sub = instance->getMessageEventManager().getScopedSubscriber();
+  msg_sub.subscribe<vda5050pp::core::events::ValidOrderMessageEvent>([&](auto evt) {
+    std::unique_lock lock(mutex);
+    valid_orders.push_back(evt->valid_order->orderId);
+    if (valid_orders.size() == 2) {
+      both_valid.set_value();
+    }
+  });
+
+  // The first validation is held back (i.e. awaiting a zone set query), the second succeeds
+  std::shared_ptr<vda5050pp::core::events::ValidateOrderEvent> held_back;
+  auto valid_sub = instance->getValidationEventManager().getScopedSubscriber();
+  valid_sub.subscribe<vda5050pp::core::events::ValidateOrderEvent>([&held_back](auto evt) {
+    if (evt->order->orderId == "order_1") {
+      held_back = evt;
+      return;
+    }
+    auto tkn = evt->acquireResultToken();
+    tkn.setValue(std::list<vda5050::Error>{});
+  });
+
+  for (const auto &order_id : {"order_1", "order_2"}) {
+    auto evt = std::make_shared<vda5050pp::core::events::ReceiveOrderMessageEvent>();
+    evt->order = std::make_shared<vda5050::Order>();
+    evt->order->orderId = order_id;
+    evt->order->orderUpdateId = 0;
+    instance->getMessageEventManager().dispatch(evt);
+  }
+
+  THEN("The later order is not passed on before the earlier one") {
+    {
+      std::unique_lock lock(mutex);
+      REQUIRE(valid_orders.empty());
+    }
+    REQUIRE(held_back != nullptr);
+    auto tkn = held_back->acquireResultToken();
+    tkn.setValue(std::list<vda5050::Error>{});
+
+    REQUIRE(both_valid.get_future().wait_for(1s) == std::future_status::ready);
+    std::unique_lock lock(mutex);
+    REQUIRE(valid_orders == std::vector<std::string>{"order_1", "order_2"});
+  }
+}
+
+TEST_CASE("core::messages::MessageEventHandler - instant actions after awaited validations",
+          "[core][messages][events]") {
+  using namespace std::chrono_literals;
+
+  vda5050pp::Config cfg;
+  cfg.refGlobalConfig().useWhiteList();
+  cfg.refGlobalConfig().refEventManagerOptions().synchronous_event_dispatch = true;
+  cfg.refGlobalConfig().bwListModule(vda5050pp::core::module_keys::k_message_event_handler_key);
+
+  vda5050pp::core::Instance::reset();
+  auto instance = vda5050pp::core::Instance::init(cfg).lock();
+
+  std::mutex mutex;
+  std::vector<std::string> valid_messages;
+  std::promise<void> both_valid;
+  auto on_valid = [&](std::string msg) {
+    std::unique_lock lock(mutex);
+    valid_messages.push_back(std::move(msg));
+    if (valid_messages.size() == 2) {
+      both_valid.set_value();
+    }
+  };
+  auto msg_sub = instance->getMessageEventManager().getScopedSubscriber();
+  msg_sub.subscribe<vda5050pp::core::events::ValidOrderMessageEvent>(
+      [&](auto evt) { on_valid(evt->valid_order->orderId); });
+  msg_sub.subscribe<vda5050pp::core::events::ValidInstantActionMessageEvent>(
+      [&](auto) { on_valid("instant_actions"); });
+
+  // The order validation is held back (i.e. awaiting a zone set query)
+  std::shared_ptr<vda5050pp::core::events::ValidateOrderEvent> held_back;
+  auto valid_sub = instance->getValidationEventManager().getScopedSubscriber();
+  valid_sub.subscribe<vda5050pp::core::events::ValidateOrderEvent>(
+      [&held_back](auto evt) { held_back = evt; });
+  valid_sub.subscribe<vda5050pp::core::events::ValidateInstantActionsEvent>([](auto evt) {
+    auto tkn = evt->acquireResultToken();
+    tkn.setValue(std::list<vda5050::Error>{});
+  });
+
+  auto order_evt = std::make_shared<vda5050pp::core::events::ReceiveOrderMessageEvent>();
+  order_evt->order = std::make_shared<vda5050::Order>();
+  order_evt->order->orderId = "order_1";
+  order_evt->order->orderUpdateId = 0;
+  instance->getMessageEventManager().dispatch(order_evt);
+  auto ia_evt = std::make_shared<vda5050pp::core::events::ReceiveInstantActionMessageEvent>();
+  ia_evt->instant_actions = std::make_shared<vda5050::InstantActions>();
+  instance->getMessageEventManager().dispatch(ia_evt);
+
+  THEN("The instant actions are not passed on before the earlier order") {
+    {
+      std::unique_lock lock(mutex);
+      REQUIRE(valid_messages.empty());
+    }
+    REQUIRE(held_back != nullptr);
+    auto tkn = held_back->acquireResultToken();
+    tkn.setValue(std::list<vda5050::Error>{});
+
+    REQUIRE(both_valid.get_future().wait_for(1s) == std::future_status::ready);
+    std::unique_lock lock(mutex);
+    REQUIRE(valid_messages == std::vector<std::string>{"order_1", "instant_actions"});
+  }
+}
+#endif
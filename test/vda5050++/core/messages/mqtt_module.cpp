@@ -0,0 +1,140 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+//
+// These tests need a local MQTT 5 broker (VDA5050PP_TEST_BROKER, default tcp://localhost:1883)
+// and are skipped, if there is none.
+//
+
+#include "vda5050++/core/messages/mqtt_module.h"
+
+#include <mqtt/async_client.h>
+
+#include <catch2/catch_all.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "vda5050++/core/instance.h"
+#include "vda5050++/observer/message_observer.h"
+
+using namespace std::chrono_literals;
+
+static std::string getBroker() {
+  const char *broker = std::getenv("VDA5050PP_TEST_BROKER");
+  return broker != nullptr ? broker : "tcp://localhost:1883";
+}
+
+TEST_CASE("core::messages::MqttModule - MQTT 5", "[core][messages][mqtt]") {
+  // Independent client, which receives everything the module sends
+  mqtt::async_client observer_client(getBroker(), "vda5050pp_test_observer",
+                                     mqtt::create_options(MQTTVERSION_5));
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::vector<mqtt::const_message_ptr> states;
+  std::vector<mqtt::const_message_ptr> visualizations;
+  observer_client.set_message_callback([&](mqtt::const_message_ptr msg) {
+    std::unique_lock lock(mutex);
+    if (msg->get_topic() == "uagv/v2/test_manufacturer/test_serial/state") {
+      states.push_back(msg);
+    } else if (msg->get_topic() == "uagv/v2/test_manufacturer/test_serial/visualization") {
+      visualizations.push_back(msg);
+    }
+    cv.notify_all();
+  });
+
+  try {
+    if (!observer_client.connect(mqtt::connect_options::v5())->wait_for(2s)) {
+      SKIP("No MQTT broker reachable at " << getBroker());
+    }
+  } catch (const mqtt::exception &) {
+    SKIP("No MQTT broker reachable at " << getBroker());
+  }
+  observer_client.subscribe("uagv/v2/test_manufacturer/test_serial/#", 1)->wait();
+
+  vda5050pp::Config cfg;
+  cfg.refGlobalConfig().useWhiteList();
+  cfg.refGlobalConfig().bwListModule(vda5050pp::core::module_keys::k_mqtt_key);
+  cfg.refAgvDescription().agv_id = "test_agv";
+  cfg.refAgvDescription().manufacturer = "test_manufacturer";
+  cfg.refAgvDescription().serial_number = "test_serial";
+  auto &opts = cfg.refMqttSubConfig().refOptions();
+  opts.server = getBroker();
+  opts.interface = "uagv";
+  opts.use_ssl = false;
+  opts.enable_cert_check = false;
+  opts.mqtt_version = 5;
+  opts.visualization_ttl_ = 10s;
+  vda5050pp::core::Instance::reset();
+  auto instance = vda5050pp::core::Instance::init(cfg).lock();
+
+  vda5050pp::observer::MessageObserver message_observer;
+  auto module = std::dynamic_pointer_cast<vda5050pp::core::messages::MqttModule>(
+      vda5050pp::core::Instance::lookupModule(vda5050pp::core::module_keys::k_mqtt_key).lock());
+  REQUIRE(module != nullptr);
+  module->connect();
+
+  auto online = [&message_observer] {
+    return message_observer.getConnectionStatus() == vda5050pp::misc::ConnectionStatus::k_online;
+  };
+  for (int i = 0; i < 50 && !online(); i++) {
+    std::this_thread::sleep_for(100ms);
+  }
+  REQUIRE(online());
+
+  WHEN("Several states and visualizations are sent with topic aliases") {
+    constexpr uint32_t k_n = 5;
+    for (uint32_t i = 0; i < k_n; i++) {
+      vda5050::State state;
+      state.header.headerId = i;
+      module->sendState(state);
+      vda5050::Visualization visualization;
+      visualization.header.headerId = i;
+      module->sendVisualization(visualization);
+    }
+
+    std::unique_lock lock(mutex);
+    REQUIRE(cv.wait_for(lock, 5s, [&] {
+      return states.size() == k_n && visualizations.size() == k_n;
+    }));
+
+    THEN("The broker resolves the aliases and keeps the order") {
+      for (uint32_t i = 0; i < k_n; i++) {
+        REQUIRE(vda5050::json::parse(states[i]->get_payload_str())["headerId"] == i);
+        REQUIRE(vda5050::json::parse(visualizations[i]->get_payload_str())["headerId"] == i);
+      }
+    }
+
+    THEN("Visualizations carry a message expiry interval") {
+      for (const auto &msg : visualizations) {
+        REQUIRE(msg->get_properties().contains(mqtt::property::MESSAGE_EXPIRY_INTERVAL));
+        REQUIRE(mqtt::get<uint32_t>(msg->get_properties(),
+                                    mqtt::property::MESSAGE_EXPIRY_INTERVAL) <= 10);
+      }
+      for (const auto &msg : states) {
+        REQUIRE_FALSE(msg->get_properties().contains(mqtt::property::MESSAGE_EXPIRY_INTERVAL));
+      }
+    }
+
+    THEN("The module is still online") { REQUIRE(online()); }
+
+    THEN("The publishes are tracked") {
+      auto stats = message_observer.getPublishStatistics();
+      REQUIRE(stats.size() == 4);
+      REQUIRE(stats[2].topic == "state");
+      REQUIRE(stats[2].published == k_n);
+      REQUIRE(stats[2].delivered + stats[2].failed + stats[2].in_flight == k_n);
+      REQUIRE(stats[2].event_to_publish.getCount() == k_n);
+    }
+  }
+
+  module->disconnect();
+  observer_client.disconnect()->wait();
+  vda5050pp::core::Instance::reset();
+}
@@ -0,0 +1,118 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+//
+
+#include "vda5050++/core/messages/outbound_buffer.h"
+
+#include <catch2/catch_all.hpp>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+using Buffer = vda5050pp::core::messages::OutboundBuffer<std::shared_ptr<int>>;
+
+TEST_CASE("core::messages::OutboundBuffer", "[core][messages]") {
+  Buffer buffer(3);
+  std::vector<int> published;
+  auto publish = [&published](std::shared_ptr<int> msg) { published.push_back(*msg); };
+
+  SECTION("The latest message of a slot wins") {
+    REQUIRE(buffer.offer(1, std::make_shared<int>(10)));
+    REQUIRE(buffer.offer(1, std::make_shared<int>(11)));
+    REQUIRE(buffer.offer(1, std::make_shared<int>(12)));
+
+    auto statistics = buffer.statistics();
+    REQUIRE(statistics.buffered == 3);
+    REQUIRE(statistics.coalesced == 2);
+    REQUIRE(statistics.pending == 1);
+
+    REQUIRE(buffer.flush(publish) == 1);
+    REQUIRE(published == std::vector<int>{12});
+    REQUIRE(buffer.statistics().flushed == 1);
+    REQUIRE(buffer.statistics().pending == 0);
+  }
+
+  SECTION("Messages are flushed in slot order") {
+    REQUIRE(buffer.offer(2, std::make_shared<int>(2)));
+    REQUIRE(buffer.offer(0, std::make_shared<int>(0)));
+    REQUIRE(buffer.offer(1, std::make_shared<int>(1)));
+
+    REQUIRE(buffer.flush(publish) == 3);
+    REQUIRE(published == std::vector<int>{0, 1, 2});
+  }
+
+  SECTION("Online, messages are not buffered") {
+    REQUIRE(buffer.flush(publish) == 0);
+    REQUIRE_FALSE(buffer.offer(0, std::make_shared<int>(0)));
+
+    buffer.goOffline();
+    REQUIRE(buffer.offer(0, std::make_shared<int>(0)));
+    REQUIRE_FALSE(buffer.offer(3, std::make_shared<int>(3)));
+  }
+
+  SECTION("Messages offered during a flush are published by the same flush") {
+    REQUIRE(buffer.offer(2, std::make_shared<int>(2)));
+
+    auto publish_and_offer = [&](std::shared_ptr<int> msg) {
+      published.push_back(*msg);
+      if (*msg == 2) {
+        REQUIRE(buffer.offer(0, std::make_shared<int>(0)));
+      }
+    };
+
+    REQUIRE(buffer.flush(publish_and_offer) == 2);
+    REQUIRE(published == std::vector<int>{2, 0});
+    REQUIRE_FALSE(buffer.offer(0, std::make_shared<int>(0)));
+  }
+
+  SECTION("A failing publish does not stop the flush") {
+    REQUIRE(buffer.offer(0, std::make_shared<int>(0)));
+    REQUIRE(buffer.offer(1, std::make_shared<int>(1)));
+    REQUIRE(buffer.offer(2, std::make_shared<int>(2)));
+
+    auto failing_publish = [&published](std::shared_ptr<int> msg) {
+      if (*msg == 1) {
+        throw std::runtime_error("publish failed");
+      }
+      published.push_back(*msg);
+    };
+
+    REQUIRE(buffer.flush(failing_publish) == 2);
+    REQUIRE(published == std::vector<int>{0, 2});
+    REQUIRE(buffer.statistics().flushed == 2);
+    REQUIRE(buffer.statistics().dropped == 1);
+    REQUIRE_FALSE(buffer.offer(0, std::make_shared<int>(0)));
+  }
+
+  SECTION("Expired messages are dropped") {
+    buffer.configure(true, 1ms);
+    REQUIRE(buffer.offer(0, std::make_shared<int>(0)));
+    std::this_thread::sleep_for(5ms);
+
+    REQUIRE(buffer.flush(publish) == 0);
+    REQUIRE(published.empty());
+    REQUIRE(buffer.statistics().dropped == 1);
+    REQUIRE(buffer.statistics().pending == 0);
+  }
+
+  SECTION("Disabling and clearing drops buffered messages") {
+    REQUIRE(buffer.offer(0, std::make_shared<int>(0)));
+    buffer.clear();
+    REQUIRE(buffer.statistics().dropped == 1);
+
+    REQUIRE(buffer.offer(1, std::make_shared<int>(1)));
+    buffer.configure(false, std::nullopt);
+    REQUIRE(buffer.statistics().dropped == 2);
+    REQUIRE_FALSE(buffer.offer(1, std::make_shared<int>(1)));
+
+    REQUIRE(buffer.flush(publish) == 0);
+    REQUIRE(buffer.statistics().pending == 0);
+  }
+}
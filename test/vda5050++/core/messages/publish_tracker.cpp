@@ -0,0 +1,82 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+//
+
+#include "vda5050++/core/messages/publish_tracker.h"
+
+#include <catch2/catch_all.hpp>
+#include <chrono>
+
+#include "vda5050++/exception.h"
+
+using namespace std::chrono_literals;
+using vda5050pp::core::messages::PublishTracker;
+
+TEST_CASE("core::messages::PublishTracker", "[core][messages]") {
+  PublishTracker tracker({"state", "visualization"});
+
+  SECTION("Delivered publishes are recorded") {
+    auto created = PublishTracker::Clock::now() - 5ms;
+    auto *context = tracker.beginPublish(0, 100, created);
+
+    auto stats = tracker.snapshot();
+    REQUIRE(stats.size() == 2);
+    REQUIRE(stats[0].topic == "state");
+    REQUIRE(stats[0].published == 1);
+    REQUIRE(stats[0].in_flight == 1);
+    REQUIRE(stats[0].buffered_bytes == 100);
+    REQUIRE(stats[0].event_to_publish.getCount() == 1);
+    REQUIRE(stats[0].event_to_publish.getMin() >= 5ms);
+    REQUIRE(stats[1].published == 0);
+
+    tracker.endPublish(context, true);
+
+    stats = tracker.snapshot();
+    REQUIRE(stats[0].delivered == 1);
+    REQUIRE(stats[0].failed == 0);
+    REQUIRE(stats[0].in_flight == 0);
+    REQUIRE(stats[0].buffered_bytes == 0);
+    REQUIRE(stats[0].publish_to_delivery.getCount() == 1);
+  }
+
+  SECTION("Failed publishes are counted, but not in the delivery latency") {
+    auto *context = tracker.beginPublish(1, 10, PublishTracker::Clock::now());
+    tracker.endPublish(context, false);
+
+    auto stats = tracker.snapshot();
+    REQUIRE(stats[1].failed == 1);
+    REQUIRE(stats[1].delivered == 0);
+    REQUIRE(stats[1].in_flight == 0);
+    REQUIRE(stats[1].publish_to_delivery.getCount() == 0);
+  }
+
+  SECTION("Unknown and finished contexts are ignored") {
+    auto *context = tracker.beginPublish(0, 10, PublishTracker::Clock::now());
+    tracker.endPublish(context, true);
+    tracker.endPublish(context, true);
+    tracker.endPublish(nullptr, true);
+
+    REQUIRE(tracker.snapshot()[0].delivered == 1);
+  }
+
+  SECTION("Clearing fails all pending publishes") {
+    tracker.beginPublish(0, 10, PublishTracker::Clock::now());
+    tracker.beginPublish(1, 20, PublishTracker::Clock::now());
+    tracker.clear();
+
+    auto stats = tracker.snapshot();
+    REQUIRE(stats[0].failed == 1);
+    REQUIRE(stats[1].failed == 1);
+    REQUIRE(stats[0].in_flight == 0);
+    REQUIRE(stats[1].buffered_bytes == 0);
+  }
+
+  SECTION("Unknown topics throw") {
+    REQUIRE_THROWS_AS(tracker.beginPublish(2, 10, PublishTracker::Clock::now()),
+                      vda5050pp::VDA5050PPInvalidArgument);
+  }
+}
@@ -0,0 +1,273 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+
+#include "vda5050++/core/messages/shared_connection.h"
+
+#include <catch2/catch_all.hpp>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "vda5050++/core/messages/loopback_transport.h"
+#include "vda5050++/exception.h"
+
+using vda5050pp::core::messages::LoopbackTransport;
+using vda5050pp::core::messages::SharedConnection;
+
+///
+///\brief Records all notifications of a single endpoint (in place of an MqttModule).
+///
+class RecordingModule : public mqtt::callback, public mqtt::iaction_listener {
+public:
+  std::mutex mutex;
+  std::shared_ptr<vda5050pp::core::messages::Transport> transport;
+  std::vector<std::string> received;
+  std::vector<void *> completed;
+  int connected_count = 0;
+  int lost_count = 0;
+
+  RecordingModule(SharedConnection &connection, const std::string &serial)
+      : transport(connection.attach()), serial_(serial) {
+    this->transport->setCallbacks(*this, *this, [this](void *context, bool) {
+      std::unique_lock lock(this->mutex);
+      this->completed.push_back(context);
+    });
+  }
+
+  void connected(const std::string &) override {
+    this->transport->subscribe("uagv/v2/manufacturer/" + this->serial_ + "/order", 0);
+    this->transport->subscribe("uagv/v2/manufacturer/" + this->serial_ + "/instantActions", 0);
+    std::unique_lock lock(this->mutex);
+    this->connected_count++;
+  }
+  void connection_lost(const std::string &) override {
+    std::unique_lock lock(this->mutex);
+    this->lost_count++;
+  }
+  void message_arrived(mqtt::const_message_ptr msg) override {
+    std::unique_lock lock(this->mutex);
+    this->received.push_back(msg->get_topic());
+  }
+  void on_failure(const mqtt::token &) override {}
+  void on_success(const mqtt::token &) override {}
+
+private:
+  std::string serial_;
+};
+
+///
+///\brief Counts the connects and disconnects of the shared connection (paho reconnects on its
+/// own, this is simulated by calling connect() on the LoopbackTransport directly).
+///
+class CountingTransport : public vda5050pp::core::messages::Transport {
+public:
+  std::shared_ptr<LoopbackTransport> loopback = std::make_shared<LoopbackTransport>();
+  int connects = 0;
+  int disconnects = 0;
+  // Called on each subscription, before it is forwarded
+  std::function<void()> on_subscribe;
+
+  void setCallbacks(mqtt::callback &callback, mqtt::iaction_listener &connect_listener,
+                    PublishCompletion completion) override {
+    this->loopback->setCallbacks(callback, connect_listener, std::move(completion));
+  }
+  void connect() override {
+    this->connects++;
+    this->loopback->connect();
+  }
+  void disconnect() override {
+    this->disconnects++;
+    this->loopback->disconnect();
+  }
+  void subscribe(const std::string &topic, int qos) override {
+    if (this->on_subscribe) {
+      std::exchange(this->on_subscribe, nullptr)();
+    }
+    this->loopback->subscribe(topic, qos);
+  }
+  void publish(mqtt::const_message_ptr msg, void *context) override {
+    this->loopback->publish(std::move(msg), context);
+  }
+};
+
+TEST_CASE("core::messages::SharedConnection - wildcards", "[core][messages]") {
+  REQUIRE(SharedConnection::wildcardOf("uagv/v2/manufacturer/serial/order") ==
+          "uagv/v2/manufacturer/+/order");
+  REQUIRE(SharedConnection::wildcardOf("a/b/c") == "a/+/c");
+  REQUIRE_THROWS_AS(SharedConnection::wildcardOf("order"), vda5050pp::VDA5050PPInvalidArgument);
+  REQUIRE_THROWS_AS(SharedConnection::wildcardOf("/order"), vda5050pp::VDA5050PPInvalidArgument);
+}
+
+TEST_CASE("core::messages::SharedConnection - multiplexing serial numbers", "[core][messages]") {
+  auto transport = std::make_shared<LoopbackTransport>();
+  auto connection = std::make_shared<SharedConnection>(transport);
+
+  RecordingModule module_a(*connection, "serial_a");
+  RecordingModule module_b(*connection, "serial_b");
+  module_a.transport->connect();
+  module_b.transport->connect();
+
+  THEN("Both endpoints are connected") {
+    REQUIRE(module_a.connected_count == 1);
+    REQUIRE(module_b.connected_count == 1);
+  }
+
+  WHEN("Messages are received") {
+    transport->inject("uagv/v2/manufacturer/serial_a/order", "{}");
+    transport->inject("uagv/v2/manufacturer/serial_b/instantActions", "{}");
+    transport->inject("uagv/v2/manufacturer/serial_c/order", "{}");
+
+    THEN("They are routed by the serial number") {
+      REQUIRE(module_a.received ==
+              std::vector<std::string>{"uagv/v2/manufacturer/serial_a/order"});
+      REQUIRE(module_b.received ==
+              std::vector<std::string>{"uagv/v2/manufacturer/serial_b/instantActions"});
+    }
+  }
+
+  WHEN("Both endpoints publish") {
+    int context_a = 0;
+    int context_b = 0;
+    module_a.transport->publish(mqtt::make_message("uagv/v2/manufacturer/serial_a/state", "a"),
+                                &context_a);
+    module_b.transport->publish(mqtt::make_message("uagv/v2/manufacturer/serial_b/state", "b"),
+                                &context_b);
+
+    THEN("The messages are sent on the connection") {
+      auto captured = transport->takeCaptured();
+      REQUIRE(captured.size() == 2);
+      REQUIRE(captured[0].payload == "a");
+      REQUIRE(captured[1].payload == "b");
+    }
+
+    THEN("Each endpoint gets its own completions") {
+      REQUIRE(module_a.completed == std::vector<void *>{&context_a});
+      REQUIRE(module_b.completed == std::vector<void *>{&context_b});
+    }
+  }
+
+  WHEN("One endpoint disconnects") {
+    module_a.transport->disconnect();
+    transport->inject("uagv/v2/manufacturer/serial_a/order", "{}");
+    transport->inject("uagv/v2/manufacturer/serial_b/order", "{}");
+
+    THEN("It receives nothing, while the other one stays connected") {
+      REQUIRE(module_a.received.empty());
+      REQUIRE(module_b.received.size() == 1);
+    }
+
+    THEN("The connection is closed after the last one disconnected") {
+      module_b.transport->disconnect();
+      REQUIRE_THROWS_AS(transport->inject("uagv/v2/manufacturer/serial_b/order", "{}"),
+                        vda5050pp::VDA5050PPMqttError);
+    }
+  }
+
+  WHEN("The connection is lost and reconnects") {
+    transport->dropConnection("test");
+    transport->connect();
+
+    THEN("All endpoints are notified and connected again") {
+      REQUIRE(module_a.lost_count == 1);
+      REQUIRE(module_b.lost_count == 1);
+      REQUIRE(module_a.connected_count == 2);
+      REQUIRE(module_b.connected_count == 2);
+    }
+  }
+
+  WHEN("An endpoint is released") {
+    module_b.transport.reset();
+    transport->inject("uagv/v2/manufacturer/serial_b/order", "{}");
+
+    THEN("Its messages are dropped") { REQUIRE(module_a.received.empty()); }
+  }
+}
+
+TEST_CASE("core::messages::SharedConnection - reconnecting", "[core][messages]") {
+  auto transport = std::make_shared<CountingTransport>();
+  auto connection = std::make_shared<SharedConnection>(transport);
+
+  RecordingModule module_a(*connection, "serial_a");
+  RecordingModule module_b(*connection, "serial_b");
+  module_a.transport->connect();
+  module_b.transport->connect();
+  transport->loopback->dropConnection("test");
+
+  WHEN("An endpoint connects again, while the transport reconnects") {
+    module_a.transport->disconnect();
+    module_a.transport->connect();
+
+    THEN("The transport is not connected twice and the endpoint waits for the reconnect") {
+      REQUIRE(transport->connects == 1);
+      REQUIRE(module_a.connected_count == 1);
+    }
+
+    THEN("Both endpoints are connected after the reconnect") {
+      transport->loopback->connect();
+      REQUIRE(module_a.connected_count == 2);
+      REQUIRE(module_b.connected_count == 2);
+    }
+  }
+
+  WHEN("The last endpoint disconnects, while the transport reconnects") {
+    module_a.transport->disconnect();
+    module_b.transport->disconnect();
+
+    THEN("The transport is disconnected") { REQUIRE(transport->disconnects == 1); }
+
+    THEN("The next endpoint connects the transport again") {
+      module_a.transport->connect();
+      REQUIRE(transport->connects == 2);
+      REQUIRE(module_a.connected_count == 2);
+    }
+  }
+}
+
+TEST_CASE("core::messages::SharedConnection - connecting during a reconnect",
+          "[core][messages]") {
+  auto transport = std::make_shared<CountingTransport>();
+  auto connection = std::make_shared<SharedConnection>(transport);
+
+  RecordingModule module_a(*connection, "serial_a");
+  RecordingModule module_b(*connection, "serial_b");
+  module_a.transport->connect();
+  transport->loopback->dropConnection("test");
+
+  WHEN("An endpoint connects, while the reconnected connection resubscribes") {
+    // The connection is online already, but the endpoints are not notified yet
+    transport->on_subscribe = [&module_b] { module_b.transport->connect(); };
+    transport->loopback->connect();
+
+    THEN("Each endpoint is notified exactly once") {
+      REQUIRE(module_a.connected_count == 2);
+      REQUIRE(module_b.connected_count == 1);
+    }
+  }
+}
+
+TEST_CASE("core::messages::SharedConnection - acquire", "[core][messages]") {
+  int created = 0;
+  auto factory = [&created] {
+    created++;
+    return std::make_shared<LoopbackTransport>();
+  };
+
+  auto connection_a = SharedConnection::acquire("test_key", factory);
+  auto connection_b = SharedConnection::acquire("test_key", factory);
+  auto connection_c = SharedConnection::acquire("other_key", factory);
+
+  REQUIRE(connection_a == connection_b);
+  REQUIRE(connection_a != connection_c);
+  REQUIRE(created == 2);
+
+  connection_a.reset();
+  connection_b.reset();
+  auto connection_d = SharedConnection::acquire("test_key", factory);
+  REQUIRE(created == 3);
+}
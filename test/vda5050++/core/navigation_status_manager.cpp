@@ -0,0 +1,198 @@
+//  Copyright Open Logistics Foundation
+//
+//  Licensed under the Open Logistics Foundation License 1.3.
+//  For details on the licensing terms, see the LICENSE file.
+//  SPDX-License-Identifier: OLFL-1.3
+//
+
+#include "vda5050++/core/navigation_status_manager.h"
+
+#include <catch2/catch_all.hpp>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+TEST_CASE("core::NavigationStatusManager - coalesce position and velocity", "[core][events]") {
+  vda5050pp::config::EventManagerOptions opts;
+  opts.coalesce_navigation_status = true;
+  vda5050pp::core::NavigationStatusManager mgr(opts);
+
+  std::mutex mutex;
+  std::vector<double> positions;
+  std::vector<double> velocities;
+  std::promise<void> block_promise;
+  auto block = block_promise.get_future().share();
+  std::promise<void> blocked_promise;
+  auto blocked = blocked_promise.get_future();
+  std::promise<void> done_promise;
+  auto done = done_promise.get_future();
+
+  auto sub = mgr.getScopedNavigationStatusSubscriber();
+  sub.subscribe([&](std::shared_ptr<vda5050pp::events::NavigationStatusPosition> evt) {
+    bool first;
+    {
+      std::unique_lock lock(mutex);
+      first = positions.empty();
+      positions.push_back(evt->position.x);
+    }
+    if (first) {
+      // Stall processing, such that the following samples pile up
+      blocked_promise.set_value();
+      block.wait();
+    }
+    if (evt->auto_check_node_reached) {
+      evt->acquireResultToken().setValue(true);
+    }
+  });
+  sub.subscribe([&](std::shared_ptr<vda5050pp::events::NavigationStatusVelocity> evt) {
+    std::unique_lock lock(mutex);
+    velocities.push_back(evt->velocity.vx.value_or(0));
+  });
+  sub.subscribe([&](std::shared_ptr<vda5050pp::events::NavigationStatusDriving>) {
+    done_promise.set_value();
+  });
+
+  auto make_position = [](double x, bool auto_check) {
+    auto evt = std::make_shared<vda5050pp::events::NavigationStatusPosition>();
+    evt->position.x = x;
+    evt->auto_check_node_reached = auto_check;
+    return evt;
+  };
+  auto make_velocity = [](double vx) {
+    auto evt = std::make_shared<vda5050pp::events::NavigationStatusVelocity>();
+    evt->velocity.vx = vx;
+    return evt;
+  };
+
+  mgr.dispatch(make_position(0, false));
+  REQUIRE(blocked.wait_for(1s) == std::future_status::ready);
+
+  auto superseded = make_position(1, true);
+  auto superseded_future = superseded->getFuture();
+  mgr.dispatch(superseded);
+  mgr.dispatch(make_position(2, false));
+  auto latest = make_position(3, false);
+  auto latest_future = latest->getFuture();
+  mgr.dispatch(latest);
+
+  for (int i = 1; i <= 3; i++) {
+    mgr.dispatch(make_velocity(i));
+  }
+  mgr.dispatch(std::make_shared<vda5050pp::events::NavigationStatusDriving>());
+
+  block_promise.set_value();
+  REQUIRE(done.wait_for(1s) == std::future_status::ready);
+
+  // The superseded waiter is released, the newest sample inherited the node reached check
+  REQUIRE(superseded_future.wait_for(1s) == std::future_status::ready);
+  REQUIRE_FALSE(superseded_future.get());
+  REQUIRE(latest->auto_check_node_reached);
+  REQUIRE(latest_future.wait_for(1s) == std::future_status::ready);
+  REQUIRE(latest_future.get());
+
+  std::unique_lock lock(mutex);
+  REQUIRE(positions == std::vector<double>{0, 3});
+  REQUIRE(velocities == std::vector<double>{3});
+}
+
+TEST_CASE("core::NavigationStatusManager - coalescing with a queue limit", "[core][events]") {
+  using vda5050pp::config::QueueOverflowPolicy;
+
+  vda5050pp::config::EventManagerOptions opts;
+  opts.coalesce_navigation_status = true;
+  opts.default_queue_limit.capacity = 1;
+  opts.default_queue_limit.policy =
+      GENERATE(QueueOverflowPolicy::k_drop_oldest, QueueOverflowPolicy::k_drop_newest,
+               QueueOverflowPolicy::k_coalesce, QueueOverflowPolicy::k_block);
+  vda5050pp::core::NavigationStatusManager mgr(opts);
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  double last_position = 0;
+  double last_velocity = 0;
+
+  auto sub = mgr.getScopedNavigationStatusSubscriber();
+  sub.subscribe([&](std::shared_ptr<vda5050pp::events::NavigationStatusPosition> evt) {
+    std::unique_lock lock(mutex);
+    last_position = evt->position.x;
+    cv.notify_all();
+  });
+  sub.subscribe([&](std::shared_ptr<vda5050pp::events::NavigationStatusVelocity> evt) {
+    std::unique_lock lock(mutex);
+    last_velocity = evt->velocity.vx.value_or(0);
+    cv.notify_all();
+  });
+  sub.subscribe([](std::shared_ptr<vda5050pp::events::NavigationStatusDriving>) {});
+
+  constexpr int k_samples = 2000;
+  std::vector<std::thread> producers;
+  for (int p = 0; p < 2; p++) {
+    producers.emplace_back([&mgr] {
+      for (int i = 1; i < k_samples; i++) {
+        auto position = std::make_shared<vda5050pp::events::NavigationStatusPosition>();
+        position->position.x = i;
+        mgr.dispatch(position);
+        auto velocity = std::make_shared<vda5050pp::events::NavigationStatusVelocity>();
+        velocity->velocity.vx = i;
+        mgr.dispatch(velocity);
+        // Fills the queue, these are dropped or block
+        mgr.dispatch(std::make_shared<vda5050pp::events::NavigationStatusDriving>());
+      }
+    });
+  }
+  for (auto &producer : producers) {
+    producer.join();
+  }
+
+  THEN("Position and velocity are still processed after the load") {
+    // A sample may still be dropped by the limit, but the processing must not stall
+    auto processed = false;
+    for (int retry = 0; retry < 100 && !processed; retry++) {
+      auto position = std::make_shared<vda5050pp::events::NavigationStatusPosition>();
+      position->position.x = k_samples;
+      mgr.dispatch(position);
+      auto velocity = std::make_shared<vda5050pp::events::NavigationStatusVelocity>();
+      velocity->velocity.vx = k_samples;
+      mgr.dispatch(velocity);
+
+      std::unique_lock lock(mutex);
+      processed = cv.wait_for(lock, 20ms, [&] {
+        return last_position == k_samples && last_velocity == k_samples;
+      });
+    }
+    REQUIRE(processed);
+  }
+}
+
+TEST_CASE("core::NavigationStatusManager - throwing listeners", "[core][events]") {
+  vda5050pp::config::EventManagerOptions opts;
+  vda5050pp::core::NavigationStatusManager mgr(opts);
+
+  std::promise<void> done;
+  auto sub = mgr.getScopedNavigationStatusSubscriber();
+  sub.subscribe([](std::shared_ptr<vda5050pp::events::NavigationStatusDriving> evt) {
+    if (evt->is_driving) {
+      throw std::runtime_error("std::exception");
+    }
+    throw 1;
+  });
+  sub.subscribe([&done](std::shared_ptr<vda5050pp::events::NavigationStatusNodeReached>) {
+    done.set_value();
+  });
+
+  auto std_exception = std::make_shared<vda5050pp::events::NavigationStatusDriving>();
+  std_exception->is_driving = true;
+  auto unknown_exception = std::make_shared<vda5050pp::events::NavigationStatusDriving>();
+  unknown_exception->is_driving = false;
+  mgr.dispatch(std_exception);
+  mgr.dispatch(unknown_exception);
+  mgr.dispatch(std::make_shared<vda5050pp::events::NavigationStatusNodeReached>());
+
+  THEN("The events after them are still processed") {
+    REQUIRE(done.get_future().wait_for(1s) == std::future_status::ready);
+  }
+}
@@ -0,0 +1,92 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+
+#include "vda5050++/core/state/state_update_timer.h"
+
+#include <catch2/catch_all.hpp>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "vda5050++/config/state_update_timer_subconfig.h"
+#include "vda5050++/core/instance.h"
+
+using namespace std::chrono_literals;
+
+TEST_CASE("core::state::StateUpdateTimer - coalescing requests", "[core][state]") {
+  vda5050pp::Config cfg;
+  cfg.refGlobalConfig().useWhiteList();
+  cfg.refGlobalConfig().bwListModule(vda5050pp::core::module_keys::k_state_update_timer_key);
+  cfg.refGlobalConfig().refEventManagerOptions().synchronous_event_dispatch = true;
+  // No periodic state during the test
+  cfg.lookupModuleConfigAs<vda5050pp::config::StateUpdateTimerSubConfig>(
+         vda5050pp::core::module_keys::k_state_update_timer_key)
+      ->setMaxUpdatePeriod(60s);
+  vda5050pp::core::Instance::reset();
+  auto instance = vda5050pp::core::Instance::init(cfg).lock();
+
+  auto timer = std::dynamic_pointer_cast<vda5050pp::core::state::StateUpdateTimer>(
+      instance->getModule(vda5050pp::core::module_keys::k_state_update_timer_key).lock());
+  REQUIRE(timer != nullptr);
+
+  std::mutex mutex;
+  std::condition_variable sent_cv;
+  std::vector<uint32_t> sent;
+  auto sub = instance->getMessageEventManager().getScopedSubscriber();
+  sub.subscribe<vda5050pp::core::events::SendStateMessageEvent>([&](auto evt) {
+    std::unique_lock lock(mutex);
+    sent.push_back(evt->merged_update_requests);
+    sent_cv.notify_all();
+  });
+
+  auto wait_for_states = [&](std::size_t count) {
+    std::unique_lock lock(mutex);
+    return sent_cv.wait_for(lock, 5s, [&] { return sent.size() >= count; });
+  };
+
+  WHEN("Several requests are made within one period") {
+    timer->requestUpdate(vda5050pp::core::state::StateUpdateUrgency::custom(200ms));
+    timer->requestUpdate(vda5050pp::core::state::StateUpdateUrgency::custom(100ms));
+    timer->requestUpdate(vda5050pp::core::state::StateUpdateUrgency::custom(10s));
+    timer->requestUpdate(vda5050pp::core::state::StateUpdateUrgency::custom(300ms));
+    auto evt = std::make_shared<vda5050pp::core::events::RequestStateUpdateEvent>();
+    evt->urgency = vda5050pp::core::state::StateUpdateUrgency::custom(150ms);
+    instance->getStateEventManager().dispatch(evt);
+
+    THEN("A single state is sent, which merged all requests") {
+      REQUIRE(wait_for_states(1));
+      std::this_thread::sleep_for(500ms);
+
+      std::unique_lock lock(mutex);
+      REQUIRE(sent == std::vector<uint32_t>{5});
+      REQUIRE(timer->getLastMergedRequests() == 5);
+    }
+
+    THEN("A request after the state was sent schedules a new state") {
+      REQUIRE(wait_for_states(1));
+      timer->requestUpdate(vda5050pp::core::state::StateUpdateUrgency::custom(100ms));
+
+      REQUIRE(wait_for_states(2));
+      std::unique_lock lock(mutex);
+      REQUIRE(sent == std::vector<uint32_t>{5, 1});
+      REQUIRE(timer->getLastMergedRequests() == 1);
+    }
+  }
+
+  WHEN("An immediate request follows pending requests") {
+    timer->requestUpdate(vda5050pp::core::state::StateUpdateUrgency::custom(10s));
+    timer->requestUpdate(vda5050pp::core::state::StateUpdateUrgency::custom(20s));
+    timer->requestUpdate(vda5050pp::core::state::StateUpdateUrgency::immediate());
+
+    THEN("The state is sent synchronously and merged all requests") {
+      std::unique_lock lock(mutex);
+      REQUIRE(sent == std::vector<uint32_t>{3});
+      REQUIRE(timer->getLastMergedRequests() == 3);
+    }
+  }
+}
@@ -4,14 +4,67 @@
 // For details on the licensing terms, see the LICENSE file.
 // SPDX-License-Identifier: OLFL-1.3
 //
+#include <atomic>
 #include <catch2/catch_all.hpp>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include "test/data.h"
 #include "vda5050++/core/instance.h"
+#include "vda5050++/handler/base_action_handler.h"
 #include "vda5050++/version.h"
 
 using namespace std::chrono_literals;
 
+///
+///\brief A handler, which is not thread-safe (the default). Records the number of concurrent
+/// validate() calls.
+///
+class UnsafeActionHandler : public vda5050pp::handler::BaseActionHandler {
+public:
+  std::atomic<int> inside = 0;
+  std::atomic<int> max_inside = 0;
+  std::atomic<int> calls = 0;
+  bool publish_types = false;
+
+  bool match(const vda5050::Action &) const noexcept(false) override { return true; }
+
+  vda5050pp::handler::ActionCallbacks prepare(
+      std::shared_ptr<vda5050pp::handler::ActionState>,
+      std::shared_ptr<vda5050pp::handler::ParametersMap>) noexcept(false) override {
+    return {};
+  }
+
+  vda5050pp::handler::ValidationResult validate(const vda5050::Action &,
+                                                vda5050pp::misc::ActionContext) noexcept(false)
+      override {
+    auto now_inside = ++this->inside;
+    auto max = this->max_inside.load();
+    while (now_inside > max && !this->max_inside.compare_exchange_weak(max, now_inside)) {
+      // max was updated, retry
+    }
+    this->calls++;
+    std::this_thread::sleep_for(1ms);
+    this->inside--;
+    return {};
+  }
+
+  std::list<vda5050::AgvAction> getActionDescription() const noexcept(false) override {
+    return {};
+  }
+
+  std::optional<std::vector<std::string>> getHandledActionTypes() const noexcept(false) override {
+    if (!this->publish_types) {
+      return std::nullopt;
+    }
+    return std::vector<std::string>{"unsafe_type"};
+  }
+};
+
 TEST_CASE("core::validation::ValidationEventHandler::handleValidateInstantActions",
           "[core][validation]") {
   vda5050pp::Config cfg;
@@ -147,4 +200,159 @@ TEST_CASE("core::validation::ValidationEventHandler::handleValidateOrder", "[cor
       }
     }
   }
-}
\ No newline at end of file
+}
+
+#ifdef LIBVDA5050PP_COROUTINES
+TEST_CASE("core::validation::ValidationEventHandler - orders back to back", "[core][validation]") {
+  vda5050pp::Config cfg;
+  cfg.refGlobalConfig().setLogLevel(vda5050pp::config::LogLevel::k_debug);
+  cfg.refGlobalConfig().useWhiteList();
+  cfg.refGlobalConfig().bwListModule(vda5050pp::core::module_keys::k_validation_event_handler_key);
+  cfg.refGlobalConfig().refEventManagerOptions().synchronous_event_dispatch = true;
+
+  vda5050pp::core::Instance::reset();
+  auto instance = vda5050pp::core::Instance::init(cfg).lock();
+
+  std::mutex mutex;
+  std::vector<std::string> validated_actions;
+  auto sub_a = instance->getActionEventManager().getScopedActionEventSubscriber();
+  sub_a.subscribe([&](std::shared_ptr<vda5050pp::events::ActionValidate> evt) {
+    {
+      std::unique_lock lock(mutex);
+      validated_actions.push_back(evt->action->actionId);
+    }
+    vda5050::Error err;
+    err.errorType = evt->action->actionId;
+    auto tkn = evt->acquireResultToken();
+    tkn.setValue(std::list{err});
+  });
+
+  // The zone set query of the first order is held back, the second one is answered
+  std::shared_ptr<vda5050pp::events::QueryAcceptZoneSet> held_back;
+  auto sub_q = instance->getQueryEventManager().getScopedQueryEventSubscriber();
+  sub_q.subscribe([&held_back](std::shared_ptr<vda5050pp::events::QueryAcceptZoneSet> evt) {
+    if (evt->zone_set_id == "zone_set_1") {
+      held_back = evt;
+      return;
+    }
+    auto tkn = evt->acquireResultToken();
+    tkn.setValue(std::list<vda5050::Error>{});
+  });
+
+  std::vector<std::future<vda5050pp::core::events::ValidationResult>> results;
+  for (const auto &id : {"1", "2"}) {
+    auto action = test::data::mkAction(std::string("a") + id, "type", vda5050::BlockingType::NONE);
+    auto order = std::make_shared<vda5050::Order>(
+        test::data::mkTemplateOrder({test::data::TemplateElement{"n0", 0, true, {action}}}));
+    order->zoneSetId = std::string("zone_set_") + id;
+    order->orderId = std::string("order_") + id;
+    order->orderUpdateId = 0;
+    order->header.version = vda5050pp::version::getCurrentVersion();
+    auto evt_order = std::make_shared<vda5050pp::core::events::ValidateOrderEvent>();
+    evt_order->order = order;
+    results.push_back(evt_order->getFuture());
+    instance->getValidationEventManager().dispatch(evt_order);
+  }
+
+  THEN("The first order was checked completely, before its zone set query was awaited") {
+    REQUIRE(results[1].wait_for(1s) == std::future_status::ready);
+    REQUIRE(results[0].wait_for(0s) == std::future_status::timeout);
+    {
+      std::unique_lock lock(mutex);
+      REQUIRE(validated_actions == std::vector<std::string>{"a1", "a2"});
+    }
+
+    REQUIRE(held_back != nullptr);
+    vda5050::Error zone_err;
+    zone_err.errorType = "zone_set_1";
+    held_back->acquireResultToken().setValue(std::list{zone_err});
+
+    REQUIRE(results[0].wait_for(1s) == std::future_status::ready);
+    auto errors = results[0].get();
+    REQUIRE(errors.size() == 2);
+    REQUIRE(errors.front().errorType == "zone_set_1");
+    REQUIRE(errors.back().errorType == "a1");
+    std::unique_lock lock(mutex);
+    REQUIRE(validated_actions == std::vector<std::string>{"a1", "a2"});
+  }
+}
+#endif
+
+TEST_CASE("core::validation::ValidationEventHandler - parallel action validation",
+          "[core][validation]") {
+  vda5050pp::Config cfg;
+  cfg.refGlobalConfig().setLogLevel(vda5050pp::config::LogLevel::k_debug);
+  cfg.refGlobalConfig().useWhiteList();
+  cfg.refGlobalConfig().bwListModule(vda5050pp::core::module_keys::k_validation_event_handler_key);
+  cfg.refGlobalConfig().refEventManagerOptions().worker_pool_size = 3;
+  cfg.refGlobalConfig().refEventManagerOptions().parallel_action_validation = true;
+
+  vda5050pp::core::Instance::reset();
+  auto instance = vda5050pp::core::Instance::init(cfg).lock();
+
+  auto instant_actions = std::make_shared<vda5050::InstantActions>();
+  for (int i = 0; i < 50; i++) {
+    instant_actions->actions.push_back(test::data::mkAction(
+        "a" + std::to_string(i), "type" + std::to_string(i), vda5050::BlockingType::NONE));
+  }
+  auto evt_ia = std::make_shared<vda5050pp::core::events::ValidateInstantActionsEvent>();
+  evt_ia->instant_actions = instant_actions;
+
+  auto sub = instance->getActionEventManager().getScopedActionEventSubscriber();
+  sub.subscribe([](std::shared_ptr<vda5050pp::events::ActionValidate> evt) {
+    auto tkn = evt->acquireResultToken();
+    vda5050::Error err;
+    err.errorType = evt->action->actionType;
+    tkn.setValue(std::list{err});
+  });
+
+  auto result = evt_ia->getFuture();
+  instance->getValidationEventManager().dispatch(evt_ia);
+
+  THEN("Each action is validated and the errors are in the order of the actions") {
+    REQUIRE(result.wait_for(1s) == std::future_status::ready);
+    auto errors = result.get();
+    REQUIRE(errors.size() == instant_actions->actions.size());
+    auto action = instant_actions->actions.begin();
+    for (const auto &err : errors) {
+      REQUIRE(err.errorType == action->actionType);
+      action++;
+    }
+  }
+}
+
+TEST_CASE("core::validation::ValidationEventHandler - parallel validation of unsafe handlers",
+          "[core][validation]") {
+  vda5050pp::Config cfg;
+  cfg.refGlobalConfig().setLogLevel(vda5050pp::config::LogLevel::k_debug);
+  cfg.refGlobalConfig().useWhiteList();
+  cfg.refGlobalConfig().bwListModule(vda5050pp::core::module_keys::k_validation_event_handler_key);
+  cfg.refGlobalConfig().bwListModule(vda5050pp::core::module_keys::k_action_event_handler_key);
+  cfg.refGlobalConfig().refEventManagerOptions().worker_pool_size = 4;
+  cfg.refGlobalConfig().refEventManagerOptions().parallel_action_validation = true;
+
+  vda5050pp::core::Instance::reset();
+  auto instance = vda5050pp::core::Instance::init(cfg).lock();
+
+  auto handler = std::make_shared<UnsafeActionHandler>();
+  handler->publish_types = GENERATE(false, true);
+  instance->addActionHandler(handler);
+
+  auto instant_actions = std::make_shared<vda5050::InstantActions>();
+  for (int i = 0; i < 20; i++) {
+    instant_actions->actions.push_back(
+        test::data::mkAction("a" + std::to_string(i), "unsafe_type", vda5050::BlockingType::NONE));
+  }
+  auto evt_ia = std::make_shared<vda5050pp::core::events::ValidateInstantActionsEvent>();
+  evt_ia->instant_actions = instant_actions;
+
+  auto result = evt_ia->getFuture();
+  instance->getValidationEventManager().dispatch(evt_ia);
+
+  THEN("validate() is called for each action, but never concurrently") {
+    REQUIRE(result.wait_for(5s) == std::future_status::ready);
+    REQUIRE(result.get().empty());
+    REQUIRE(handler->calls == 20);
+    REQUIRE(handler->max_inside == 1);
+  }
+}
@@ -7,6 +7,7 @@
 #include "vda5050++/events/synchronized_event.h"
 
 #include <catch2/catch_all.hpp>
+#include <thread>
 
 using namespace std::chrono_literals;
 
@@ -125,3 +126,130 @@ TEST_CASE("SynchronizedEvent behaviour", "[events]") {
     }
   }
 }
+
+TEST_CASE("SynchronizedEvent future and token lifecycle", "[events]") {
+  vda5050pp::events::SynchronizedEvent<int> event;
+  auto future = event.getSynchronizedFuture();
+
+  REQUIRE(future.valid());
+
+  WHEN("The future is retrieved a second time") {
+    THEN("It throws") {
+      REQUIRE_THROWS_AS(event.getSynchronizedFuture(), std::future_error);
+      REQUIRE_THROWS_AS(event.getFuture(), std::future_error);
+    }
+  }
+
+  WHEN("No result is set") {
+    THEN("Waiting times out") {
+      REQUIRE(future.wait_for(10ms) == std::future_status::timeout);
+      REQUIRE(future.wait_until(std::chrono::system_clock::now() + 1ms) ==
+              std::future_status::timeout);
+      REQUIRE(future.wait_for(-1s) == std::future_status::timeout);
+    }
+  }
+
+  WHEN("An acquired token is destroyed without a result") {
+    { REQUIRE(event.acquireResultToken().isAcquired()); }
+
+    THEN("The event can be acquired again") { REQUIRE(event.acquireResultToken().isAcquired()); }
+  }
+
+  WHEN("An acquired token is moved") {
+    auto token1 = event.acquireResultToken();
+    auto token2 = std::move(token1);
+
+    THEN("Only the moved-to token is acquired") {
+      REQUIRE_FALSE(token1.isAcquired());
+      REQUIRE(token2.isAcquired());
+      REQUIRE_FALSE(event.acquireResultToken().isAcquired());
+    }
+  }
+
+  WHEN("The result is set by another thread") {
+    std::thread producer([&event] {
+      std::this_thread::sleep_for(10ms);
+      event.acquireResultToken().setValue(42);
+    });
+
+    THEN("The waiting future is woken up") {
+      REQUIRE(future.wait_for(1s) == std::future_status::ready);
+      REQUIRE(future.get() == 42);
+      REQUIRE_FALSE(future.valid());
+      REQUIRE_THROWS_AS(future.get(), std::future_error);
+    }
+    producer.join();
+  }
+
+  WHEN("The event is destroyed before the result is set") {
+    auto event_ptr = std::make_unique<vda5050pp::events::SynchronizedEvent<int>>();
+    auto future2 = event_ptr->getSynchronizedFuture();
+    auto token = event_ptr->acquireResultToken();
+    event_ptr.reset();
+    token.setValue(7);
+
+    THEN("The future still gets the result") { REQUIRE(future2.get() == 7); }
+  }
+
+  WHEN("The event and its acquired token are destroyed without a result") {
+    auto event_ptr = std::make_unique<vda5050pp::events::SynchronizedEvent<int>>();
+    auto future2 = event_ptr->getSynchronizedFuture();
+    {
+      auto token = event_ptr->acquireResultToken();
+      event_ptr.reset();
+      REQUIRE(future2.wait_for(0s) == std::future_status::timeout);
+    }
+
+    THEN("The future gets a broken promise") {
+      REQUIRE(future2.wait_for(0s) == std::future_status::ready);
+      try {
+        future2.get();
+        FAIL("No exception was thrown");
+      } catch (const std::future_error &e) {
+        REQUIRE(e.code() == std::future_errc::broken_promise);
+      }
+    }
+  }
+}
+
+TEST_CASE("SynchronizedEvent std::future compatibility", "[events]") {
+  static_assert(std::is_same_v<decltype(std::declval<vda5050pp::events::SynchronizedEvent<int>>()
+                                            .getFuture()),
+                               std::future<int>>);
+
+  auto event = std::make_unique<vda5050pp::events::SynchronizedEvent<int>>();
+  auto void_event = std::make_unique<vda5050pp::events::SynchronizedEvent<void>>();
+
+  WHEN("The result is set after the future was retrieved") {
+    auto future = event->getFuture();
+    auto void_future = void_event->getFuture();
+    event->acquireResultToken().setValue(3);
+    void_event->acquireResultToken().setValue();
+
+    THEN("The std::future has the result") {
+      REQUIRE(future.wait_for(100ms) == std::future_status::ready);
+      REQUIRE(future.get() == 3);
+      REQUIRE(void_future.wait_for(100ms) == std::future_status::ready);
+    }
+  }
+
+  WHEN("The result is set before the future was retrieved") {
+    event->acquireResultToken().setException(std::make_exception_ptr(std::logic_error("test")));
+    auto future = event->getFuture();
+
+    THEN("The std::future has the exception") { REQUIRE_THROWS_AS(future.get(), std::logic_error); }
+  }
+
+  WHEN("The event is destroyed without a result") {
+    auto future = event->getFuture();
+    auto void_future = void_event->getFuture();
+    event.reset();
+    void_event.reset();
+
+    THEN("The std::future gets a broken promise") {
+      REQUIRE(future.wait_for(0s) == std::future_status::ready);
+      REQUIRE_THROWS_AS(future.get(), std::future_error);
+      REQUIRE_THROWS_AS(void_future.get(), std::future_error);
+    }
+  }
+}
@@ -0,0 +1,73 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+
+#include "vda5050++/misc/latency_histogram.h"
+
+#include <catch2/catch_all.hpp>
+
+#include "vda5050++/core/common/event_statistics.h"
+
+using namespace std::chrono_literals;
+using vda5050pp::misc::LatencyHistogram;
+
+TEST_CASE("misc::LatencyHistogram - buckets", "[misc]") {
+  // Small values are exact
+  for (uint64_t v = 0; v < LatencyHistogram::k_sub_buckets; v++) {
+    REQUIRE(LatencyHistogram::bucketIndex(v) == v);
+    REQUIRE(LatencyHistogram::bucketUpperBound(v) == v);
+  }
+
+  // Each value is inside of its bucket, the relative error is bounded
+  for (uint64_t v : {8ull, 15ull, 16ull, 17ull, 1000ull, 123456789ull, (1ull << 41) - 1}) {
+    auto index = LatencyHistogram::bucketIndex(v);
+    REQUIRE(index < LatencyHistogram::k_buckets);
+    REQUIRE(LatencyHistogram::bucketUpperBound(index) >= v);
+    REQUIRE(LatencyHistogram::bucketUpperBound(index) - v <= v / LatencyHistogram::k_sub_buckets);
+    if (index > 0) {
+      REQUIRE(LatencyHistogram::bucketUpperBound(index - 1) < v);
+    }
+  }
+
+  // Huge values end up in the last bucket
+  REQUIRE(LatencyHistogram::bucketIndex(UINT64_MAX) == LatencyHistogram::k_buckets - 1);
+}
+
+TEST_CASE("misc::LatencyHistogram - statistics", "[misc]") {
+  WHEN("Nothing was recorded") {
+    LatencyHistogram histogram;
+    THEN("All values are zero") {
+      REQUIRE(histogram.getCount() == 0);
+      REQUIRE(histogram.getMin() == 0ns);
+      REQUIRE(histogram.getMax() == 0ns);
+      REQUIRE(histogram.getMean() == 0ns);
+      REQUIRE(histogram.getPercentile(99) == 0ns);
+    }
+  }
+
+  WHEN("Values are recorded") {
+    vda5050pp::core::common::AtomicLatencyHistogram recorder;
+    for (int i = 1; i <= 100; i++) {
+      recorder.record(std::chrono::microseconds(i));
+    }
+    auto histogram = recorder.snapshot();
+
+    THEN("The statistics match the recorded values") {
+      REQUIRE(histogram.getCount() == 100);
+      REQUIRE(histogram.getMin() == 1us);
+      REQUIRE(histogram.getMax() == 100us);
+      REQUIRE(histogram.getMean() == 50500ns);
+
+      auto p50 = histogram.getPercentile(50);
+      REQUIRE(p50 >= 50us);
+      REQUIRE(p50 <= 50us + 50us / LatencyHistogram::k_sub_buckets);
+      REQUIRE(histogram.getPercentile(100) == 100us);
+      auto p0 = histogram.getPercentile(0);
+      REQUIRE(p0 >= 1us);
+      REQUIRE(p0 <= 1000ns + 1000ns / LatencyHistogram::k_sub_buckets);
+    }
+  }
+}
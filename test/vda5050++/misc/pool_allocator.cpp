@@ -0,0 +1,78 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+
+#include "vda5050++/misc/pool_allocator.h"
+
+#include <catch2/catch_all.hpp>
+#include <cstdlib>
+#include <new>
+
+#include "vda5050++/core/events/state_event.h"
+#include "vda5050++/events/navigation_event.h"
+
+// Count all (non-aligned) heap allocations of the current thread. This replaces the global
+// operators, so this file is built as its own test executable (see test/CMakeLists.txt).
+static thread_local std::size_t t_heap_allocations = 0;
+
+void *operator new(std::size_t size) {
+  t_heap_allocations++;
+  if (void *ptr = std::malloc(size == 0 ? 1 : size); ptr != nullptr) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+
+void operator delete(void *ptr, std::size_t) noexcept { std::free(ptr); }
+
+static bool createAndReleaseEvents() {
+  auto position = vda5050pp::misc::makePooled<vda5050pp::events::NavigationStatusPosition>();
+  auto position_future = position->getSynchronizedFuture();
+  position->acquireResultToken().setValue(true);
+
+  auto update = vda5050pp::misc::makePooled<vda5050pp::core::events::RequestStateUpdateEvent>();
+  auto update_future = update->getSynchronizedFuture();
+  update->acquireResultToken().setValue();
+
+  update_future.get();
+  return position_future.get();
+}
+
+TEST_CASE("misc::PoolAllocator reuses memory", "[misc]") {
+  struct Object {
+    int a = 0;
+    double b = 0;
+  };
+
+  auto first = vda5050pp::misc::makePooled<Object>();
+  auto first_address = first.get();
+  first.reset();
+
+  auto second = vda5050pp::misc::makePooled<Object>();
+  REQUIRE(second.get() == first_address);
+
+  auto third = vda5050pp::misc::makePooled<Object>();
+  REQUIRE(third.get() != second.get());
+}
+
+TEST_CASE("misc::PoolAllocator event creation does not allocate in steady-state", "[misc]") {
+  // Warm up the pools
+  for (int i = 0; i < 10; i++) {
+    REQUIRE(createAndReleaseEvents());
+  }
+
+  bool results = true;
+  auto allocations_before = t_heap_allocations;
+  for (int i = 0; i < 1000; i++) {
+    results = createAndReleaseEvents() && results;
+  }
+  auto allocations_after = t_heap_allocations;
+
+  REQUIRE(results);
+  REQUIRE(allocations_after - allocations_before == 0);
+}
@@ -0,0 +1,67 @@
+// Copyright Open Logistics Foundation
+//
+// Licensed under the Open Logistics Foundation License 1.3.
+// For details on the licensing terms, see the LICENSE file.
+// SPDX-License-Identifier: OLFL-1.3
+//
+
+#include "vda5050++/observer/event_observer.h"
+
+#include <catch2/catch_all.hpp>
+#include <future>
+
+#include "vda5050++/core/instance.h"
+
+using namespace std::chrono_literals;
+
+TEST_CASE("observer::EventObserver - event statistics", "[observer]") {
+  vda5050pp::Config cfg;
+  cfg.refGlobalConfig().useWhiteList();
+  vda5050pp::core::Instance::reset();
+  auto instance = vda5050pp::core::Instance::init(cfg).lock();
+
+  vda5050pp::observer::EventObserver observer;
+
+  WHEN("No events were dispatched yet") {
+    THEN("There are no statistics") { REQUIRE(observer.getStatistics().empty()); }
+  }
+
+  WHEN("Events are dispatched asynchronously") {
+    constexpr int k_events = 10;
+    std::promise<void> done_promise;
+    auto done = done_promise.get_future();
+    int handled = 0;
+
+    auto sub = instance->getQueryEventManager().getScopedQueryEventSubscriber();
+    sub.subscribe([&](std::shared_ptr<vda5050pp::events::QueryPauseable>) {
+      std::this_thread::sleep_for(1ms);
+      if (++handled == k_events) {
+        done_promise.set_value();
+      }
+    });
+
+    for (int i = 0; i < k_events; i++) {
+      instance->getQueryEventManager().dispatch(
+          std::make_shared<vda5050pp::events::QueryPauseable>());
+    }
+    REQUIRE(done.wait_for(1s) == std::future_status::ready);
+
+    THEN("The statistics of the event are recorded") {
+      auto stats = observer.getStatistics("QueryEventManager");
+
+      if (!vda5050pp::observer::EventObserver::isEnabled()) {
+        REQUIRE(stats.empty());
+        return;
+      }
+
+      REQUIRE(stats.size() == 1);
+      REQUIRE(stats[0].manager == "QueryEventManager");
+      REQUIRE(stats[0].event_id == int(vda5050pp::events::QueryEventType::k_pauseable));
+      REQUIRE(stats[0].enqueued == k_events);
+      // The last event may still be recorded after its handler returned
+      REQUIRE(stats[0].processed >= k_events - 1);
+      REQUIRE(stats[0].handler_duration.getMin() >= 1ms);
+      REQUIRE(stats[0].queue_wait.getMax() >= 1ms);
+    }
+  }
+}